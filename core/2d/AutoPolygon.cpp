@@ -33,8 +33,14 @@ THE SOFTWARE.
 #include "base/axstd.h"
 #include "renderer/TextureCache.h"
 #include "clipper2/clipper.h"
+#include "platform/FileUtils.h"
+#include "xxhash/xxhash.h"
+#include "yasio/ibstream.hpp"
+#include "yasio/obstream.hpp"
 #include <algorithm>
 #include <math.h>
+#include <mutex>
+#include <unordered_map>
 
 static unsigned short quadIndices9[] = {
     0 + 4 * 0, 1 + 4 * 0, 2 + 4 * 0, 3 + 4 * 0, 2 + 4 * 0, 1 + 4 * 0, 0 + 4 * 1, 1 + 4 * 1, 2 + 4 * 1,
@@ -171,12 +177,84 @@ float PolygonInfo::getArea() const
     return area;
 }
 
+namespace
+{
+struct CachedPolygon
+{
+    Rect rect;
+    std::vector<V3F_C4B_T2F> verts;
+    std::vector<unsigned short> indices;
+};
+
+bool s_polygonCacheEnabled = true;
+std::mutex s_polygonCacheMutex;
+std::unordered_map<uint64_t, CachedPolygon> s_polygonCache;
+
+constexpr char POLYGON_CACHE_MAGIC[4] = {'A', 'X', 'P', 'C'};
+constexpr uint32_t POLYGON_CACHE_VERSION = 1;
+
+uint64_t makePolygonKey(uint64_t fileHash, const Rect& rect, float epsilon, float threshold, float scaleFactor)
+{
+    const float params[] = {rect.origin.x, rect.origin.y, rect.size.width, rect.size.height,
+                            epsilon,       threshold,     scaleFactor};
+    return XXH3_64bits_withSeed(params, sizeof(params), fileHash);
+}
+
+bool findCachedPolygon(uint64_t key, std::string_view filename, PolygonInfo& info)
+{
+    std::lock_guard<std::mutex> lck(s_polygonCacheMutex);
+    auto it = s_polygonCache.find(key);
+    if (it == s_polygonCache.end())
+        return false;
+
+    auto& cached = it->second;
+    auto verts   = new V3F_C4B_T2F[cached.verts.size()];
+    auto indices = new unsigned short[cached.indices.size()];
+    memcpy(verts, cached.verts.data(), cached.verts.size() * sizeof(V3F_C4B_T2F));
+    memcpy(indices, cached.indices.data(), cached.indices.size() * sizeof(unsigned short));
+
+    info.triangles = TrianglesCommand::Triangles{verts, indices, static_cast<unsigned int>(cached.verts.size()),
+                                                 static_cast<unsigned int>(cached.indices.size())};
+    info.setRect(cached.rect);
+    info.setFilename(filename);
+    return true;
+}
+
+void storeCachedPolygon(uint64_t key, const PolygonInfo& info)
+{
+    auto& tri = info.triangles;
+    if (tri.vertCount == 0 || tri.indexCount == 0)
+        return;
+
+    CachedPolygon cached;
+    cached.rect = info.getRect();
+    cached.verts.assign(tri.verts, tri.verts + tri.vertCount);
+    cached.indices.assign(tri.indices, tri.indices + tri.indexCount);
+
+    std::lock_guard<std::mutex> lck(s_polygonCacheMutex);
+    s_polygonCache[key] = std::move(cached);
+}
+
+}  // namespace
+
 AutoPolygon::AutoPolygon(std::string_view filename)
-    : _image(nullptr), _data(nullptr), _filename(""), _width(0), _height(0), _scaleFactor(0)
+    : AutoPolygon(filename, FileUtils::getInstance()->getDataFromFile(filename), 0)
+{}
+
+AutoPolygon::AutoPolygon(std::string_view filename, Data fileData, uint64_t fileHash)
+    : _image(nullptr), _data(nullptr), _filename(""), _width(0), _height(0), _scaleFactor(0), _fileHash(fileHash)
 {
     _filename = filename;
-    _image    = new Image();
-    _image->initWithImageFile(filename);
+    if (!_fileHash)
+        _fileHash = XXH3_64bits(fileData.getBytes(), fileData.getSize());
+
+    _image = new Image();
+    if (!fileData.isNull())
+    {
+        ssize_t n = 0;
+        auto buf  = fileData.takeBuffer(&n);
+        _image->initWithImageData(buf, n, true);
+    }
     AXASSERT(_image->getPixelFormat() == backend::PixelFormat::RGBA8,
              "unsupported format, currently only supports rgba8888");
     _data        = _image->getData();
@@ -709,6 +787,21 @@ Rect AutoPolygon::getRealRect(const Rect& rect)
 }
 
 PolygonInfo AutoPolygon::generateTriangles(const Rect& rect, float epsilon, float threshold)
+{
+    if (!s_polygonCacheEnabled)
+        return buildTriangles(rect, epsilon, threshold);
+
+    PolygonInfo ret;
+    const auto key = makePolygonKey(_fileHash, rect, epsilon, threshold, _scaleFactor);
+    if (findCachedPolygon(key, _filename, ret))
+        return ret;
+
+    ret = buildTriangles(rect, epsilon, threshold);
+    storeCachedPolygon(key, ret);
+    return ret;
+}
+
+PolygonInfo AutoPolygon::buildTriangles(const Rect& rect, float epsilon, float threshold)
 {
     Rect realRect = getRealRect(rect);
     auto p        = trace(realRect, threshold);
@@ -725,8 +818,188 @@ PolygonInfo AutoPolygon::generateTriangles(const Rect& rect, float epsilon, floa
 
 PolygonInfo AutoPolygon::generatePolygon(std::string_view filename, const Rect& rect, float epsilon, float threshold)
 {
-    AutoPolygon ap(filename);
+    auto fileData       = FileUtils::getInstance()->getDataFromFile(filename);
+    const auto fileHash = XXH3_64bits(fileData.getBytes(), fileData.getSize());
+
+    // a cache hit doesn't need to decode the image
+    PolygonInfo ret;
+    if (s_polygonCacheEnabled &&
+        findCachedPolygon(
+            makePolygonKey(fileHash, rect, epsilon, threshold, Director::getInstance()->getContentScaleFactor()),
+            filename, ret))
+        return ret;
+
+    AutoPolygon ap(filename, std::move(fileData), fileHash);
     return ap.generateTriangles(rect, epsilon, threshold);
 }
 
+std::vector<PolygonInfo> AutoPolygon::generatePolygons(const std::vector<PolygonRequest>& requests)
+{
+    struct Source
+    {
+        std::string_view filename;
+        std::string fullPath;
+        Data fileData;
+        uint64_t fileHash = 0;
+        std::unique_ptr<AutoPolygon> polygon;
+        bool needed = false;
+    };
+
+    std::vector<PolygonInfo> results(requests.size());
+    std::vector<Source> sources;
+    std::vector<size_t> requestSources(requests.size());
+    std::unordered_map<std::string_view, size_t> sourceIndices;
+
+    // full paths are resolved here, FileUtils' path cache isn't thread safe
+    auto fileUtils = FileUtils::getInstance();
+    for (size_t i = 0; i < requests.size(); ++i)
+    {
+        auto [it, inserted] = sourceIndices.emplace(requests[i].filename, sources.size());
+        if (inserted)
+        {
+            auto& source    = sources.emplace_back();
+            source.filename = requests[i].filename;
+            source.fullPath = fileUtils->fullPathForFilename(source.filename);
+        }
+        requestSources[i] = it->second;
+    }
+
+    auto jobSystem = Director::getInstance()->getJobSystem();
+    jobSystem->parallelFor(sources.size(), [&sources, fileUtils](size_t i) {
+        auto& source    = sources[i];
+        source.fileData = fileUtils->getDataFromFile(source.fullPath);
+        source.fileHash = XXH3_64bits(source.fileData.getBytes(), source.fileData.getSize());
+    });
+
+    const float scaleFactor = Director::getInstance()->getContentScaleFactor();
+    std::vector<size_t> pending;
+    std::vector<uint64_t> keys(requests.size());
+    for (size_t i = 0; i < requests.size(); ++i)
+    {
+        auto& request = requests[i];
+        auto& source  = sources[requestSources[i]];
+        keys[i]       = makePolygonKey(source.fileHash, request.rect, request.epsilon, request.threshold, scaleFactor);
+        if (s_polygonCacheEnabled && findCachedPolygon(keys[i], request.filename, results[i]))
+            continue;
+        if (source.fileData.isNull())
+        {
+            AXLOGE("AUTOPOLYGON: can't read {}", request.filename);
+            continue;
+        }
+        source.needed = true;
+        pending.emplace_back(i);
+    }
+
+    // decode each image once, then trace all the pending polygons
+    jobSystem->parallelFor(sources.size(), [&sources](size_t i) {
+        auto& source = sources[i];
+        if (source.needed)
+            source.polygon.reset(new AutoPolygon(source.filename, std::move(source.fileData), source.fileHash));
+    });
+    jobSystem->parallelFor(pending.size(), [&](size_t i) {
+        const auto index = pending[i];
+        auto& request    = requests[index];
+        results[index]   = sources[requestSources[index]].polygon->buildTriangles(request.rect, request.epsilon,
+                                                                                  request.threshold);
+    });
+
+    if (s_polygonCacheEnabled)
+    {
+        for (auto index : pending)
+            storeCachedPolygon(keys[index], results[index]);
+    }
+
+    return results;
+}
+
+void AutoPolygon::setPolygonCacheEnabled(bool enabled)
+{
+    s_polygonCacheEnabled = enabled;
+}
+
+bool AutoPolygon::isPolygonCacheEnabled()
+{
+    return s_polygonCacheEnabled;
+}
+
+bool AutoPolygon::loadPolygonCache(std::string_view filename)
+{
+    auto data = FileUtils::getInstance()->getDataFromFile(filename);
+    if (data.getSize() < sizeof(POLYGON_CACHE_MAGIC) ||
+        memcmp(data.getBytes(), POLYGON_CACHE_MAGIC, sizeof(POLYGON_CACHE_MAGIC)) != 0)
+    {
+        AXLOGW("AUTOPOLYGON: {} isn't a polygon cache", filename);
+        return false;
+    }
+
+    std::unordered_map<uint64_t, CachedPolygon> loaded;
+    try
+    {
+        yasio::ibstream_view ibs(data.getBytes(), data.getSize());
+        ibs.advance(sizeof(POLYGON_CACHE_MAGIC));
+        if (ibs.read<uint32_t>() != POLYGON_CACHE_VERSION)
+        {
+            AXLOGW("AUTOPOLYGON: {} was written by another version", filename);
+            return false;
+        }
+
+        const auto count = ibs.read<uint32_t>();
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            const auto key = ibs.read<uint64_t>();
+            CachedPolygon cached;
+            ibs.read_bytes(&cached.rect, sizeof(Rect));
+            const auto vertCount  = ibs.read<uint32_t>();
+            const auto indexCount = ibs.read<uint32_t>();
+            if (vertCount * sizeof(V3F_C4B_T2F) + indexCount * sizeof(unsigned short) > data.getSize())
+                throw std::out_of_range("polygon size");
+            cached.verts.resize(vertCount);
+            cached.indices.resize(indexCount);
+            ibs.read_bytes(cached.verts.data(), static_cast<int>(cached.verts.size() * sizeof(V3F_C4B_T2F)));
+            ibs.read_bytes(cached.indices.data(), static_cast<int>(cached.indices.size() * sizeof(unsigned short)));
+            loaded.emplace(key, std::move(cached));
+        }
+    }
+    catch (const std::exception&)
+    {
+        AXLOGW("AUTOPOLYGON: polygon cache {} is truncated", filename);
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lck(s_polygonCacheMutex);
+    for (auto& item : loaded)
+        s_polygonCache[item.first] = std::move(item.second);
+    return true;
+}
+
+bool AutoPolygon::savePolygonCache(std::string_view fullPath)
+{
+    static_assert(std::is_trivially_copyable_v<V3F_C4B_T2F>, "polygon cache stores raw vertices");
+
+    yasio::obstream obs;
+    {
+        std::lock_guard<std::mutex> lck(s_polygonCacheMutex);
+        obs.write_bytes(POLYGON_CACHE_MAGIC, sizeof(POLYGON_CACHE_MAGIC));
+        obs.write<uint32_t>(POLYGON_CACHE_VERSION);
+        obs.write<uint32_t>(static_cast<uint32_t>(s_polygonCache.size()));
+        for (auto& [key, cached] : s_polygonCache)
+        {
+            obs.write<uint64_t>(key);
+            obs.write_bytes(&cached.rect, sizeof(Rect));
+            obs.write<uint32_t>(static_cast<uint32_t>(cached.verts.size()));
+            obs.write<uint32_t>(static_cast<uint32_t>(cached.indices.size()));
+            obs.write_bytes(cached.verts.data(), static_cast<int>(cached.verts.size() * sizeof(V3F_C4B_T2F)));
+            obs.write_bytes(cached.indices.data(), static_cast<int>(cached.indices.size() * sizeof(unsigned short)));
+        }
+    }
+
+    return FileUtils::writeBinaryToFile(obs.data(), obs.length(), fullPath);
+}
+
+void AutoPolygon::purgePolygonCache()
+{
+    std::lock_guard<std::mutex> lck(s_polygonCacheMutex);
+    s_polygonCache.clear();
+}
+
 }
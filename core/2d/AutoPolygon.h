@@ -262,7 +262,58 @@ public:
                                        float epsilon = 2.0f,
                                        float threshold = 0.05f);
 
+    /**
+     * The parameters of one polygon generated by generatePolygons
+     */
+    struct PolygonRequest
+    {
+        std::string filename;
+        Rect rect       = Rect::ZERO;
+        float epsilon   = 2.0f;
+        float threshold = 0.05f;
+    };
+
+    /**
+     * Generates the polygons of many frames at once. Each image file is read and decoded once, and images and
+     * polygons are processed concurrently on the JobSystem workers and the calling thread.
+     * Requests found in the polygon cache are not generated again.
+     * @warning must be called from the main thread
+     * @param   requests    the frames to generate polygons for
+     * @return  a PolygonInfo per request, in the same order
+     */
+    static std::vector<PolygonInfo> generatePolygons(const std::vector<PolygonRequest>& requests);
+
+    /**
+     * Enables the polygon cache, enabled by default.
+     * Generated polygons are kept in memory keyed by the image content hash, rect, epsilon, threshold and content
+     * scale factor, so generating the same polygon again only copies the cached vertices.
+     */
+    static void setPolygonCacheEnabled(bool enabled);
+    static bool isPolygonCacheEnabled();
+
+    /**
+     * Merges a polygon cache file written by savePolygonCache into the polygon cache, so the polygons of a sprite
+     * sheet can be shipped next to it instead of being generated at runtime.
+     * @return  false if the file is missing or isn't a valid polygon cache
+     */
+    static bool loadPolygonCache(std::string_view filename);
+
+    /**
+     * Writes all the cached polygons to a file.
+     */
+    static bool savePolygonCache(std::string_view fullPath);
+
+    /**
+     * Removes all the cached polygons.
+     */
+    static void purgePolygonCache();
+
 protected:
+    AutoPolygon(std::string_view filename, Data fileData, uint64_t fileHash);
+
+    // trace, reduce, expand, triangulate and calculate uv without going through the polygon cache
+    PolygonInfo buildTriangles(const Rect& rect, float epsilon, float threshold);
+
     Vec2 findFirstNoneTransparentPixel(const Rect& rect, float threshold);
     std::vector<ax::Vec2> marchSquare(const Rect& rect, const Vec2& first, float threshold);
     unsigned int getSquareValue(unsigned int x, unsigned int y, const Rect& rect, float threshold);
@@ -289,6 +340,7 @@ protected:
     unsigned int _height;
     float _scaleFactor;
     unsigned int _threshold;
+    uint64_t _fileHash;
 };
 
 }
@@ -66,6 +66,7 @@ void ClippingRectangleNode::onBeforeVisitScissor()
     {
         auto renderer   = _director->getRenderer();
         _oldScissorTest = renderer->getScissorTest();
+        _oldScissorRect = renderer->getScissorRect();
         renderer->setScissorTest(true);
 
         float scaleX = _scaleX;
@@ -88,7 +89,15 @@ void ClippingRectangleNode::onBeforeVisitScissor()
 void ClippingRectangleNode::onAfterVisitScissor()
 {
     if (_clippingEnabled)
-        _director->getRenderer()->setScissorTest(_oldScissorTest);
+    {
+        // restore the outer scissor too, e.g. the one of the dirty region redraw mode
+        auto renderer = _director->getRenderer();
+        renderer->setScissorTest(_oldScissorTest);
+        if (_oldScissorTest)
+            renderer->setScissorRect(static_cast<float>(_oldScissorRect.x), static_cast<float>(_oldScissorRect.y),
+                                     static_cast<float>(_oldScissorRect.width),
+                                     static_cast<float>(_oldScissorRect.height));
+    }
 }
 
 void ClippingRectangleNode::visit(Renderer* renderer, const Mat4& parentTransform, uint32_t parentFlags)
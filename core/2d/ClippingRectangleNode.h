@@ -95,6 +95,7 @@ protected:
     bool _clippingEnabled = true;
 
     bool _oldScissorTest = false;
+    ScissorRect _oldScissorRect;
 
     CallbackCommand* _beforeVisitCmdScissor;
     CallbackCommand* _afterVisitCmdScissor;
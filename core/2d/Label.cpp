@@ -1702,6 +1702,8 @@ void Label::setCameraMask(unsigned short mask, bool applyChildren)
 
 void Label::updateContent()
 {
+    setRenderDirty();
+
     if (_systemFontDirty)
     {
         if (_fontAtlas)
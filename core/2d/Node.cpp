@@ -36,6 +36,7 @@ THE SOFTWARE.
 
 #include "xxhash.h"
 #include "base/Director.h"
+#include "base/JobSystem.h"
 #include "base/Scheduler.h"
 #include "base/EventDispatcher.h"
 #include "base/UTF8.h"
@@ -62,10 +63,17 @@ THE SOFTWARE.
 namespace ax
 {
 
+namespace
+{
+// children of a wide node are handed to the workers in chunks of this many siblings
+constexpr size_t TRANSFORM_CHUNK_SIZE = 128;
+}  // namespace
+
 // FIXME:: Yes, nodes might have a sort problem once every 30 days if the game runs at 60 FPS and each frame sprites are
 // reordered.
 std::uint32_t Node::s_globalOrderOfArrival = 0;
 int Node::__attachedNodeCount              = 0;
+bool Node::s_matrixStackSyncEnabled        = true;
 
 // MARK: Constructor, Destructor, Init
 
@@ -90,6 +98,9 @@ Node::Node()
     , _additionalTransform(nullptr)
     , _additionalTransformDirty(false)
     , _transformUpdated(true)
+    , _preparedFlags(0)
+    , _preparedFrame(0)
+    , _renderDirty(false)
     // children (lazy allocs)
     , _childrenIndexer(nullptr)
     // lazy alloc
@@ -257,7 +268,7 @@ void Node::setSkewX(float skewX)
         return;
 
     _skewX            = skewX;
-    _transformUpdated = _transformDirty = _inverseDirty = true;
+    markTransformDirty();
 }
 
 float Node::getSkewY() const
@@ -271,7 +282,7 @@ void Node::setSkewY(float skewY)
         return;
 
     _skewY            = skewY;
-    _transformUpdated = _transformDirty = _inverseDirty = true;
+    markTransformDirty();
 }
 
 void Node::setLocalZOrder(int z)
@@ -285,6 +296,7 @@ void Node::setLocalZOrder(int z)
         _parent->reorderChild(this, z);
     }
 
+    setRenderDirty();
     _eventDispatcher->setDirtyForNode(this);
 }
 
@@ -305,6 +317,7 @@ void Node::setGlobalZOrder(float globalZOrder)
     if (_globalZOrder != globalZOrder)
     {
         _globalZOrder = globalZOrder;
+        setRenderDirty();
         _eventDispatcher->setDirtyForNode(this);
     }
 }
@@ -323,7 +336,7 @@ void Node::setRotation(float rotation)
         return;
 
     _rotationZ_X = _rotationZ_Y = rotation;
-    _transformUpdated = _transformDirty = _inverseDirty = true;
+    markTransformDirty();
 
     updateRotationQuat();
 }
@@ -338,7 +351,7 @@ void Node::setRotation3D(const Vec3& rotation)
     if (_rotationX == rotation.x && _rotationY == rotation.y && _rotationZ_X == rotation.z)
         return;
 
-    _transformUpdated = _transformDirty = _inverseDirty = true;
+    markTransformDirty();
 
     _rotationX = rotation.x;
     _rotationY = rotation.y;
@@ -391,7 +404,7 @@ void Node::setRotationQuat(const Quaternion& quat)
 {
     _rotationQuat = quat;
     updateRotation3D();
-    _transformUpdated = _transformDirty = _inverseDirty = true;
+    markTransformDirty();
 }
 
 Quaternion Node::getRotationQuat() const
@@ -405,7 +418,7 @@ void Node::setRotationSkewX(float rotationX)
         return;
 
     _rotationZ_X      = rotationX;
-    _transformUpdated = _transformDirty = _inverseDirty = true;
+    markTransformDirty();
 
     updateRotationQuat();
 }
@@ -421,7 +434,7 @@ void Node::setRotationSkewY(float rotationY)
         return;
 
     _rotationZ_Y      = rotationY;
-    _transformUpdated = _transformDirty = _inverseDirty = true;
+    markTransformDirty();
 
     updateRotationQuat();
 }
@@ -440,7 +453,7 @@ void Node::setScale(float scale)
         return;
 
     _scaleX = _scaleY = _scaleZ = scale;
-    _transformUpdated = _transformDirty = _inverseDirty = true;
+    markTransformDirty();
 }
 
 /// scaleX getter
@@ -457,7 +470,7 @@ void Node::setScale(float scaleX, float scaleY)
 
     _scaleX           = scaleX;
     _scaleY           = scaleY;
-    _transformUpdated = _transformDirty = _inverseDirty = true;
+    markTransformDirty();
 }
 
 /// scaleX setter
@@ -467,7 +480,7 @@ void Node::setScaleX(float scaleX)
         return;
 
     _scaleX           = scaleX;
-    _transformUpdated = _transformDirty = _inverseDirty = true;
+    markTransformDirty();
 }
 
 /// scaleY getter
@@ -483,7 +496,7 @@ void Node::setScaleZ(float scaleZ)
         return;
 
     _scaleZ           = scaleZ;
-    _transformUpdated = _transformDirty = _inverseDirty = true;
+    markTransformDirty();
 }
 
 /// scaleY getter
@@ -499,7 +512,7 @@ void Node::setScaleY(float scaleY)
         return;
 
     _scaleY           = scaleY;
-    _transformUpdated = _transformDirty = _inverseDirty = true;
+    markTransformDirty();
 }
 
 /// position getter
@@ -528,7 +541,7 @@ void Node::setPosition(float x, float y)
     _position.x = x;
     _position.y = y;
 
-    _transformUpdated = _transformDirty = _inverseDirty = true;
+    markTransformDirty();
     _usingNormalizedPosition                            = false;
 }
 
@@ -573,7 +586,7 @@ void Node::setPositionZ(float positionZ)
     if (_positionZ == positionZ)
         return;
 
-    _transformUpdated = _transformDirty = _inverseDirty = true;
+    markTransformDirty();
 
     _positionZ = positionZ;
 }
@@ -593,7 +606,7 @@ void Node::setPositionNormalized(const Vec2& position)
     _normalizedPosition      = position;
     _usingNormalizedPosition = true;
     _normalizedPositionDirty = true;
-    _transformUpdated = _transformDirty = _inverseDirty = true;
+    markTransformDirty();
 }
 
 ssize_t Node::getChildrenCount() const
@@ -614,7 +627,9 @@ void Node::setVisible(bool visible)
     {
         _visible = visible;
         if (_visible)
-            _transformUpdated = _transformDirty = _inverseDirty = true;
+            markTransformDirty();
+        else
+            invalidateRenderBounds();
     }
 }
 
@@ -635,7 +650,7 @@ void Node::setAnchorPoint(const Vec2& point)
     {
         _anchorPoint = point;
         _anchorPointInPoints.set(_contentSize.width * _anchorPoint.x, _contentSize.height * _anchorPoint.y);
-        _transformUpdated = _transformDirty = _inverseDirty = true;
+        markTransformDirty();
     }
 }
 
@@ -652,7 +667,8 @@ void Node::setContentSize(const Vec2& size)
         _contentSize = size;
 
         _anchorPointInPoints.set(_contentSize.width * _anchorPoint.x, _contentSize.height * _anchorPoint.y);
-        _transformUpdated = _transformDirty = _inverseDirty = _contentSizeDirty = true;
+        _contentSizeDirty = true;
+        markTransformDirty();
     }
 }
 
@@ -674,7 +690,7 @@ void Node::setParent(Node* parent)
 {
     _parent           = parent;
     _normalizedPositionDirty = true;
-    _transformUpdated = _transformDirty = _inverseDirty = true;
+    markTransformDirty();
 }
 
 /// isRelativeAnchorPoint getter
@@ -689,7 +705,7 @@ void Node::setIgnoreAnchorPointForPosition(bool newValue)
     if (newValue != _ignoreAnchorPointForPosition)
     {
         _ignoreAnchorPointForPosition = newValue;
-        _transformUpdated = _transformDirty = _inverseDirty = true;
+        markTransformDirty();
     }
 }
 
@@ -1190,6 +1206,7 @@ void Node::insertChild(Node* child, int z)
 #endif  // AX_ENABLE_GC_FOR_NATIVE_OBJECTS
     _transformUpdated  = true;
     _reorderChildDirty = true;
+    _director->markSceneChanged();
     _children.pushBack(child);
     child->_setLocalZOrder(z);
 }
@@ -1229,7 +1246,7 @@ void Node::visit()
     visit(renderer, parentTransform, FLAGS_TRANSFORM_DIRTY);
 }
 
-uint32_t Node::processParentFlags(const Mat4& parentTransform, uint32_t parentFlags)
+void Node::updateNormalizedPosition(uint32_t parentFlags)
 {
     if (_usingNormalizedPosition)
     {
@@ -1243,6 +1260,32 @@ uint32_t Node::processParentFlags(const Mat4& parentTransform, uint32_t parentFl
             _normalizedPositionDirty                            = false;
         }
     }
+}
+
+uint32_t Node::processParentFlags(const Mat4& parentTransform, uint32_t parentFlags)
+{
+    if (_preparedFrame != 0)
+    {
+        if (!isVisitableByVisitingCamera())
+            return parentFlags;
+
+        // the transform was already computed by prepareTransforms() during this frame
+        const bool preparedThisFrame = _preparedFrame == _director->getTotalFrames() + 1;
+        _preparedFrame               = 0;
+        if (preparedThisFrame && !isPreparedTransformStale(parentTransform, parentFlags))
+        {
+            _transformUpdated = false;
+            _contentSizeDirty = false;
+            if (_director->isTrackingDirtyRegions())
+                updateRenderBounds(_preparedFlags);
+            return _preparedFlags;
+        }
+
+        // prepared in an earlier frame or moved since, recompute but keep the dirty bits it swallowed
+        parentFlags |= _preparedFlags;
+    }
+
+    updateNormalizedPosition(parentFlags);
 
     // Fixes Github issue #16100. Basically when having two cameras, one camera might set as dirty the
     // node that is not visited by it, and might affect certain calculations. Besides, it is faster to do this.
@@ -1259,9 +1302,106 @@ uint32_t Node::processParentFlags(const Mat4& parentTransform, uint32_t parentFl
     _transformUpdated = false;
     _contentSizeDirty = false;
 
+    if (_director->isTrackingDirtyRegions())
+        updateRenderBounds(flags);
+
     return flags;
 }
 
+bool Node::isPreparedTransformStale(const Mat4& parentTransform, uint32_t parentFlags) const
+{
+    // setters mark the local transform dirty again after the pass computed it, e.g. Layout::doLayout()
+    // or ParallaxNode::visit() moving children right before visiting them
+    if (_transformDirty || ((_transformUpdated || _contentSizeDirty) && !(_preparedFlags & FLAGS_DIRTY_MASK)))
+        return true;
+
+    // the caller may pass another parent transform than the pass used, e.g. BillBoard::visit()
+    if (!(parentFlags & FLAGS_DIRTY_MASK))
+        return false;
+    return !(_preparedFlags & FLAGS_DIRTY_MASK) ||
+           memcmp(parentTransform.m, _preparedParentTransform.m, sizeof(parentTransform.m)) != 0;
+}
+
+void Node::setRenderDirty()
+{
+    _renderDirty = true;
+    _director->markSceneChanged();
+}
+
+void Node::markTransformDirty()
+{
+    _transformUpdated = _transformDirty = _inverseDirty = true;
+    _director->markSceneChanged();
+}
+
+void Node::updateRenderBounds(uint32_t flags)
+{
+    if (!(flags & FLAGS_DIRTY_MASK) && !_renderDirty)
+        return;
+
+    Rect bounds;
+    if (_contentSize.width > 0 && _contentSize.height > 0)
+        bounds = RectApplyTransform(Rect(Vec2::ZERO, _contentSize), _modelViewTransform);
+
+    // both where the node was and where it is now have to be redrawn
+    if (_renderDirty || !bounds.equals(_renderBounds))
+    {
+        _director->addDirtyRegion(_renderBounds);
+        _director->addDirtyRegion(bounds);
+        _renderBounds = bounds;
+    }
+    _renderDirty = false;
+}
+
+void Node::invalidateRenderBounds()
+{
+    // the node stops drawing, what it covered has to be redrawn
+    if (_director->isDirtyRegionRedrawEnabled())
+        _director->addDirtyRegion(_renderBounds);
+    _renderBounds = Rect::ZERO;
+}
+
+void Node::prepareTransforms(const Mat4& parentTransform, uint32_t parentFlags, size_t parallelThreshold)
+{
+    // invisible subtrees are skipped by visit() too
+    if (!_visible)
+        return;
+
+    updateNormalizedPosition(parentFlags);
+
+    uint32_t flags = parentFlags;
+    if (_preparedFrame != 0)
+        flags |= _preparedFlags;
+    flags |= (_transformUpdated ? FLAGS_TRANSFORM_DIRTY : 0);
+    flags |= (_contentSizeDirty ? FLAGS_CONTENT_SIZE_DIRTY : 0);
+
+    if (flags & FLAGS_DIRTY_MASK)
+    {
+        _modelViewTransform      = this->transform(parentTransform);
+        _preparedParentTransform = parentTransform;
+    }
+
+    // the dirty bits are left for visit() to clear, subclasses such as Camera still read them there
+    _preparedFlags = flags;
+    _preparedFrame = _director->getTotalFrames() + 1;
+
+    const auto childCount = static_cast<size_t>(_children.size());
+    if (parallelThreshold == 0 || childCount < parallelThreshold)
+    {
+        for (auto child : _children)
+            child->prepareTransforms(_modelViewTransform, flags, parallelThreshold);
+        return;
+    }
+
+    // every child subtree only writes to itself, so chunks of siblings can be walked concurrently
+    const size_t chunks = (childCount + TRANSFORM_CHUNK_SIZE - 1) / TRANSFORM_CHUNK_SIZE;
+    _director->getJobSystem()->parallelFor(chunks, [this, flags, childCount, parallelThreshold](size_t chunk) {
+        const size_t end = std::min(childCount, (chunk + 1) * TRANSFORM_CHUNK_SIZE);
+        for (size_t i = chunk * TRANSFORM_CHUNK_SIZE; i < end; ++i)
+            _children.at(i)->prepareTransforms(_modelViewTransform, flags, parallelThreshold);
+    });
+}
+
 bool Node::isVisitableByVisitingCamera() const
 {
     auto camera          = Camera::getVisitingCamera();
@@ -1282,8 +1422,12 @@ void Node::visit(Renderer* renderer, const Mat4& parentTransform, uint32_t paren
     // IMPORTANT:
     // To ease the migration to v3.0, we still support the Mat4 stack,
     // but it is deprecated and your code should not rely on it
-    _director->pushMatrix(MATRIX_STACK_TYPE::MATRIX_STACK_MODELVIEW);
-    _director->loadMatrix(MATRIX_STACK_TYPE::MATRIX_STACK_MODELVIEW, _modelViewTransform);
+    const bool syncMatrixStack = s_matrixStackSyncEnabled;
+    if (syncMatrixStack)
+    {
+        _director->pushMatrix(MATRIX_STACK_TYPE::MATRIX_STACK_MODELVIEW);
+        _director->loadMatrix(MATRIX_STACK_TYPE::MATRIX_STACK_MODELVIEW, _modelViewTransform);
+    }
 
     bool visibleByCamera = isVisitableByVisitingCamera();
 
@@ -1314,7 +1458,8 @@ void Node::visit(Renderer* renderer, const Mat4& parentTransform, uint32_t paren
         this->draw(renderer, _modelViewTransform, flags);
     }
 
-    _director->popMatrix(MATRIX_STACK_TYPE::MATRIX_STACK_MODELVIEW);
+    if (syncMatrixStack)
+        _director->popMatrix(MATRIX_STACK_TYPE::MATRIX_STACK_MODELVIEW);
 
     // FIX ME: Why need to set _orderOfArrival to 0??
     // Please refer to https://github.com/cocos2d/cocos2d-x/pull/6920
@@ -1324,7 +1469,15 @@ void Node::visit(Renderer* renderer, const Mat4& parentTransform, uint32_t paren
 
 Mat4 Node::transform(const Mat4& parentTransform)
 {
-    return parentTransform * this->getNodeToParentTransform();
+    auto& localTransform = this->getNodeToParentTransform();
+
+    // most nodes only move, rotate, scale or skew in the XY plane, their 2x3 affine part is enough
+    Mat4 ret;
+    if (localTransform.isAffine2D())
+        Mat4::multiplyAffine2D(parentTransform, localTransform, &ret);
+    else
+        Mat4::multiply(parentTransform, localTransform, &ret);
+    return ret;
 }
 
 // MARK: events
@@ -1404,6 +1557,8 @@ void Node::onExit()
 
     _running = false;
 
+    invalidateRenderBounds();
+
     for (const auto& child : _children)
         child->onExit();
 
@@ -1803,6 +1958,7 @@ void Node::setNodeToParentTransform(const Mat4& transform)
     _transform        = transform;
     _transformDirty   = false;
     _transformUpdated = true;
+    _director->markSceneChanged();
 
     if (_additionalTransform)
         // _additionalTransform[1] has a copy of lastest transform
@@ -2027,6 +2183,7 @@ void Node::setOpacity(uint8_t opacity)
 void Node::updateDisplayedOpacity(uint8_t parentOpacity)
 {
     _displayedOpacity = _realOpacity * parentOpacity / 255.0;
+    setRenderDirty();
     updateColor();
 
     if (_cascadeOpacityEnabled)
@@ -2113,6 +2270,7 @@ void Node::updateDisplayedColor(const Color3B& parentColor)
     _displayedColor.r = _realColor.r * parentColor.r / 255.0;
     _displayedColor.g = _realColor.g * parentColor.g / 255.0;
     _displayedColor.b = _realColor.b * parentColor.b / 255.0;
+    setRenderDirty();
     updateColor();
 
     if (_cascadeColorEnabled)
@@ -143,6 +143,14 @@ public:
      */
     static int getAttachedNodeCount();
 
+    /**
+     * Sets whether Node::visit() mirrors each node's model view transform onto the deprecated
+     * Director MATRIX_STACK_MODELVIEW stack. Enabled by default for legacy code that reads
+     * Director::getMatrix() while drawing, disable it to skip the per-node push/load/pop.
+     */
+    static void setMatrixStackSyncEnabled(bool enabled) { s_matrixStackSyncEnabled = enabled; }
+    static bool isMatrixStackSyncEnabled() { return s_matrixStackSyncEnabled; }
+
 public:
     /**
      * Gets the description string. It makes debugging easier.
@@ -1142,6 +1150,27 @@ public:
     virtual void visit(Renderer* renderer, const Mat4& parentTransform, uint32_t parentFlags);
     virtual void visit();
 
+    /**
+     * Computes the model view transform of this node and its visible descendants ahead of visit().
+     * The children of nodes with at least parallelThreshold children are walked in chunks on the
+     * JobSystem workers. visit() then reuses the prepared transforms and flags of this frame, the
+     * draw order is unaffected. A node moved after the pass, or visited with another parent transform
+     * than the pass used, is recomputed as usual.
+     *
+     * @param parentTransform A transform matrix.
+     * @param parentFlags Renderer flag.
+     * @param parallelThreshold Minimum number of children to split across workers, 0 to stay on this thread.
+     */
+    void prepareTransforms(const Mat4& parentTransform, uint32_t parentFlags, size_t parallelThreshold = 512);
+
+    /**
+     * Tells the dirty region redraw mode that what this node draws changed without its transform, content
+     * size or color changing, e.g. a new texture. Nodes drawing outside their content size should call
+     * Director::markFullRedraw() instead.
+     * @see Director::setDirtyRegionRedrawEnabled()
+     */
+    void setRenderDirty();
+
     /** Returns the Scene that contains the Node.
      It returns `nullptr` if the node doesn't belong to any Scene.
      This function recursively calls parent->getScene() until parent is a Scene object. The results are not cached. It
@@ -1878,6 +1907,11 @@ protected:
 
     Mat4 transform(const Mat4& parentTransform);
     uint32_t processParentFlags(const Mat4& parentTransform, uint32_t parentFlags);
+    bool isPreparedTransformStale(const Mat4& parentTransform, uint32_t parentFlags) const;
+    void updateNormalizedPosition(uint32_t parentFlags);
+    void markTransformDirty();
+    void updateRenderBounds(uint32_t flags);
+    void invalidateRenderBounds();
 
     virtual void updateCascadeOpacity();
     virtual void disableCascadeOpacity();
@@ -1931,7 +1965,8 @@ protected:
 
     Vec2 _contentSize;  ///< untransformed size of the node
 
-    Mat4 _modelViewTransform;  ///< ModelView transform of the Node.
+    Mat4 _modelViewTransform;       ///< ModelView transform of the Node.
+    Mat4 _preparedParentTransform;  ///< parent transform prepareTransforms() last computed it from
     // "cache" variables are allowed to be mutable
     mutable Mat4 _transform;             ///< transform
     mutable Mat4 _inverse;               ///< inverse transform
@@ -1962,6 +1997,7 @@ protected:
     float _globalZOrder;  ///< Global order used to sort the node
 
     static std::uint32_t s_globalOrderOfArrival;
+    static bool s_matrixStackSyncEnabled;
 
     Vector<Node*> _children;             ///< array of children nodes
     NodeIndexerMap_t* _childrenIndexer;  ///< The children indexer for fast find child
@@ -1996,6 +2032,10 @@ protected:
     mutable bool _inverseDirty;              ///< inverse transform dirty flag
     mutable bool _additionalTransformDirty;  ///< transform dirty ?
     bool _transformUpdated;                  ///< Whether or not the Transform object was updated since the last frame
+    uint32_t _preparedFlags;                 ///< flags computed by prepareTransforms(), consumed by the next visit
+    unsigned int _preparedFrame;             ///< 1 + the frame prepareTransforms() ran in, 0 once consumed
+    bool _renderDirty;                       ///< what the node draws changed, for the dirty region redraw mode
+    Rect _renderBounds;                      ///< world bounds last reported to the dirty region redraw mode
 
     bool _usingNormalizedPosition;
     bool _normalizedPositionDirty;
@@ -186,6 +186,9 @@ void Scene::render(Renderer* renderer, const Mat4& eyeTransform, const Mat4* eye
     Camera* defaultCamera = nullptr;
     const auto& transform = getNodeToParentTransform();
 
+    if (_parallelTransformThreshold != 0)
+        prepareTransforms(transform, 0, _parallelTransformThreshold);
+
     for (const auto& camera : getCameras())
     {
         if (!camera->isVisible())
@@ -223,6 +226,8 @@ void Scene::render(Renderer* renderer, const Mat4& eyeTransform, const Mat4* eye
             _navMesh->debugDraw(renderer);
         }
 #endif
+        // in dirty region redraw mode this camera renders into the cache, or not at all
+        _director->beginDirtyRegionRedraw();
 
         renderer->render();
 
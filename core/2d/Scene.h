@@ -119,6 +119,15 @@ public:
     void visit(Renderer* renderer, const Mat4& parentTransform, uint32_t parentFlags) override;
     void visit() override;
 
+    /** Sets the minimum number of children a node needs before render() propagates the transforms of
+     * its children on the JobSystem workers. Transforms are computed in a separate pass before the
+     * cameras visit the scene, draw order is unaffected. 0 (the default) keeps transform updates
+     * inside visit(). Only enable it when every node's getNodeToParentTransform() is thread safe.
+     * @js NA
+     */
+    void setParallelTransformThreshold(size_t threshold) { _parallelTransformThreshold = threshold; }
+    size_t getParallelTransformThreshold() const { return _parallelTransformThreshold; }
+
     /** override function */
     virtual void removeAllChildren() override;
 
@@ -154,6 +163,8 @@ protected:
 
     std::vector<BaseLight*> _lights;
 
+    size_t _parallelTransformThreshold = 0;
+
 private:
     AX_DISALLOW_COPY_AND_ASSIGN(Scene);
 
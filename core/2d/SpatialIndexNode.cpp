@@ -0,0 +1,389 @@
+/****************************************************************************
+ Copyright (c) 2019-present Axmol Engine contributors (see AUTHORS.md).
+
+ https://axmol.dev/
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ ****************************************************************************/
+
+#include "2d/SpatialIndexNode.h"
+#include "2d/Camera.h"
+#include "base/Director.h"
+#include "renderer/Renderer.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+namespace ax
+{
+
+// a child covering more cells than this is kept out of the grid and tested on every visit
+static const int MAX_CELLS_PER_ENTRY = 64;
+
+SpatialIndexNode* SpatialIndexNode::create(float cellSize)
+{
+    auto ret = new SpatialIndexNode();
+    if (ret->initWithCellSize(cellSize))
+    {
+        ret->autorelease();
+        return ret;
+    }
+    AX_SAFE_DELETE(ret);
+    return nullptr;
+}
+
+SpatialIndexNode::SpatialIndexNode()
+    : _cellSize(256.0f), _cullingMargin(0.0f), _cullingEnabled(true), _indexDirty(true), _queryStamp(0)
+{}
+
+SpatialIndexNode::~SpatialIndexNode() {}
+
+bool SpatialIndexNode::initWithCellSize(float cellSize)
+{
+    if (!Node::init())
+        return false;
+
+    setCellSize(cellSize);
+    return true;
+}
+
+void SpatialIndexNode::setCellSize(float cellSize)
+{
+    AXASSERT(cellSize > 0, "cell size must be positive");
+    _cellSize   = cellSize;
+    _indexDirty = true;
+}
+
+void SpatialIndexNode::addChild(Node* child, int zOrder, int tag)
+{
+    Node::addChild(child, zOrder, tag);
+    _indexDirty = true;
+}
+
+void SpatialIndexNode::addChild(Node* child, int zOrder, std::string_view name)
+{
+    Node::addChild(child, zOrder, name);
+    _indexDirty = true;
+}
+
+void SpatialIndexNode::removeChild(Node* child, bool cleanup)
+{
+    Node::removeChild(child, cleanup);
+    _indexDirty = true;
+}
+
+void SpatialIndexNode::removeAllChildrenWithCleanup(bool cleanup)
+{
+    Node::removeAllChildrenWithCleanup(cleanup);
+    _indexDirty = true;
+}
+
+void SpatialIndexNode::rebuildIndex()
+{
+    // pending flags are lost with the entries, so every child gets a full transform update once
+    _cells.clear();
+    _oversizedEntries.clear();
+    _entries.clear();
+    _entries.resize(_children.size());
+    for (uint32_t i = 0, count = static_cast<uint32_t>(_children.size()); i < count; ++i)
+    {
+        auto& entry        = _entries[i];
+        entry.node         = _children.at(i);
+        entry.pendingFlags = FLAGS_DIRTY_MASK;
+        refreshEntry(entry, true);
+        insertEntry(i);
+    }
+    _indexDirty = false;
+}
+
+bool SpatialIndexNode::refreshEntry(Entry& entry, bool force)
+{
+    auto child             = entry.node;
+    const auto& transform  = child->getNodeToParentTransform();
+    const auto& size       = child->getContentSize();
+    const float current[6] = {transform.m[0], transform.m[1], transform.m[4],
+                              transform.m[5], transform.m[12], transform.m[13]};
+    if (!force && size.equals(entry.contentSize) && memcmp(current, entry.transform, sizeof(current)) == 0)
+        return false;
+
+    memcpy(entry.transform, current, sizeof(current));
+    entry.contentSize = size;
+    entry.bounds      = RectApplyTransform(Rect(0, 0, size.width, size.height), transform);
+
+    const int minX = static_cast<int>(std::floor(entry.bounds.getMinX() / _cellSize));
+    const int minY = static_cast<int>(std::floor(entry.bounds.getMinY() / _cellSize));
+    const int maxX = static_cast<int>(std::floor(entry.bounds.getMaxX() / _cellSize));
+    const int maxY = static_cast<int>(std::floor(entry.bounds.getMaxY() / _cellSize));
+    const bool oversized =
+        static_cast<int64_t>(maxX - minX + 1) * static_cast<int64_t>(maxY - minY + 1) > MAX_CELLS_PER_ENTRY;
+    if (!force && oversized == entry.oversized &&
+        (oversized || (minX == entry.cellMinX && minY == entry.cellMinY && maxX == entry.cellMaxX &&
+                       maxY == entry.cellMaxY)))
+        return false;
+
+    entry.cellMinX  = minX;
+    entry.cellMinY  = minY;
+    entry.cellMaxX  = maxX;
+    entry.cellMaxY  = maxY;
+    entry.oversized = oversized;
+    return true;
+}
+
+void SpatialIndexNode::insertEntry(uint32_t index)
+{
+    const auto& entry = _entries[index];
+    if (entry.oversized)
+    {
+        _oversizedEntries.emplace_back(index);
+        return;
+    }
+    for (int y = entry.cellMinY; y <= entry.cellMaxY; ++y)
+        for (int x = entry.cellMinX; x <= entry.cellMaxX; ++x)
+            _cells[cellKey(x, y)].emplace_back(index);
+}
+
+void SpatialIndexNode::removeEntry(uint32_t index)
+{
+    auto eraseFrom = [index](std::vector<uint32_t>& list) {
+        auto it = std::find(list.begin(), list.end(), index);
+        if (it != list.end())
+        {
+            *it = list.back();
+            list.pop_back();
+        }
+    };
+
+    const auto& entry = _entries[index];
+    if (entry.oversized)
+    {
+        eraseFrom(_oversizedEntries);
+        return;
+    }
+    for (int y = entry.cellMinY; y <= entry.cellMaxY; ++y)
+    {
+        for (int x = entry.cellMinX; x <= entry.cellMaxX; ++x)
+        {
+            auto it = _cells.find(cellKey(x, y));
+            if (it == _cells.end())
+                continue;
+            eraseFrom(it->second);
+            if (it->second.empty())
+                _cells.erase(it);
+        }
+    }
+}
+
+bool SpatialIndexNode::computeVisibleRect(Rect& rect) const
+{
+    // like Renderer::checkVisibility, only the default camera is culled
+    auto camera = Camera::getVisitingCamera();
+    if (!camera || camera != Camera::getDefaultCamera())
+        return false;
+
+    // cast the corners of the visible area through the frustum and intersect them with the z = 0 plane
+    // of this node, their bounding box is what the screen covers in this node's space
+    const Mat4 clipToLocal   = _modelViewTransform.getInversed() * camera->getViewProjectionMatrix().getInversed();
+    const auto& winSize      = _director->getWinSize();
+    const auto visibleOrigin = _director->getVisibleOrigin();
+    const auto visibleSize   = _director->getVisibleSize();
+
+    float minX = FLT_MAX, minY = FLT_MAX, maxX = -FLT_MAX, maxY = -FLT_MAX;
+    for (int i = 0; i < 4; ++i)
+    {
+        const float x = ((visibleOrigin.x + ((i & 1) ? visibleSize.width : 0)) / winSize.width) * 2.0f - 1.0f;
+        const float y = ((visibleOrigin.y + ((i & 2) ? visibleSize.height : 0)) / winSize.height) * 2.0f - 1.0f;
+
+        Vec4 nearPoint(x, y, -1.0f, 1.0f), farPoint(x, y, 1.0f, 1.0f);
+        clipToLocal.transformVector(&nearPoint);
+        clipToLocal.transformVector(&farPoint);
+        if (nearPoint.w == 0.0f || farPoint.w == 0.0f)
+            return false;
+
+        const Vec3 a(nearPoint.x / nearPoint.w, nearPoint.y / nearPoint.w, nearPoint.z / nearPoint.w);
+        const Vec3 b(farPoint.x / farPoint.w, farPoint.y / farPoint.w, farPoint.z / farPoint.w);
+        const float dz = b.z - a.z;
+        if (std::abs(dz) < FLT_EPSILON)
+            return false;
+
+        // the plane is seen edge-on or lies outside of the depth range, don't cull anything
+        const float t = -a.z / dz;
+        if (t < 0.0f || t > 1.0f)
+            return false;
+
+        const float px = a.x + (b.x - a.x) * t;
+        const float py = a.y + (b.y - a.y) * t;
+        minX           = std::min(minX, px);
+        minY           = std::min(minY, py);
+        maxX           = std::max(maxX, px);
+        maxY           = std::max(maxY, py);
+    }
+
+    rect.setRect(minX - _cullingMargin, minY - _cullingMargin, maxX - minX + _cullingMargin * 2,
+                 maxY - minY + _cullingMargin * 2);
+    return true;
+}
+
+void SpatialIndexNode::collectVisibleEntries(const Rect& visibleRect)
+{
+    // every entry is collected at most once per query even if it spans several visible cells
+    if (++_queryStamp == 0)
+    {
+        for (auto& entry : _entries)
+            entry.stamp = 0;
+        _queryStamp = 1;
+    }
+
+    auto collect = [this, &visibleRect](uint32_t index) {
+        auto& entry = _entries[index];
+        if (entry.stamp == _queryStamp)
+            return;
+        entry.stamp = _queryStamp;
+        ++_stats.tested;
+        if (entry.bounds.intersectsRect(visibleRect))
+            _visibleEntries.emplace_back(index);
+    };
+
+    const int minX = static_cast<int>(std::floor(visibleRect.getMinX() / _cellSize));
+    const int minY = static_cast<int>(std::floor(visibleRect.getMinY() / _cellSize));
+    const int maxX = static_cast<int>(std::floor(visibleRect.getMaxX() / _cellSize));
+    const int maxY = static_cast<int>(std::floor(visibleRect.getMaxY() / _cellSize));
+
+    // zoomed far out, walking the occupied cells is cheaper than probing every cell in range
+    const int64_t cellsInRange = static_cast<int64_t>(maxX - minX + 1) * static_cast<int64_t>(maxY - minY + 1);
+    if (cellsInRange > static_cast<int64_t>(_cells.size()))
+    {
+        for (auto& [key, indices] : _cells)
+        {
+            const int x = static_cast<int>(static_cast<uint32_t>(key >> 32));
+            const int y = static_cast<int>(static_cast<uint32_t>(key));
+            if (x < minX || x > maxX || y < minY || y > maxY)
+                continue;
+            ++_stats.cellsQueried;
+            for (auto index : indices)
+                collect(index);
+        }
+    }
+    else
+    {
+        for (int y = minY; y <= maxY; ++y)
+        {
+            for (int x = minX; x <= maxX; ++x)
+            {
+                auto it = _cells.find(cellKey(x, y));
+                if (it == _cells.end())
+                    continue;
+                ++_stats.cellsQueried;
+                for (auto index : it->second)
+                    collect(index);
+            }
+        }
+    }
+
+    for (auto index : _oversizedEntries)
+        collect(index);
+
+    // entries follow the sorted children, so ascending indices keep the draw order
+    std::sort(_visibleEntries.begin(), _visibleEntries.end());
+}
+
+void SpatialIndexNode::visit(Renderer* renderer, const Mat4& parentTransform, uint32_t parentFlags)
+{
+    // quick return if not visible. children won't be drawn.
+    if (!_visible)
+    {
+        return;
+    }
+
+    uint32_t flags = processParentFlags(parentTransform, parentFlags);
+
+    // IMPORTANT:
+    // To ease the migration to v3.0, we still support the Mat4 stack,
+    // but it is deprecated and your code should not rely on it
+    const bool syncMatrixStack = s_matrixStackSyncEnabled;
+    if (syncMatrixStack)
+    {
+        _director->pushMatrix(MATRIX_STACK_TYPE::MATRIX_STACK_MODELVIEW);
+        _director->loadMatrix(MATRIX_STACK_TYPE::MATRIX_STACK_MODELVIEW, _modelViewTransform);
+    }
+
+    if (_reorderChildDirty)
+    {
+        sortAllChildren();
+        _indexDirty = true;
+    }
+    if (_indexDirty)
+        rebuildIndex();
+
+    _stats               = CullingStats{};
+    _stats.totalChildren = static_cast<unsigned int>(_entries.size());
+
+    // follow the children that moved, culled children also remember the flags they missed
+    for (uint32_t i = 0, count = static_cast<uint32_t>(_entries.size()); i < count; ++i)
+    {
+        auto& entry = _entries[i];
+        entry.pendingFlags |= flags;
+        if (refreshEntry(entry, false))
+        {
+            ++_stats.reindexed;
+            removeEntry(i);
+            insertEntry(i);
+        }
+    }
+
+    _visibleEntries.clear();
+    Rect visibleRect;
+    if (_cullingEnabled && computeVisibleRect(visibleRect))
+    {
+        collectVisibleEntries(visibleRect);
+    }
+    else
+    {
+        for (uint32_t i = 0, count = static_cast<uint32_t>(_entries.size()); i < count; ++i)
+            _visibleEntries.emplace_back(i);
+    }
+    _stats.culled = _stats.totalChildren - static_cast<unsigned int>(_visibleEntries.size());
+
+    auto visitEntry = [this, renderer](Entry& entry) {
+        const uint32_t entryFlags = entry.pendingFlags;
+        entry.pendingFlags        = 0;
+        entry.node->visit(renderer, _modelViewTransform, entryFlags);
+    };
+
+    size_t i = 0;
+    // draw children zOrder < 0
+    for (auto count = _visibleEntries.size(); i < count; ++i)
+    {
+        auto& entry = _entries[_visibleEntries[i]];
+        if (entry.node->getLocalZOrder() >= 0)
+            break;
+        visitEntry(entry);
+    }
+    // self draw
+    if (isVisitableByVisitingCamera())
+        this->draw(renderer, _modelViewTransform, flags);
+
+    for (auto count = _visibleEntries.size(); i < count; ++i)
+        visitEntry(_entries[_visibleEntries[i]]);
+
+    if (syncMatrixStack)
+        _director->popMatrix(MATRIX_STACK_TYPE::MATRIX_STACK_MODELVIEW);
+}
+
+}  // namespace ax
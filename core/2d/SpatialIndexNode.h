@@ -0,0 +1,147 @@
+/****************************************************************************
+ Copyright (c) 2019-present Axmol Engine contributors (see AUTHORS.md).
+
+ https://axmol.dev/
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ ****************************************************************************/
+#pragma once
+
+#include "2d/Node.h"
+
+#include <unordered_map>
+#include <vector>
+
+namespace ax
+{
+
+/**
+ * @addtogroup _2d
+ * @{
+ */
+
+/** @class SpatialIndexNode
+ * @brief A container that indexes its children in a uniform grid and only visits the ones near the screen.
+
+Each child is bucketed by its bounding box in this node's space. The index follows the children as
+they move, resize or get added and removed. When the default camera visits, the screen rectangle is
+mapped back into this node's space, and only children in the overlapping cells are visited. The
+rest are skipped together with their subtrees. This suits large scrolling worlds made of many
+sprites or tiles.
+
+A child is only tested by its own bounding box. If its descendants draw outside of it, use
+setCullingMargin() to enlarge the tested area.
+*/
+class AX_DLL SpatialIndexNode : public Node
+{
+public:
+    /** Counters of the last visit. */
+    struct CullingStats
+    {
+        unsigned int totalChildren = 0;  ///< children in the index
+        unsigned int cellsQueried  = 0;  ///< grid cells overlapping the visible rectangle
+        unsigned int tested        = 0;  ///< children whose bounds were tested against the visible rectangle
+        unsigned int culled        = 0;  ///< children skipped together with their subtrees
+        unsigned int reindexed     = 0;  ///< children moved to other cells since the previous visit
+    };
+
+    /** Creates a SpatialIndexNode.
+     *
+     * @param cellSize Width and height of a grid cell in this node's space.
+     * @return An autoreleased SpatialIndexNode object.
+     */
+    static SpatialIndexNode* create(float cellSize = 256.0f);
+
+    /** Sets the width and height of a grid cell, the whole index is rebuilt on the next visit. */
+    void setCellSize(float cellSize);
+    float getCellSize() const { return _cellSize; }
+
+    /** Sets how far outside the visible rectangle a child's bounds may be while still being visited. */
+    void setCullingMargin(float margin) { _cullingMargin = margin; }
+    float getCullingMargin() const { return _cullingMargin; }
+
+    /** Enables or disables culling, disabled means every child is visited like a plain Node does. */
+    void setCullingEnabled(bool enabled) { _cullingEnabled = enabled; }
+    bool isCullingEnabled() const { return _cullingEnabled; }
+
+    /** Returns the counters of the last visit. */
+    const CullingStats& getCullingStats() const { return _stats; }
+
+    // prevents compiler warning: "Included function hides overloaded virtual functions"
+    using Node::addChild;
+
+    //
+    // Overrides
+    //
+    virtual void addChild(Node* child, int zOrder, int tag) override;
+    virtual void addChild(Node* child, int zOrder, std::string_view name) override;
+    virtual void removeChild(Node* child, bool cleanup) override;
+    virtual void removeAllChildrenWithCleanup(bool cleanup) override;
+    virtual void visit(Renderer* renderer, const Mat4& parentTransform, uint32_t parentFlags) override;
+
+    SpatialIndexNode();
+    virtual ~SpatialIndexNode();
+
+    bool initWithCellSize(float cellSize);
+
+protected:
+    struct Entry
+    {
+        Node* node = nullptr;
+        float transform[6]{};  ///< m[0], m[1], m[4], m[5], m[12], m[13] the bounds were computed from
+        Vec2 contentSize;
+        Rect bounds;
+        int cellMinX = 0, cellMinY = 0, cellMaxX = -1, cellMaxY = -1;
+        bool oversized        = false;  ///< spans too many cells, tested on every visit instead
+        uint32_t pendingFlags = 0;      ///< flags accumulated while the child was culled
+        unsigned int stamp    = 0;      ///< last query that collected this entry
+    };
+
+    void rebuildIndex();
+    bool refreshEntry(Entry& entry, bool force);
+    void insertEntry(uint32_t index);
+    void removeEntry(uint32_t index);
+    void collectVisibleEntries(const Rect& visibleRect);
+    bool computeVisibleRect(Rect& rect) const;
+
+    static uint64_t cellKey(int x, int y)
+    {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(y);
+    }
+
+    float _cellSize;
+    float _cullingMargin;
+    bool _cullingEnabled;
+    bool _indexDirty;
+    unsigned int _queryStamp;
+
+    std::vector<Entry> _entries;                                  ///< parallel to _children
+    std::unordered_map<uint64_t, std::vector<uint32_t>> _cells;  ///< entry indices per occupied cell
+    std::vector<uint32_t> _oversizedEntries;
+    std::vector<uint32_t> _visibleEntries;
+    CullingStats _stats;
+
+private:
+    AX_DISALLOW_COPY_AND_ASSIGN(SpatialIndexNode);
+};
+
+// end of _2d group
+/// @}
+
+}  // namespace ax
@@ -429,6 +429,7 @@ void Sprite::setTexture(Texture2D* texture)
             AX_SAFE_RETAIN(texture);
             AX_SAFE_RELEASE(_texture);
             _texture = texture;
+            setRenderDirty();
         }
         updateBlendFunc();
     }
@@ -458,6 +459,7 @@ void Sprite::setTextureRect(const Rect& rect, bool rotated, const Vec2& untrimme
         Node::setContentSize(untrimmedSize);
     }
     _originalContentSize = untrimmedSize;
+    setRenderDirty();
 
     setVertexRect(rect);
     updateStretchFactor();
@@ -1432,6 +1434,7 @@ void Sprite::setFlippedX(bool flippedX)
     if (_flippedX != flippedX)
     {
         _flippedX = flippedX;
+        setRenderDirty();
         flipX();
     }
 }
@@ -1450,6 +1453,7 @@ void Sprite::setFlippedY(bool flippedY)
     if (_flippedY != flippedY)
     {
         _flippedY = flippedY;
+        setRenderDirty();
         flipY();
     }
 }
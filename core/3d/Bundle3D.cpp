@@ -31,6 +31,7 @@ THE SOFTWARE.
 #include "platform/FileUtils.h"
 #include "3d/BundleReader.h"
 #include "base/Data.h"
+#include "mio/mio.hpp"
 
 #define BUNDLE_TYPE_SCENE 1
 #define BUNDLE_TYPE_NODE 2
@@ -162,6 +163,7 @@ void Bundle3D::clear()
     if (_isBinary)
     {
         _binaryBuffer.clear();
+        _mappedFile.reset();
         AX_SAFE_DELETE_ARRAY(_references);
     }
     else
@@ -400,7 +402,10 @@ bool Bundle3D::loadMeshDatasBinary(MeshDatas& meshdatas)
         AXLOGW("warning: Failed to read meshdata: attribCount '{}'.", _path);
         return false;
     }
-    MeshData* meshData = nullptr;
+    // older versions don't store the sub mesh aabb, it's calculated from the copied data instead
+    const bool hasMeshAABB = _version != "0.3" && _version != "0.4" && _version != "0.5";
+    const bool zeroCopy    = _zeroCopyMeshData && _mappedFile && hasMeshAABB;
+    MeshData* meshData     = nullptr;
     for (unsigned int i = 0; i < meshSize; ++i)
     {
         unsigned int attribSize = 0;
@@ -435,11 +440,25 @@ bool Bundle3D::loadMeshDatasBinary(MeshDatas& meshdatas)
             goto FAILED;
         }
 
-        meshData->vertex.resize(vertexSizeInFloat);
-        if (_binaryReader.read(&meshData->vertex[0], 4, vertexSizeInFloat) != vertexSizeInFloat)
+        if (zeroCopy)
         {
-            AXLOGW("warning: Failed to read meshdata: vertex element '{}'.", _path);
-            goto FAILED;
+            auto vertexBytes = _binaryReader.readView(4, vertexSizeInFloat);
+            if (!vertexBytes)
+            {
+                AXLOGW("warning: Failed to read meshdata: vertex element '{}'.", _path);
+                goto FAILED;
+            }
+            meshData->mappedSource = _mappedFile;
+            meshData->vertexView   = {reinterpret_cast<const uint8_t*>(vertexBytes), vertexSizeInFloat * 4u};
+        }
+        else
+        {
+            meshData->vertex.resize(vertexSizeInFloat);
+            if (_binaryReader.read(&meshData->vertex[0], 4, vertexSizeInFloat) != vertexSizeInFloat)
+            {
+                AXLOGW("warning: Failed to read meshdata: vertex element '{}'.", _path);
+                goto FAILED;
+            }
         }
 
         // Read index data
@@ -457,17 +476,32 @@ bool Bundle3D::loadMeshDatasBinary(MeshDatas& meshdatas)
                 AXLOGW("warning: Failed to read meshdata: nIndexCount '{}'.", _path);
                 goto FAILED;
             }
-            indexArray.resize(nIndexCount);
-            if (_binaryReader.read(indexArray.data(), 2, nIndexCount) != nIndexCount)
+            if (zeroCopy)
             {
-                AXLOGW("warning: Failed to read meshdata: indices '{}'.", _path);
-                goto FAILED;
+                auto indexBytes = _binaryReader.readView(2, nIndexCount);
+                if (!indexBytes)
+                {
+                    AXLOGW("warning: Failed to read meshdata: indices '{}'.", _path);
+                    goto FAILED;
+                }
+                meshData->subMeshIndexViews.emplace_back(reinterpret_cast<const uint8_t*>(indexBytes),
+                                                         nIndexCount * 2u);
+                meshData->numIndex = (int)meshData->subMeshIndexViews.size();
+            }
+            else
+            {
+                indexArray.resize(nIndexCount);
+                if (_binaryReader.read(indexArray.data(), 2, nIndexCount) != nIndexCount)
+                {
+                    AXLOGW("warning: Failed to read meshdata: indices '{}'.", _path);
+                    goto FAILED;
+                }
+                meshData->subMeshIndices.emplace_back(std::move(indexArray));
+                meshData->numIndex = (int)meshData->subMeshIndices.size();
             }
-            auto& storedIndices = meshData->subMeshIndices.emplace_back(std::move(indexArray));
-            meshData->numIndex = (int)meshData->subMeshIndices.size();
             // meshData->subMeshAABB.emplace_back(calculateAABB(meshData->vertex, meshData->getPerVertexSize(),
             // indexArray));
-            if (_version != "0.3" && _version != "0.4" && _version != "0.5")
+            if (hasMeshAABB)
             {
                 // read mesh aabb
                 float aabb[6];
@@ -481,7 +515,7 @@ bool Bundle3D::loadMeshDatasBinary(MeshDatas& meshdatas)
             else
             {
                 meshData->subMeshAABB.emplace_back(
-                    calculateAABB(meshData->vertex, meshData->getPerVertexSize(), storedIndices));
+                    calculateAABB(meshData->vertex, meshData->getPerVertexSize(), meshData->subMeshIndices.back()));
             }
         }
         meshdatas.meshDatas.emplace_back(meshData);
@@ -1088,18 +1122,38 @@ bool Bundle3D::loadBinary(std::string_view path)
 {
     clear();
 
-    // get file data
-    _binaryBuffer.clear();
-    _binaryBuffer = FileUtils::getInstance()->getDataFromFile(path);
-    if (_binaryBuffer.isNull())
+    // map the file when it lives on the native file system, the mapping stays shared with zero-copy mesh datas
+    auto fileStream = FileUtils::getInstance()->openFileStream(path, IFileStream::Mode::READ);
+    if (fileStream && fileStream->nativeHandle() != (osfhnd_t)-1 && fileStream->size() > 0)
     {
-        clear();
-        AXLOGW("warning: Failed to read file: {}", path);
-        return false;
+        std::error_code error;
+        auto mapping = std::make_shared<mio::mmap_source>();
+        mapping->map(fileStream->nativeHandle(), 0, mio::map_entire_file, error);
+        if (!error && mapping->is_mapped())
+            _mappedFile = mapping;
     }
+    fileStream.reset();
 
     // Initialise bundle reader
-    _binaryReader.init((char*)_binaryBuffer.getBytes(), _binaryBuffer.getSize());
+    if (_mappedFile)
+    {
+        auto mapping = std::static_pointer_cast<const mio::mmap_source>(_mappedFile);
+        _binaryReader.init(const_cast<char*>(mapping->data()), static_cast<ssize_t>(mapping->size()));
+    }
+    else
+    {
+        // get file data
+        _binaryBuffer.clear();
+        _binaryBuffer = FileUtils::getInstance()->getDataFromFile(path);
+        if (_binaryBuffer.isNull())
+        {
+            clear();
+            AXLOGW("warning: Failed to read file: {}", path);
+            return false;
+        }
+
+        _binaryReader.init((char*)_binaryBuffer.getBytes(), _binaryBuffer.getSize());
+    }
 
     // Read identifier info
     char identifier[] = {'C', '3', 'B', '\0'};
@@ -83,6 +83,15 @@ public:
      */
     virtual bool load(std::string_view path);
 
+    /**
+     * Enable zero-copy mesh data for c3b files that can be memory-mapped.
+     * When enabled, loadMeshDatas() fills MeshData::vertexView and MeshData::subMeshIndexViews with views into the
+     * mapped file instead of copying into MeshData::vertex and MeshData::subMeshIndices. Each MeshData keeps the
+     * mapping alive, so the bundle can be destroyed before the data is uploaded.
+     */
+    void setZeroCopyMeshData(bool enabled) { _zeroCopyMeshData = enabled; }
+    bool isZeroCopyMeshData() const { return _zeroCopyMeshData; }
+
     /**
      * load skin data from bundle
      * @param id The ID of the skin, load the first Skin in the bundle if it is empty
@@ -195,10 +204,12 @@ protected:
 
     // for binary reading
     Data _binaryBuffer;
+    std::shared_ptr<const void> _mappedFile;  // the c3b mapping, used instead of _binaryBuffer when available
     BundleReader _binaryReader;
     unsigned int _referenceCount;
     Reference* _references;
     bool _isBinary;
+    bool _zeroCopyMeshData = false;
 };
 
 // end of 3d group
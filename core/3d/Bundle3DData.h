@@ -37,6 +37,8 @@
 #include <vector>
 #include <map>
 #include <string>
+#include <memory>
+#include <span>
 
 #include "3d/3DProgramInfo.h"
 
@@ -322,6 +324,14 @@ struct MeshData
     std::vector<MeshVertexAttrib> attribs;
     int attribCount;
 
+    /**
+     * Zero-copy payload, filled by Bundle3D instead of vertex/subMeshIndices when a memory-mapped c3b is loaded
+     * with Bundle3D::setZeroCopyMeshData(true). The views point into the mapping owned by mappedSource.
+     */
+    std::shared_ptr<const void> mappedSource;
+    std::span<const uint8_t> vertexView;
+    std::vector<std::span<const uint8_t>> subMeshIndexViews;
+
 public:
     /**
      * Get per vertex size
@@ -337,6 +347,37 @@ public:
         return vertexsize;
     }
 
+    /**
+     * Whether the vertex and index data are views into a mapped file.
+     */
+    bool isMapped() const { return mappedSource != nullptr; }
+
+    /**
+     * Copy the zero-copy views into vertex/subMeshIndices and release the mapping.
+     */
+    void materialize()
+    {
+        if (!isMapped())
+            return;
+
+        vertex.resize(vertexView.size() / sizeof(float));
+        if (!vertex.empty())
+            memcpy(vertex.data(), vertexView.data(), vertex.size() * sizeof(float));
+
+        subMeshIndices.clear();
+        for (auto&& view : subMeshIndexViews)
+        {
+            auto& indices = subMeshIndices.emplace_back(backend::IndexFormat::U_SHORT);
+            indices.bresize(view.size());
+            if (!view.empty())
+                memcpy(indices.data(), view.data(), view.size());
+        }
+
+        vertexView = {};
+        subMeshIndexViews.clear();
+        mappedSource.reset();
+    }
+
     /**
      * Reset the data
      */
@@ -346,6 +387,9 @@ public:
         subMeshIndices.clear();
         subMeshAABB.clear();
         attribs.clear();
+        vertexView = {};
+        subMeshIndexViews.clear();
+        mappedSource.reset();
         vertexSizeInFloat = 0;
         numIndex          = 0;
         attribCount       = 0;
@@ -86,6 +86,20 @@ ssize_t BundleReader::read(void* ptr, ssize_t size, ssize_t count)
     return validCount;
 }
 
+const char* BundleReader::readView(ssize_t size, ssize_t count)
+{
+    ssize_t needLength = size * count;
+    if (!_buffer || needLength < 0 || _length - _position < needLength)
+    {
+        AXLOGW("warning: bundle reader out of range");
+        return nullptr;
+    }
+
+    auto ptr = _buffer + _position;
+    _position += needLength;
+    return ptr;
+}
+
 char* BundleReader::readLine(int num, char* line)
 {
     if (!_buffer)
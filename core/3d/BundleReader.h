@@ -79,6 +79,13 @@ public:
      */
     ssize_t read(void* ptr, ssize_t size, ssize_t count);
 
+    /**
+     * Returns a pointer to the next size * count bytes of the buffer and advances past them, without copying.
+     *
+     * @return The pointer to the elements, or nullptr if the buffer doesn't contain count elements.
+     */
+    const char* readView(ssize_t size, ssize_t count);
+
     /**
      * Reads a line from the buffer.
      */
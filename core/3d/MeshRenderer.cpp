@@ -249,6 +249,8 @@ bool MeshRenderer::loadFromFile(std::string_view path,
     {
         // load from .c3b or .c3t
         auto bundle = Bundle3D::createBundle();
+        // the mesh datas are only used to create the gpu buffers, so they can reference the mapped file
+        bundle->setZeroCopyMeshData(true);
         if (!bundle->load(fullPath))
         {
             Bundle3D::destroyBundle(bundle);
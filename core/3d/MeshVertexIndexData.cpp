@@ -111,9 +111,24 @@ void MeshVertexData::setVertexData(const std::vector<float>& vertexData)
 
 MeshVertexData* MeshVertexData::create(const MeshData& meshdata, CustomCommand::IndexFormat format)
 {
+#if AX_ENABLE_CACHE_TEXTURE_DATA
+    if (meshdata.isMapped())
+    {
+        // the data is stored for recreating the buffers, so zero-copy views must be copied here anyway
+        MeshData owned = meshdata;
+        owned.materialize();
+        return create(owned, format);
+    }
+#endif
+
+    // zero-copy mesh datas are uploaded straight from the mapped file
+    const bool mapped = meshdata.isMapped();
+    const void* vertexBytes   = mapped ? (const void*)meshdata.vertexView.data() : (const void*)meshdata.vertex.data();
+    const size_t vertexLength = mapped ? meshdata.vertexView.size() : meshdata.vertex.size() * sizeof(meshdata.vertex[0]);
+
     auto vertexdata           = new MeshVertexData();
     vertexdata->_vertexBuffer = backend::DriverBase::getInstance()->newBuffer(
-        meshdata.vertex.size() * sizeof(meshdata.vertex[0]), backend::BufferType::VERTEX, backend::BufferUsage::STATIC);
+        vertexLength, backend::BufferType::VERTEX, backend::BufferUsage::STATIC);
     // AX_SAFE_RETAIN(vertexdata->_vertexBuffer);
 
     vertexdata->_sizePerVertex = meshdata.getPerVertexSize();
@@ -126,33 +141,36 @@ MeshVertexData* MeshVertexData::create(const MeshData& meshdata, CustomCommand::
         vertexdata->setVertexData(meshdata.vertex);
         vertexdata->_vertexBuffer->usingDefaultStoredData(false);
 #endif
-        vertexdata->_vertexBuffer->updateData((void*)&meshdata.vertex[0],
-                                              meshdata.vertex.size() * sizeof(meshdata.vertex[0]));
+        vertexdata->_vertexBuffer->updateData(const_cast<void*>(vertexBytes), vertexLength);
     }
 
-    bool needCalcAABB = (meshdata.subMeshAABB.size() != meshdata.subMeshIndices.size());
-    for (size_t i = 0, size = meshdata.subMeshIndices.size(); i < size; ++i)
+    const size_t subMeshCount = mapped ? meshdata.subMeshIndexViews.size() : meshdata.subMeshIndices.size();
+    bool needCalcAABB         = (meshdata.subMeshAABB.size() != subMeshCount);
+    AXASSERT(!(mapped && needCalcAABB), "zero-copy mesh data must provide the sub mesh aabb");
+    for (size_t i = 0; i < subMeshCount; ++i)
     {
-        auto& indices = meshdata.subMeshIndices[i];
-        auto indexBuffer = backend::DriverBase::getInstance()->newBuffer(
-            indices.bsize(), backend::BufferType::INDEX, backend::BufferUsage::STATIC);
+        const void* indexBytes   = mapped ? (const void*)meshdata.subMeshIndexViews[i].data()
+                                          : (const void*)meshdata.subMeshIndices[i].data();
+        const size_t indexLength = mapped ? meshdata.subMeshIndexViews[i].size() : meshdata.subMeshIndices[i].bsize();
+        auto indexBuffer         = backend::DriverBase::getInstance()->newBuffer(
+            indexLength, backend::BufferType::INDEX, backend::BufferUsage::STATIC);
         indexBuffer->autorelease();
 #if AX_ENABLE_CACHE_TEXTURE_DATA
         indexBuffer->usingDefaultStoredData(false);
 #endif
-        indexBuffer->updateData((void*)indices.data(), indices.bsize());
+        indexBuffer->updateData(const_cast<void*>(indexBytes), indexLength);
 
         std::string id           = (i < meshdata.subMeshIds.size() ? meshdata.subMeshIds[i] : "");
         MeshIndexData* indexdata = nullptr;
         if (needCalcAABB)
         {
-            auto aabb = Bundle3D::calculateAABB(meshdata.vertex, meshdata.getPerVertexSize(), indices);
+            auto aabb = Bundle3D::calculateAABB(meshdata.vertex, meshdata.getPerVertexSize(), meshdata.subMeshIndices[i]);
             indexdata = MeshIndexData::create(id, vertexdata, indexBuffer, aabb);
         }
         else
             indexdata = MeshIndexData::create(id, vertexdata, indexBuffer, meshdata.subMeshAABB[i]);
 #if AX_ENABLE_CACHE_TEXTURE_DATA
-        indexdata->setIndexData(indices);
+        indexdata->setIndexData(meshdata.subMeshIndices[i]);
 #endif
         vertexdata->_indices.pushBack(indexdata);
     }
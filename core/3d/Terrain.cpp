@@ -181,6 +181,8 @@ void Terrain::draw(ax::Renderer* renderer, const ax::Mat4& transform, uint32_t f
         auto m = camera->getNodeToWorldTransform();
         // set lod
         setChunksLOD(Vec3(m.m[12], m.m[13], m.m[14]));
+        if (isPagingEnabled())
+            updatePaging(Vec3(m.m[12], m.m[13], m.m[14]));
     }
 
     if (_isCameraViewChanged)
@@ -213,17 +215,60 @@ bool Terrain::initHeightMap(std::string_view heightMap)
     {
         int chunk_amount_y = _imageHeight / _chunkSize.height;
         int chunk_amount_x = _imageWidth / _chunkSize.width;
-        loadVertices();
-        calculateNormal();
         memset(_chunkesArray, 0, sizeof(_chunkesArray));
 
-        for (int m = 0; m < chunk_amount_y; m++)
+        if (isPagingEnabled())
         {
-            for (int n = 0; n < chunk_amount_x; n++)
+            // the skirt vertices of a paged chunk follow its (width + 1) * (height + 1) grid vertices
+            int gridX               = static_cast<int>(_chunkSize.width);
+            int gridY               = static_cast<int>(_chunkSize.height);
+            _skirtVerticesOffset[0] = (gridX + 1) * (gridY + 1);
+            _skirtVerticesOffset[1] = _skirtVerticesOffset[0] + gridY + 1;
+            _skirtVerticesOffset[2] = _skirtVerticesOffset[1] + gridX + 1;
+            _skirtVerticesOffset[3] = _skirtVerticesOffset[2] + gridY + 1;
+
+            // the chunks only get their bounding boxes here, vertices are built around the camera by updatePaging
+            _maxHeight = -99999;
+            _minHeight = 99999;
+            for (int i = 0; i < _imageHeight; ++i)
+            {
+                for (int j = 0; j < _imageWidth; j++)
+                {
+                    float height = getImageHeight(j, i);
+                    _maxHeight   = std::max(_maxHeight, height);
+                    _minHeight   = std::min(_minHeight, height);
+                }
+            }
+
+            auto heightField  = getHeightField();
+            float skirtHeight =
+                _crackFixedType == CrackFixedType::SKIRT ? _skirtRatio * _terrainData._mapScale * 8 : 0.0f;
+            for (int m = 0; m < chunk_amount_y; m++)
+            {
+                for (int n = 0; n < chunk_amount_x; n++)
+                {
+                    auto chunk   = new Chunk(this);
+                    chunk->_size = _chunkSize;
+                    chunk->_posY = m;
+                    chunk->_posX = n;
+                    chunk->calculateAABB(heightField, skirtHeight);
+                    _chunkesArray[m][n] = chunk;
+                }
+            }
+        }
+        else
+        {
+            loadVertices();
+            calculateNormal();
+
+            for (int m = 0; m < chunk_amount_y; m++)
             {
-                _chunkesArray[m][n]        = new Chunk(this);
-                _chunkesArray[m][n]->_size = _chunkSize;
-                _chunkesArray[m][n]->generate(_imageWidth, _imageHeight, m, n, _data);
+                for (int n = 0; n < chunk_amount_x; n++)
+                {
+                    _chunkesArray[m][n]        = new Chunk(this);
+                    _chunkesArray[m][n]->_size = _chunkSize;
+                    _chunkesArray[m][n]->generate(_imageWidth, _imageHeight, m, n, _data);
+                }
             }
         }
 
@@ -298,6 +343,161 @@ void Terrain::setChunksLOD(const Vec3& cameraPos)
         }
 }
 
+void Terrain::updatePaging(const Vec3& cameraPos)
+{
+    int chunk_amount_y   = _imageHeight / _chunkSize.height;
+    int chunk_amount_x   = _imageWidth / _chunkSize.width;
+    float unloadDistance = _terrainData._pagingDistance * 1.25f;
+
+    std::vector<std::pair<float, Chunk*>> chunksToLoad;
+    for (int m = 0; m < chunk_amount_y; m++)
+        for (int n = 0; n < chunk_amount_x; n++)
+        {
+            auto chunk  = _chunkesArray[m][n];
+            auto center = chunk->_parent->_worldSpaceAABB.getCenter();
+            float dist  = Vec2(center.x, center.z).distance(Vec2(cameraPos.x, cameraPos.z));
+            if (chunk->_isLoaded)
+            {
+                if (dist > unloadDistance)
+                    chunk->unload();
+            }
+            else if (!chunk->_isLoading && dist <= _terrainData._pagingDistance)
+            {
+                chunksToLoad.emplace_back(dist, chunk);
+            }
+        }
+
+    if (chunksToLoad.empty())
+        return;
+
+    // nearest chunks first
+    std::sort(chunksToLoad.begin(), chunksToLoad.end(),
+              [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+    auto heightField  = getHeightField();
+    float skirtHeight = _skirtRatio * _terrainData._mapScale * 8;
+    auto jobSystem    = _director->getJobSystem();
+    for (auto&& item : chunksToLoad)
+    {
+        auto chunk        = item.second;
+        chunk->_isLoading = true;
+
+        struct ChunkPage
+        {
+            std::vector<TerrainVertexData> vertices;
+            std::vector<Triangle> triangles;
+        };
+        auto page = std::make_shared<ChunkPage>();
+
+        // the height map image and the terrain are kept alive until the job is done
+        auto image = _heightMapImage;
+        image->retain();
+        retain();
+        jobSystem->enqueue(
+            [page, heightField, skirtHeight, m = chunk->_posY, n = chunk->_posX, width = _imageWidth,
+             height = _imageHeight, size = _chunkSize, crackFixedType = _crackFixedType] {
+            buildChunkVertices([&heightField](int x, int y) { return heightField.getVertex(x, y); }, width, height,
+                               m, n, size, crackFixedType, skirtHeight, page->vertices, page->triangles);
+        },
+            [this, page, image, m = chunk->_posY, n = chunk->_posX, generation = _pagingGeneration] {
+            if (generation == _pagingGeneration)
+            {
+                auto chunk        = _chunkesArray[m][n];
+                chunk->_isLoading = false;
+                chunk->load(std::move(page->vertices), std::move(page->triangles));
+                // recalculate the LOD and the visibility of the new chunk
+                _isCameraViewChanged = true;
+            }
+            image->release();
+            release();
+        });
+    }
+}
+
+int Terrain::getLoadedChunkCount() const
+{
+    int count          = 0;
+    int chunk_amount_y = _imageHeight / _chunkSize.height;
+    int chunk_amount_x = _imageWidth / _chunkSize.width;
+    for (int m = 0; m < chunk_amount_y; m++)
+        for (int n = 0; n < chunk_amount_x; n++)
+        {
+            if (_chunkesArray[m][n]->_isLoaded)
+                ++count;
+        }
+    return count;
+}
+
+Terrain::HeightField Terrain::getHeightField() const
+{
+    HeightField heightField;
+    heightField._data      = _data;
+    heightField._width     = _imageWidth;
+    heightField._height    = _imageHeight;
+    heightField._mapHeight = _terrainData._mapHeight;
+    heightField._mapScale  = _terrainData._mapScale;
+    switch (_heightMapImage->getPixelFormat())
+    {
+    case backend::PixelFormat::BGRA8:
+        heightField._byteStride = 4;
+        break;
+    case backend::PixelFormat::RGB8:
+        heightField._byteStride = 3;
+        break;
+    default:
+        heightField._byteStride = 1;
+        break;
+    }
+    return heightField;
+}
+
+float Terrain::HeightField::getHeight(int pixelX, int pixelY) const
+{
+    return _data[(pixelY * _width + pixelX) * _byteStride] * 1.0 / 255 * _mapHeight - 0.5 * _mapHeight;
+}
+
+Vec3 Terrain::HeightField::getPosition(int pixelX, int pixelY) const
+{
+    return Vec3(pixelX * _mapScale - _width / 2 * _mapScale,    // x
+                getHeight(pixelX, pixelY),                       // y
+                pixelY * _mapScale - _height / 2 * _mapScale);  // z
+}
+
+Terrain::TerrainVertexData Terrain::HeightField::getVertex(int pixelX, int pixelY) const
+{
+    TerrainVertexData v;
+    v._position = getPosition(pixelX, pixelY);
+    v._texcoord = Tex2F(pixelX * 1.0 / _width, pixelY * 1.0 / _height);
+
+    // same triangles as Terrain::calculateNormal, so paged chunks get the normals of the resident ones
+    auto addFaceNormal = [&](int x0, int y0, int x1, int y1, int x2, int y2) {
+        Vec3 p0 = getPosition(x0, y0);
+        Vec3 normal;
+        Vec3::cross(getPosition(x1, y1) - p0, getPosition(x2, y2) - p0, &normal);
+        normal.normalize();
+        v._normal += normal;
+    };
+    for (int i = pixelY - 1; i <= pixelY; ++i)
+    {
+        for (int j = pixelX - 1; j <= pixelX; ++j)
+        {
+            if (i < 0 || j < 0 || i >= _height - 1 || j >= _width - 1)
+                continue;
+            // the cell (j, i) has the triangles (j,i)-(j,i+1)-(j+1,i) and (j+1,i)-(j,i+1)-(j+1,i+1)
+            bool inFirst  = (j == pixelX && i == pixelY) || (j == pixelX && i + 1 == pixelY) ||
+                           (j + 1 == pixelX && i == pixelY);
+            bool inSecond = (j + 1 == pixelX && i == pixelY) || (j == pixelX && i + 1 == pixelY) ||
+                            (j + 1 == pixelX && i + 1 == pixelY);
+            if (inFirst)
+                addFaceNormal(j, i, j, i + 1, j + 1, i);
+            if (inSecond)
+                addFaceNormal(j + 1, i, j, i + 1, j + 1, i + 1);
+        }
+    }
+    v._normal.normalize();
+    return v;
+}
+
 float Terrain::getHeight(float x, float z, Vec3* normal) const
 {
     Vec2 pos(x, z);
@@ -615,9 +815,10 @@ ax::Vec2 Terrain::convertToTerrainSpace(const Vec2& worldSpaceXZ) const
 
 void Terrain::resetHeightMap(std::string_view heightMap)
 {
+    // _data is owned by the height map image, which paging jobs may still retain
     _heightMapImage->release();
     _vertices.clear();
-    free(_data);
+    ++_pagingGeneration;
     for (int i = 0; i < MAX_CHUNKES; ++i)
     {
         for (int j = 0; j < MAX_CHUNKES; j++)
@@ -661,7 +862,7 @@ std::vector<float> Terrain::getHeightData() const
         for (int j = 0; j < _imageWidth; j++)
         {
             int idx   = i * _imageWidth + j;
-            data[idx] = (_vertices[idx]._position.y);
+            data[idx] = _vertices.empty() ? getImageHeight(j, i) : _vertices[idx]._position.y;
         }
     }
     return data;
@@ -897,7 +1098,8 @@ void Terrain::reload()
     {
         for (int n = 0; n < chunk_amount_x; n++)
         {
-            _chunkesArray[m][n]->finish();
+            if (_chunkesArray[m][n]->_isLoaded)
+                _chunkesArray[m][n]->finish();
         }
     }
 
@@ -1059,6 +1261,128 @@ void Terrain::Chunk::generate(int imgWidth, int imageHei, int m, int n, const un
 
     calculateAABB();
     finish();
+    _isLoaded = true;
+}
+
+void Terrain::Chunk::load(std::vector<TerrainVertexData>&& vertices, std::vector<Triangle>&& triangles)
+{
+    _originalVertices = std::move(vertices);
+    _trianglesList    = std::move(triangles);
+
+    // the quad tree transformed the triangles of the resident chunks when it was created
+    auto transform = _terrain->getNodeToWorldTransform();
+    for (auto&& triangle : _trianglesList)
+    {
+        triangle.transform(transform);
+    }
+
+    finish();
+    _isLoaded = true;
+}
+
+void Terrain::Chunk::unload()
+{
+    AX_SAFE_RELEASE_NULL(_buffer);
+    std::vector<TerrainVertexData>().swap(_originalVertices);
+    std::vector<TerrainVertexData>().swap(_currentVertices);
+    std::vector<Triangle>().swap(_trianglesList);
+    for (int i = 0; i < 4; ++i)
+    {
+        std::vector<uint16_t>().swap(_lod[i]._indices);
+    }
+    _chunkIndices = ChunkIndices();
+    _oldLod       = -1;
+    for (int i = 0; i < 4; ++i)
+    {
+        _neighborOldLOD[i] = -1;
+    }
+    _isLoaded = false;
+}
+
+void Terrain::buildChunkVertices(const std::function<TerrainVertexData(int, int)>& vertexAt,
+                                 int imgWidth,
+                                 int imgHeight,
+                                 int m,
+                                 int n,
+                                 const Vec2& size,
+                                 CrackFixedType crackFixedType,
+                                 float skirtHeight,
+                                 std::vector<TerrainVertexData>& vertices,
+                                 std::vector<Triangle>& triangles)
+{
+    const int width  = static_cast<int>(size.width);
+    const int height = static_cast<int>(size.height);
+
+    // the last row and column of a POT height map are shared with the previous pixel, so every chunk has the
+    // (width + 1) * (height + 1) grid the LOD indices expect
+    auto vertex = [&](int x, int y) {
+        return vertexAt(std::min(x, imgWidth - 1), std::min(y, imgHeight - 1));
+    };
+
+    vertices.clear();
+    int skirtAmount = crackFixedType == CrackFixedType::SKIRT ? 2 * (width + height + 2) : 0;
+    vertices.reserve((width + 1) * (height + 1) + skirtAmount);
+    for (int i = height * m; i <= height * (m + 1); ++i)
+    {
+        for (int j = width * n; j <= width * (n + 1); j++)
+        {
+            vertices.emplace_back(vertex(j, i));
+        }
+    }
+
+    if (crackFixedType == CrackFixedType::SKIRT)
+    {
+        // add four skirts, their offsets are given by Terrain::_skirtVerticesOffset
+        //#1
+        for (int i = height * m; i <= height * (m + 1); ++i)
+        {
+            auto v = vertex(width * (n + 1), i);
+            v._position.y -= skirtHeight;
+            vertices.emplace_back(v);
+        }
+
+        //#2
+        for (int j = width * n; j <= width * (n + 1); j++)
+        {
+            auto v = vertex(j, height * (m + 1));
+            v._position.y -= skirtHeight;
+            vertices.emplace_back(v);
+        }
+
+        //#3
+        for (int i = height * m; i <= height * (m + 1); ++i)
+        {
+            auto v = vertex(width * n, i);
+            v._position.y -= skirtHeight;
+            vertices.emplace_back(v);
+        }
+
+        //#4
+        for (int j = width * n; j <= width * (n + 1); j++)
+        {
+            auto v = vertex(j, height * m);
+            v._position.y -= skirtHeight;
+            vertices.emplace_back(v);
+        }
+    }
+
+    // store triangle:
+    triangles.clear();
+    triangles.reserve(width * height * 2);
+    for (int i = 0; i < height; ++i)
+    {
+        for (int j = 0; j < width; j++)
+        {
+            int nLocIndex = i * (width + 1) + j;
+            Triangle a(vertices[nLocIndex]._position, vertices[nLocIndex + 1 * (width + 1)]._position,
+                       vertices[nLocIndex + 1]._position);
+            Triangle b(vertices[nLocIndex + 1]._position, vertices[nLocIndex + 1 * (width + 1)]._position,
+                       vertices[nLocIndex + 1 * (width + 1) + 1]._position);
+
+            triangles.emplace_back(a);
+            triangles.emplace_back(b);
+        }
+    }
 }
 
 Terrain::Chunk::Chunk(Terrain* terrain)
@@ -1329,6 +1653,32 @@ void Terrain::Chunk::calculateAABB()
     _aabb.updateMinMax(&pos[0], pos.size());
 }
 
+void Terrain::Chunk::calculateAABB(const HeightField& heightField, float skirtHeight)
+{
+    int width  = static_cast<int>(_size.width);
+    int height = static_cast<int>(_size.height);
+    int x0     = width * _posX;
+    int y0     = height * _posY;
+    int x1     = std::min(width * (_posX + 1), heightField._width - 1);
+    int y1     = std::min(height * (_posY + 1), heightField._height - 1);
+
+    float minHeight = FLT_MAX;
+    float maxHeight = -FLT_MAX;
+    for (int i = y0; i <= y1; ++i)
+    {
+        for (int j = x0; j <= x1; ++j)
+        {
+            float h   = heightField.getHeight(j, i);
+            minHeight = std::min(minHeight, h);
+            maxHeight = std::max(maxHeight, h);
+        }
+    }
+
+    auto minPos = heightField.getPosition(x0, y0);
+    auto maxPos = heightField.getPosition(x1, y1);
+    _aabb.set(Vec3(minPos.x, minHeight - skirtHeight, minPos.z), Vec3(maxPos.x, maxHeight, maxPos.z));
+}
+
 void Terrain::Chunk::calculateSlope()
 {
     // find max slope
@@ -1359,9 +1709,27 @@ bool Terrain::Chunk::getIntersectPointWithRay(const Ray& ray, Vec3& intersectPoi
     if (!ray.intersects(_aabb))
         return false;
 
+    // a paged chunk which is not resident is picked against the triangles of its height map pixels
+    const std::vector<Triangle>* trianglesList = &_trianglesList;
+    std::vector<TerrainVertexData> vertices;
+    std::vector<Triangle> triangles;
+    if (!_isLoaded)
+    {
+        auto heightField = _terrain->getHeightField();
+        buildChunkVertices([&heightField](int x, int y) { return heightField.getVertex(x, y); },
+                           heightField._width, heightField._height, _posY, _posX, _size,
+                           CrackFixedType::INCREASE_LOWER, 0.0f, vertices, triangles);
+        auto transform = _terrain->getNodeToWorldTransform();
+        for (auto&& triangle : triangles)
+        {
+            triangle.transform(transform);
+        }
+        trianglesList = &triangles;
+    }
+
     float minDist = FLT_MAX;
     bool isFind   = false;
-    for (const auto& triangle : _trianglesList)
+    for (const auto& triangle : *trianglesList)
     {
         Vec3 p;
         if (triangle.getIntersectPoint(ray, p))
@@ -1558,7 +1926,8 @@ void Terrain::QuadTree::draw()
         return;
     if (_isTerminal)
     {
-        this->_chunk->bindAndDraw();
+        if (_chunk->_isLoaded)
+            _chunk->bindAndDraw();
     }
     else
     {
@@ -180,6 +180,12 @@ public:
         int _detailMapAmount;
         /**the skirt height ratio, only effect when terrain use skirt to fix crack*/
         float _skirtHeightRatio;
+        /**
+         *the paging distance, 0 by default which means all chunks are built at initialization.
+         *when greater than 0, chunk vertices are built on worker threads once the camera gets closer than this
+         *distance (in world space), and released again when it gets farther than 1.25 times this distance.
+         */
+        float _pagingDistance = 0.0f;
     };
 
 private:
@@ -222,6 +228,24 @@ private:
         ax::Vec3 _normal;
     };
 
+    /*
+     *read-only view of the height map, used to build chunk vertices without the whole terrain vertex data
+     **/
+    struct HeightField
+    {
+        float getHeight(int pixelX, int pixelY) const;
+        Vec3 getPosition(int pixelX, int pixelY) const;
+        /**get the vertex of the pixel, the normal is the average of the adjacent triangles' normals*/
+        TerrainVertexData getVertex(int pixelX, int pixelY) const;
+
+        const unsigned char* _data = nullptr;
+        int _width                 = 0;
+        int _height                = 0;
+        int _byteStride            = 1;
+        float _mapHeight           = 0;
+        float _mapScale            = 0;
+    };
+
     struct AX_DLL QuadTree;
     /*
      *the terminal node of quad, use to subdivision terrain mesh and LOD
@@ -246,8 +270,14 @@ private:
         AABB _aabb;
         /**setup Chunk data*/
         void generate(int map_width, int map_height, int m, int n, const unsigned char* data);
+        /**take the vertices built by a paging job and setup the vertex buffer*/
+        void load(std::vector<TerrainVertexData>&& vertices, std::vector<Triangle>&& triangles);
+        /**release the vertices and the vertex buffer of a paged chunk*/
+        void unload();
         /**calculateAABB*/
         void calculateAABB();
+        /**calculate the AABB from the height map, used by paged chunks which have no vertices yet*/
+        void calculateAABB(const HeightField& heightField, float skirtHeight);
         /**internal use draw function*/
         void bindAndDraw();
         /**finish opengl setup*/
@@ -294,6 +324,11 @@ private:
 
         backend::Buffer* _buffer = nullptr;
         MeshCommand _command;
+
+        /**whether the vertices are resident, always true when paging is disabled*/
+        bool _isLoaded = false;
+        /**whether a paging job is building the vertices*/
+        bool _isLoading = false;
     };
 
     /**
@@ -406,6 +441,8 @@ public:
     virtual void draw(ax::Renderer* renderer, const ax::Mat4& transform, uint32_t flags) override;
     /**
      * Ray-Terrain intersection.
+     * when paging is enabled, the chunks which are not resident are tested against their height map pixels,
+     * so the result does not depend on the camera position.
      * @return the intersection point
      */
     Vec3 getIntersectionPoint(const Ray& ray) const;
@@ -470,6 +507,16 @@ public:
      */
     std::vector<float> getHeightData() const;
 
+    /**
+     * whether the chunks are paged in and out around the camera, see TerrainData::_pagingDistance
+     */
+    bool isPagingEnabled() const { return _terrainData._pagingDistance > 0; }
+
+    /**
+     * get the amount of chunks whose vertices are resident
+     */
+    int getLoadedChunkCount() const;
+
     Terrain();
     virtual ~Terrain();
     bool initWithTerrainData(TerrainData& parameter, CrackFixedType fixedType);
@@ -491,6 +538,29 @@ protected:
      **/
     void calculateNormal();
 
+    /**
+     * load the chunks near the camera on worker threads and release the far ones
+     * @param cameraPos the camera position in world space
+     **/
+    void updatePaging(const Vec3& cameraPos);
+
+    /**
+     * build the vertices and the triangles of the chunk at row m, column n
+     * @param vertexAt returns the vertex of the pixel (x, y) of the height map
+     **/
+    static void buildChunkVertices(const std::function<TerrainVertexData(int, int)>& vertexAt,
+                                   int imgWidth,
+                                   int imgHeight,
+                                   int m,
+                                   int n,
+                                   const Vec2& size,
+                                   CrackFixedType crackFixedType,
+                                   float skirtHeight,
+                                   std::vector<TerrainVertexData>& vertices,
+                                   std::vector<Triangle>& triangles);
+
+    HeightField getHeightField() const;
+
     // override
     virtual void onEnter() override;
 
@@ -518,6 +588,8 @@ private:
 protected:
     std::vector<ChunkLODIndices> _chunkLodIndicesSet;
     std::vector<ChunkLODIndicesSkirt> _chunkLodIndicesSkirtSet;
+    // bumped when the height map is reset, paging jobs of the old height map are discarded
+    unsigned int _pagingGeneration = 0;
     Mat4 _CameraMatrix;
     bool _isCameraViewChanged;
     TerrainData _terrainData;
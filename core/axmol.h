@@ -252,6 +252,7 @@ THE SOFTWARE.
 
 // tilemap_parallax_nodes
 #include "2d/ParallaxNode.h"
+#include "2d/SpatialIndexNode.h"
 #include "2d/TMXObjectGroup.h"
 #include "2d/TMXXMLParser.h"
 #include "2d/TileMapAtlas.h"
@@ -32,6 +32,7 @@ THE SOFTWARE.
 
 // standard includes
 #include <string>
+#include <limits>
 
 #include "2d/SpriteFrameCache.h"
 #include "platform/FileUtils.h"
@@ -43,6 +44,8 @@ THE SOFTWARE.
 #include "2d/Transition.h"
 #include "2d/FontFreeType.h"
 #include "2d/LabelAtlas.h"
+#include "2d/Layer.h"
+#include "2d/RenderTexture.h"
 #include "renderer/TextureCache.h"
 #include "renderer/Renderer.h"
 #include "renderer/RenderState.h"
@@ -292,7 +295,10 @@ void Director::drawScene()
         _eventDispatcher->dispatchEvent(_eventAfterUpdate);
     }
 
-    _renderer->clear(ClearFlag::ALL, _clearColor, 1, 0, -10000.0);
+    // in dirty region mode the scene is cleared and rendered into the cache, see beginDirtyRegionRedraw()
+    const bool dirtyRegionRedraw = _dirtyRegionRedrawEnabled && _glView && prepareDirtyRegionCache();
+    if (!dirtyRegionRedraw)
+        _renderer->clear(ClearFlag::ALL, _clearColor, 1, 0, -10000.0);
 
     _eventDispatcher->dispatchEvent(_eventBeforeDraw);
 
@@ -306,38 +312,69 @@ void Director::drawScene()
 
     pushMatrix(MATRIX_STACK_TYPE::MATRIX_STACK_MODELVIEW);
 
+    bool skipFrame   = false;
+    _dirtyRegionPass = DirtyRegionPass::NONE;
+
     if (_runningScene)
     {
 #if (defined(AX_ENABLE_PHYSICS) || (defined(AX_ENABLE_3D_PHYSICS) && AX_ENABLE_BULLET_INTEGRATION) || \
      defined(AX_ENABLE_NAVMESH))
         _runningScene->stepPhysicsAndNavigation(_deltaTime);
 #endif
-        // clear draw stats
-        _renderer->clearDrawStats();
+        // a moving default camera changes every pixel
+        if (dirtyRegionRedraw && _runningScene->getDefaultCamera())
+        {
+            auto& viewProjection = _runningScene->getDefaultCamera()->getViewProjectionMatrix();
+            if (memcmp(viewProjection.m, _dirtyRegionViewProjection.m, sizeof(viewProjection.m)) != 0)
+            {
+                _dirtyRegionViewProjection = viewProjection;
+                _fullRedraw                = true;
+            }
+        }
 
-        // render the scene
-        if (_glView)
-            _glView->renderScene(_runningScene, _renderer);
+        // nothing changed since the previous frame, the presented image is still valid
+        skipFrame = dirtyRegionRedraw && !_sceneChanged && !_fullRedraw;
+        if (!skipFrame)
+        {
+            // clear draw stats
+            _renderer->clearDrawStats();
 
-        _eventDispatcher->dispatchEvent(_eventAfterVisit);
+            // render the scene
+            _trackingDirtyRegions = dirtyRegionRedraw;
+            if (_glView)
+                _glView->renderScene(_runningScene, _renderer);
+            _trackingDirtyRegions = false;
+            _sceneChanged         = false;
+
+            _eventDispatcher->dispatchEvent(_eventAfterVisit);
+        }
     }
 
-    // draw the notifications node
-    if (_notificationNode)
+    if (dirtyRegionRedraw && !skipFrame)
+        skipFrame = !endDirtyRegionRedraw();
+
+    if (!skipFrame)
     {
-        _notificationNode->visit(_renderer, Mat4::IDENTITY, 0);
+        // draw the notifications node
+        if (_notificationNode)
+        {
+            _notificationNode->visit(_renderer, Mat4::IDENTITY, 0);
+        }
     }
 
     updateFrameRate();
 
-    if (_statsDisplay)
+    if (_statsDisplay && !skipFrame)
     {
 #if !AX_STRIP_FPS
         showStats();
 #endif
     }
 
-    _renderer->render();
+    if (skipFrame)
+        _renderer->discard();
+    else
+        _renderer->render();
 
     _eventDispatcher->dispatchEvent(_eventAfterDraw);
 
@@ -346,7 +383,7 @@ void Director::drawScene()
     _totalFrames++;
 
     // swap buffers
-    if (_glView)
+    if (_glView && !skipFrame)
     {
         _glView->swapBuffers();
     }
@@ -389,6 +426,8 @@ void Director::calculateDeltaTime()
         _deltaTime = 1 / 60.0f;
     }
 #endif
+
+    _totalTime += _deltaTime;
 }
 
 float Director::getDeltaTime() const
@@ -696,6 +735,197 @@ float Director::getZEye() const
 void Director::setClearColor(const Color4F& clearColor)
 {
     _clearColor = clearColor;
+    _fullRedraw = true;
+}
+
+void Director::setDirtyRegionRedrawEnabled(bool enabled)
+{
+    if (_dirtyRegionRedrawEnabled == enabled)
+        return;
+
+    _dirtyRegionRedrawEnabled = enabled;
+    _dirtyRegion              = Rect::ZERO;
+    _fullRedraw               = true;
+    if (!enabled)
+        releaseDirtyRegionCache();
+}
+
+void Director::addDirtyRegion(const Rect& rect)
+{
+    if (!_dirtyRegionRedrawEnabled || rect.size.width <= 0 || rect.size.height <= 0)
+        return;
+
+    if (_dirtyRegion.size.width <= 0 || _dirtyRegion.size.height <= 0)
+        _dirtyRegion = rect;
+    else
+        _dirtyRegion.merge(rect);
+    _sceneChanged = true;
+}
+
+bool Director::prepareDirtyRegionCache()
+{
+    // recreate the cache whenever the window size changes, its content is lost then
+    const Vec2 winSize    = getWinSize();
+    const int cacheWidth  = static_cast<int>(winSize.width);
+    const int cacheHeight = static_cast<int>(winSize.height);
+    if (_dirtyRegionCache && _dirtyRegionCache->getContentSize().width == static_cast<float>(cacheWidth) &&
+        _dirtyRegionCache->getContentSize().height == static_cast<float>(cacheHeight))
+        return true;
+
+    releaseDirtyRegionCache();
+    _dirtyRegionCache = RenderTexture::create(cacheWidth, cacheHeight, backend::PixelFormat::RGBA8,
+                                              backend::PixelFormat::D24S8);
+    if (!_dirtyRegionCache)
+    {
+        _dirtyRegionRedrawEnabled = false;
+        return false;
+    }
+    _dirtyRegionCache->retain();
+    _dirtyRegionCache->getSprite()->setBlendFunc(BlendFunc::DISABLE);
+    _dirtyRegionCache->getSprite()->setGlobalZOrder(std::numeric_limits<float>::lowest());
+
+    _dirtyRegionFill = LayerColor::create();
+    _dirtyRegionFill->retain();
+    _dirtyRegionFill->setBlendFunc(BlendFunc::DISABLE);
+    _dirtyRegionFill->setGlobalZOrder(std::numeric_limits<float>::lowest());
+
+    _fullRedraw = true;
+    return true;
+}
+
+void Director::beginDirtyRegionRedraw()
+{
+    if (!_trackingDirtyRegions)
+        return;
+
+    // the first camera decides, its nodes are the tracked ones
+    const bool firstCamera = _dirtyRegionPass == DirtyRegionPass::NONE;
+    if (firstCamera)
+    {
+        const Vec2 winSize  = getWinSize();
+        Rect region         = _dirtyRegion;
+        _dirtyRegion        = Rect::ZERO;
+        _dirtyRegionScissor = Rect::ZERO;
+        _dirtyRegionPass    = DirtyRegionPass::REDRAW;
+        if (!_fullRedraw)
+        {
+            // grow by a point so anti-aliased edges and rounding never leave stale pixels
+            region.origin -= Vec2::ONE;
+            region.size = region.size + Vec2(2, 2);
+
+            const float minX = std::max(std::floor(region.getMinX()), 0.0f);
+            const float minY = std::max(std::floor(region.getMinY()), 0.0f);
+            const float maxX = std::min(std::ceil(region.getMaxX()), winSize.width);
+            const float maxY = std::min(std::ceil(region.getMaxY()), winSize.height);
+            region.setRect(minX, minY, maxX - minX, maxY - minY);
+
+            if (maxX <= minX || maxY <= minY)
+                _dirtyRegionPass = DirtyRegionPass::DISCARD;
+            // scissoring most of the screen costs more than it saves
+            else if (region.size.width * region.size.height <= winSize.width * winSize.height * 0.5f)
+                _dirtyRegionScissor = region;
+        }
+        _fullRedraw = false;
+    }
+
+    if (_dirtyRegionPass == DirtyRegionPass::DISCARD)
+    {
+        _renderer->discard();
+        return;
+    }
+
+    auto rt                = _dirtyRegionCache->getRenderTarget();
+    const Rect scissor     = _dirtyRegionScissor;
+    const float pixelScale = _contentScaleFactor;
+    const Vec2 cacheSize   = _dirtyRegionCache->getSprite()->getTexture()->getContentSizeInPixels();
+
+    // queued below the camera's clear brush, sorting keeps them in this order
+    auto beginCommand = _renderer->nextCallbackCommand();
+    beginCommand->init(std::numeric_limits<float>::lowest());
+    beginCommand->func = [this, rt, scissor, pixelScale, cacheSize, firstCamera]() {
+        if (firstCamera)
+            _dirtyRegionOldViewport = _renderer->getViewport();
+        _renderer->setRenderTarget(rt);
+        _renderer->setViewPort(0, 0, static_cast<unsigned int>(cacheSize.width),
+                               static_cast<unsigned int>(cacheSize.height));
+        if (!scissor.equals(Rect::ZERO))
+        {
+            _renderer->setScissorTest(true);
+            _renderer->setScissorRect(scissor.origin.x * pixelScale, scissor.origin.y * pixelScale,
+                                      scissor.size.width * pixelScale, scissor.size.height * pixelScale);
+        }
+    };
+    _renderer->addCommand(beginCommand);
+
+    if (!firstCamera)
+        return;
+
+    if (scissor.equals(Rect::ZERO))
+    {
+        _renderer->clear(ClearFlag::ALL, _clearColor, 1, 0, std::numeric_limits<float>::lowest());
+    }
+    else
+    {
+        // a clear ignores the scissor on some backends, so the color is restored by drawing a quad
+        _renderer->clear(ClearFlag::DEPTH_AND_STENCIL, _clearColor, 1, 0, std::numeric_limits<float>::lowest());
+        const Color4B fillColor(_clearColor);
+        _dirtyRegionFill->setColor(Color3B(fillColor.r, fillColor.g, fillColor.b));
+        _dirtyRegionFill->setOpacity(fillColor.a);
+        _dirtyRegionFill->setContentSize(scissor.size);
+        _dirtyRegionFill->setPosition(scissor.origin);
+        visitInScreenSpace(_dirtyRegionFill);
+    }
+}
+
+bool Director::endDirtyRegionRedraw()
+{
+    if (_dirtyRegionPass == DirtyRegionPass::DISCARD)
+        return false;
+
+    if (_dirtyRegionPass == DirtyRegionPass::NONE)
+    {
+        // no camera rendered into the cache
+        _renderer->clear(ClearFlag::ALL, _clearColor, 1, 0, std::numeric_limits<float>::lowest());
+        return true;
+    }
+
+    auto endCommand = _renderer->nextCallbackCommand();
+    endCommand->init(std::numeric_limits<float>::lowest());
+    endCommand->func = [this]() {
+        _renderer->setScissorTest(false);
+        _renderer->setRenderTarget(_renderer->getDefaultRenderTarget());
+        _renderer->setViewPort(_dirtyRegionOldViewport.x, _dirtyRegionOldViewport.y, _dirtyRegionOldViewport.w,
+                               _dirtyRegionOldViewport.h);
+    };
+    _renderer->addCommand(endCommand);
+
+    // present the cache, the notification node and the stats are drawn on top of it
+    _renderer->clear(ClearFlag::ALL, _clearColor, 1, 0, std::numeric_limits<float>::lowest());
+    visitInScreenSpace(_dirtyRegionCache->getSprite());
+
+    return true;
+}
+
+void Director::visitInScreenSpace(Node* node)
+{
+    const Vec2 winSize = getWinSize();
+    Mat4 projection;
+    Mat4::createOrthographicOffCenter(0, winSize.width, 0, winSize.height, -1024, 1024, &projection);
+
+    // the director's own nodes are not part of the scene's dirty region
+    const bool tracking   = _trackingDirtyRegions;
+    _trackingDirtyRegions = false;
+    pushMatrix(MATRIX_STACK_TYPE::MATRIX_STACK_PROJECTION);
+    loadMatrix(MATRIX_STACK_TYPE::MATRIX_STACK_PROJECTION, projection);
+    node->visit(_renderer, Mat4::IDENTITY, 0);
+    popMatrix(MATRIX_STACK_TYPE::MATRIX_STACK_PROJECTION);
+    _trackingDirtyRegions = tracking;
+}
+
+void Director::releaseDirtyRegionCache()
+{
+    AX_SAFE_RELEASE_NULL(_dirtyRegionCache);
+    AX_SAFE_RELEASE_NULL(_dirtyRegionFill);
 }
 
 static void GLToClipTransform(Mat4* transformOut)
@@ -1024,6 +1254,9 @@ void Director::reset()
 
     _notificationNode = nullptr;
 
+    releaseDirtyRegionCache();
+    _fullRedraw = true;
+
     // remove all objects, but don't release it.
     // runWithScene might be executed after 'end'.
 #if AX_ENABLE_GC_FOR_NATIVE_OBJECTS
@@ -1137,6 +1370,8 @@ void Director::setNextScene()
 {
     _eventDispatcher->dispatchEvent(_beforeSetNextScene);
 
+    _fullRedraw = true;
+
     bool runningIsTransition = dynamic_cast<TransitionScene*>(_runningScene) != nullptr;
     bool newIsTransition     = dynamic_cast<TransitionScene*>(_nextScene) != nullptr;
 
@@ -1521,6 +1756,9 @@ void Director::startAnimation(SetIntervalReason reason)
 
     // fix issue #3509, skip one fps to avoid incorrect time calculation.
     setNextDeltaTimeZero(true);
+
+    // the surface may have been recreated while the animation was stopped
+    _fullRedraw = true;
 }
 
 void Director::queueOperation(AsyncOperation op, void* param)
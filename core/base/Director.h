@@ -68,6 +68,8 @@ class EventListenerCustom;
 class TextureCache;
 class Renderer;
 class Camera;
+class RenderTexture;
+class LayerColor;
 
 /**
  @brief Class that creates and handles the main Window and manages how
@@ -381,6 +383,38 @@ public:
      */
     void setClearColor(const Color4F& clearColor);
 
+    /** Enables or disables the dirty region redraw mode.
+     * When enabled the scene is rendered into a cached render target and each frame only the screen regions
+     * whose nodes moved, resized, changed color or content since the previous frame are redrawn, scissored.
+     * A frame in which nothing changed is neither visited nor rendered nor presented, which saves a lot of
+     * power on mostly static screens such as menus.
+     * Only the default camera of the running scene is tracked. Nodes that draw outside their content size or
+     * change without going through a setter (particles, DrawNode, animated shaders, other cameras) have to
+     * call Node::setRenderDirty() or markFullRedraw() themselves.
+     */
+    void setDirtyRegionRedrawEnabled(bool enabled);
+    bool isDirtyRegionRedrawEnabled() const { return _dirtyRegionRedrawEnabled; }
+
+    /** Adds a rectangle in world space points that has to be redrawn next frame, ignored unless the dirty
+     * region redraw mode is enabled.
+     */
+    void addDirtyRegion(const Rect& rect);
+
+    /** Forces the next frame to redraw the whole screen in dirty region redraw mode. */
+    void markFullRedraw() { _fullRedraw = true; }
+
+    /** Tells the dirty region redraw mode that a node changed, so the next frame can't be skipped. */
+    void markSceneChanged() { _sceneChanged = true; }
+
+    /** Whether the nodes being visited report their changes as dirty regions. */
+    bool isTrackingDirtyRegions() const { return _trackingDirtyRegions; }
+
+    /** Called by Scene::render() once a camera has been visited, before its commands are rendered.
+     * In dirty region redraw mode it redirects them into the cache, scissored to the dirty region, or drops
+     * them when no visible pixel changed.
+     */
+    void beginDirtyRegionRedraw();
+
     void mainLoop();
     /** Invoke main loop with delta time. Then `calculateDeltaTime` can just use the delta time directly.
      * The delta time paseed may include vsync time. See issue #17806
@@ -453,6 +487,9 @@ public:
     /* Gets delta time since last tick to main loop. */
     float getDeltaTime() const;
 
+    /* Gets the sum of the delta times of all frames since the director started, in seconds. */
+    double getTotalTime() const { return _totalTime; }
+
     /**
      *  Gets Frame Rate.
      * @js NA
@@ -552,6 +589,15 @@ protected:
     void setNextScene();
 
     void updateFrameRate();
+
+    /** Creates the dirty region cache when missing or resized, returns false when it can't be. */
+    bool prepareDirtyRegionCache();
+    /** Queues the commands that present the dirty region cache.
+     Returns false when nothing was redrawn and the frame doesn't have to be presented. */
+    bool endDirtyRegionRedraw();
+    void releaseDirtyRegionCache();
+    void visitInScreenSpace(Node* node);
+
 #if !AX_STRIP_FPS
     void showStats();
     void createStatsLabel();
@@ -598,6 +644,7 @@ protected:
 
     /* delta time since last tick to main loop */
     float _deltaTime              = 0.0f;
+    double _totalTime             = 0.0;
     bool _deltaTimePassedByCaller = false;
 
     /* The _glView, where everything is rendered, GLView is a abstract class,cocos2d-x provide GLViewImpl
@@ -663,6 +710,25 @@ protected:
     Renderer* _renderer = nullptr;
 
     Color4F _clearColor = {0, 0, 0, 1};
+
+    /* dirty region redraw mode */
+    enum class DirtyRegionPass
+    {
+        NONE,     // no camera rendered yet this frame
+        DISCARD,  // nothing visible changed, the cameras' commands are dropped
+        REDRAW,   // the cameras' commands are redirected into the cache
+    };
+    bool _dirtyRegionRedrawEnabled     = false;
+    bool _trackingDirtyRegions         = false;
+    bool _fullRedraw                   = true;
+    bool _sceneChanged                 = true;
+    DirtyRegionPass _dirtyRegionPass   = DirtyRegionPass::NONE;
+    Rect _dirtyRegion                  = Rect::ZERO;
+    Rect _dirtyRegionScissor           = Rect::ZERO;
+    Mat4 _dirtyRegionViewProjection;
+    Viewport _dirtyRegionOldViewport;
+    RenderTexture* _dirtyRegionCache   = nullptr;
+    LayerColor* _dirtyRegionFill       = nullptr;
 #ifdef AX_ENABLE_CONSOLE
     /* Console for the director */
     Console* _console = nullptr;
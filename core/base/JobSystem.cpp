@@ -28,6 +28,8 @@
 #include "yasio/thread_name.hpp"
 
 #include <queue>
+#include <atomic>
+#include <algorithm>
 #include <thread>
 #include <mutex>
 #include <condition_variable>
@@ -242,6 +244,54 @@ void JobSystem::enqueue(std::function<void()> task, std::function<void()> done)
         taskw(_mainThreadData);
 }
 
+void JobSystem::parallelFor(size_t count, const std::function<void(size_t)>& fn, size_t minBatch)
+{
+    if (count == 0)
+        return;
+
+    const size_t threads = std::min<size_t>(count / std::max<size_t>(minBatch, 1),
+                                            std::max(1u, std::thread::hardware_concurrency()));
+    if (!_executor || threads < 2)
+    {
+        for (size_t i = 0; i < count; ++i)
+            fn(i);
+        return;
+    }
+
+    struct Batch
+    {
+        const std::function<void(size_t)>* fn = nullptr;
+        size_t total                          = 0;
+        std::atomic<size_t> next{0};
+        std::atomic<size_t> done{0};
+        std::mutex mutex;
+        std::condition_variable finished;
+    };
+    auto batch   = std::make_shared<Batch>();
+    batch->fn    = &fn;
+    batch->total = count;
+
+    // workers that start after all items are taken return at once, so fn is never called after this returns
+    auto run = [](Batch& work) {
+        for (size_t i = work.next.fetch_add(1); i < work.total; i = work.next.fetch_add(1))
+        {
+            (*work.fn)(i);
+            if (work.done.fetch_add(1) + 1 == work.total)
+            {
+                std::lock_guard<std::mutex> lck(work.mutex);
+                work.finished.notify_one();
+            }
+        }
+    };
+
+    for (size_t i = 1; i < threads; ++i)
+        _executor->enqueue_v([batch, run](JobThreadData*) { run(*batch); });
+    run(*batch);
+
+    std::unique_lock<std::mutex> lck(batch->mutex);
+    batch->finished.wait(lck, [&batch]() { return batch->done.load() == batch->total; });
+}
+
 #pragma endregion
 
 }  // namespace ax
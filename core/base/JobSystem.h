@@ -39,6 +39,7 @@ Copyright (c) 2019-present Axmol Engine contributors (see AUTHORS.md).
 #include <memory>
 #include <string>
 #include <span>
+#include <functional>
 #include "base/Config.h"
 #include "platform/PlatformDefine.h"
 
@@ -102,6 +103,16 @@ public:
     void enqueue(std::function<void()> task, std::function<void()> done);
     void enqueue(std::shared_ptr<JobThreadTask> task);
 
+    /**
+     * Runs fn(i) for every i in [0, count) on the workers and the calling thread, returns when all are done.
+     * The calling thread takes whatever the workers didn't pick up, so a busy queue or a nested call doesn't stall it.
+     *
+     * @param count number of items.
+     * @param fn called once per item, from any of the participating threads.
+     * @param minBatch minimum number of items per thread, fewer items than 2 * minBatch stay on the calling thread.
+     */
+    void parallelFor(size_t count, const std::function<void(size_t)>& fn, size_t minBatch = 1);
+
  protected:
     void init(const std::span<std::shared_ptr<JobThreadData>>& tdds);
 
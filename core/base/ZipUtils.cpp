@@ -49,6 +49,7 @@
 #include <mutex>
 
 #include "yasio/string_view.hpp"
+#include "mio/mio.hpp"
 
 // minizip 1.2.0 is same with other platforms
 #define unzGoToFirstFile64(A, B, C, D) unzGoToFirstFile2(A, B, C, D, NULL, 0, NULL, 0)
@@ -542,6 +543,10 @@ struct ZipEntryInfo
     unz_file_pos pos;
     uint64_t uncompressed_size;
     uint64_t offset;
+    uint64_t compressed_size;
+    uint16_t compression_method;
+    // the entry payload inside the mapped archive, nullptr when the entry must be read through minizip
+    const uint8_t* data;
 };
 
 struct ZipFilePrivate
@@ -663,10 +668,66 @@ struct ZipFilePrivate
     }
     // End of Overrides
 
+    // locate the payload of an entry in the mapped archive, so it can be read without the shared unzFile handle
+    const uint8_t* resolveEntryData(const unz_file_info64& fileInfo) const
+    {
+        // local file header: signature(4) ... file name length(2) at 26, extra field length(2) at 28
+        constexpr uint64_t LOCAL_HEADER_SIZE = 30;
+
+        if (!archiveData || fileInfo.disk_num_start != 0 || (fileInfo.flag & 1) != 0)
+            return nullptr;  // spanned or encrypted
+        if (fileInfo.compression_method != 0 && fileInfo.compression_method != Z_DEFLATED)
+            return nullptr;
+        if (fileInfo.compressed_size > UINT32_MAX || fileInfo.uncompressed_size > UINT32_MAX)
+            return nullptr;  // z_stream counters are 32 bits
+        if (fileInfo.disk_offset + LOCAL_HEADER_SIZE > archiveSize)
+            return nullptr;
+
+        auto header = archiveData + fileInfo.disk_offset;
+        if (header[0] != 'P' || header[1] != 'K' || header[2] != 3 || header[3] != 4)
+            return nullptr;
+
+        const uint64_t nameLength  = header[26] | (header[27] << 8);
+        const uint64_t extraLength = header[28] | (header[29] << 8);
+        const uint64_t dataOffset  = fileInfo.disk_offset + LOCAL_HEADER_SIZE + nameLength + extraLength;
+        if (dataOffset + fileInfo.compressed_size > archiveSize)
+            return nullptr;
+
+        return archiveData + dataOffset;
+    }
+
+    // inflate a resolved entry, safe to call from any thread
+    static bool readEntryData(const ZipEntryInfo& entry, void* out)
+    {
+        if (entry.compression_method == 0)
+        {
+            memcpy(out, entry.data, static_cast<size_t>(entry.uncompressed_size));
+            return true;
+        }
+
+        z_stream stream{};
+        if (inflateInit2(&stream, -MAX_WBITS) != Z_OK)
+            return false;
+        stream.next_in   = const_cast<Bytef*>(entry.data);
+        stream.avail_in  = static_cast<uInt>(entry.compressed_size);
+        stream.next_out  = static_cast<Bytef*>(out);
+        stream.avail_out = static_cast<uInt>(entry.uncompressed_size);
+
+        const int err = inflate(&stream, Z_FINISH);
+        const bool ok = err == Z_STREAM_END && stream.total_out == entry.uncompressed_size;
+        inflateEnd(&stream);
+        return ok;
+    }
+
     std::string zipFileName;
     unzFile zipFile;
     std::mutex zipFileMtx;
 
+    // the whole archive, when it's a plain file or a memory buffer
+    mio::mmap_source mapping;
+    const uint8_t* archiveData = nullptr;
+    uint64_t archiveSize       = 0;
+
     std::unique_ptr<ourmemory_s> memfs;
 
     // std::unordered_map is faster if available on the platform
@@ -715,6 +776,22 @@ bool ZipFile::initWithFile(std::string_view zipFile, std::string_view filter)
 {
     _data->zipFileName = zipFile;
     _data->zipFile     = unzOpen2_64(zipFile.data(), &_data->functionOverrides);
+
+    if (_data->zipFile)
+    {
+        auto fileStream = FileUtils::getInstance()->openFileStream(zipFile, IFileStream::Mode::READ);
+        if (fileStream && fileStream->nativeHandle() != (osfhnd_t)-1 && fileStream->size() > 0)
+        {
+            std::error_code error;
+            _data->mapping.map(fileStream->nativeHandle(), 0, mio::map_entire_file, error);
+            if (!error && _data->mapping.is_mapped())
+            {
+                _data->archiveData = reinterpret_cast<const uint8_t*>(_data->mapping.data());
+                _data->archiveSize = _data->mapping.size();
+            }
+        }
+    }
+
     return setFilter(filter);
 }
 
@@ -745,7 +822,13 @@ bool ZipFile::setFilter(std::string_view filter)
                 // cache info about filtered files only (like 'assets/')
                 if (filter.empty() || currentFileName.substr(0, filter.length()) == filter)
                 {
-                    _data->fileList[currentFileName] = ZipEntryInfo{posInfo, (uint64_t)fileInfo.uncompressed_size, 0};
+                    _data->fileList[currentFileName] =
+                        ZipEntryInfo{posInfo,
+                                     (uint64_t)fileInfo.uncompressed_size,
+                                     0,
+                                     (uint64_t)fileInfo.compressed_size,
+                                     fileInfo.compression_method,
+                                     _data->resolveEntryData(fileInfo)};
                 }
             }
             // next file - also get the information about it
@@ -818,6 +901,17 @@ bool ZipFile::getFileData(std::string_view fileName, ResizableBuffer* buffer)
 
         ZipEntryInfo& fileInfo = it->second;
 
+        // mapped entries are inflated straight from the archive, without serializing on the unzFile handle
+        if (fileInfo.data)
+        {
+            buffer->resize(fileInfo.uncompressed_size);
+            if (fileInfo.uncompressed_size == 0 || ZipFilePrivate::readEntryData(fileInfo, buffer->buffer()))
+            {
+                res = true;
+                break;
+            }
+        }
+
         std::unique_lock<std::mutex> lck(_data->zipFileMtx);
 
         int nRet = unzGoToFilePos(_data->zipFile, &fileInfo.pos);
@@ -884,6 +978,8 @@ bool ZipFile::initWithBuffer(const void *buffer, uLong size)
     _data->zipFile = unzOpen2(nullptr, &memory_file);
     if (!_data->zipFile) return false;
     _data->memfs = std::move(memfs);
+    _data->archiveData = static_cast<const uint8_t*>(buffer);
+    _data->archiveSize = size;
     setFilter(emptyFilename);
     return true;
 }
@@ -904,6 +1000,15 @@ int ZipFile::vread(ZipEntryInfo* entry, void* buf, unsigned int size)
     {
         AX_BREAK_IF(entry == nullptr || entry->offset >= entry->uncompressed_size);
 
+        // stored entries of a mapped archive are plain byte ranges
+        if (entry->data && entry->compression_method == 0)
+        {
+            n = static_cast<int>(std::min<uint64_t>(size, entry->uncompressed_size - entry->offset));
+            memcpy(buf, entry->data + entry->offset, n);
+            entry->offset += n;
+            break;
+        }
+
         std::unique_lock<std::mutex> lck(_data->zipFileMtx);
 
         int nRet = unzGoToFilePos(_data->zipFile, &entry->pos);
@@ -956,6 +1061,15 @@ void ZipFile::vclose(ZipEntryInfo* entry)
         entry->offset = 0;
 }
 
+int64_t ZipFile::getFileSize(std::string_view fileName) const
+{
+    auto it = _data->fileList.find(fileName);
+    if (it != _data->fileList.end())
+        return static_cast<int64_t>(it->second.uncompressed_size);
+
+    return -1;
+}
+
 int64_t ZipFile::vsize(ZipEntryInfo* entry)
 {
     if (entry != nullptr)
@@ -291,12 +291,20 @@ public:
 
     /**
      * Get resource file data from a zip file.
+     * Stored and deflated entries of an archive on the native file system (or in memory) are read from a mapping
+     * of the archive and can be read concurrently from any thread, other entries serialize on the minizip handle.
      * @param fileName File name
      * @param[out] buffer If the file read operation succeeds, if will contain the file data.
      * @return True if successful.
      */
     bool getFileData(std::string_view fileName, ResizableBuffer* buffer);
 
+    /**
+     * Get the uncompressed size of a file in the zip file.
+     * @return The size, or -1 if the file doesn't exist.
+     */
+    int64_t getFileSize(std::string_view fileName) const;
+
     std::string getFirstFilename();
     std::string getNextFilename();
 
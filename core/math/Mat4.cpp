@@ -701,6 +701,12 @@ bool Mat4::isIdentity() const
     return (memcmp(m, IDENTITY.m, sizeof(m)) == 0);
 }
 
+bool Mat4::isAffine2D() const
+{
+    return m[2] == 0.0f && m[3] == 0.0f && m[6] == 0.0f && m[7] == 0.0f && m[8] == 0.0f && m[9] == 0.0f &&
+           m[10] == 1.0f && m[11] == 0.0f && m[14] == 0.0f && m[15] == 1.0f;
+}
+
 void Mat4::multiply(float scalar)
 {
     multiply(scalar, this);
@@ -728,6 +734,12 @@ void Mat4::multiply(const Mat4& m1, const Mat4& m2, Mat4* dst)
     MathUtil::multiplyMatrix(m1.m, m2.m, dst->m);
 }
 
+void Mat4::multiplyAffine2D(const Mat4& m1, const Mat4& m2, Mat4* dst)
+{
+    AX_ASSERT(dst);
+    MathUtil::multiplyAffine2D(m1.m, m2.m, dst->m);
+}
+
 void Mat4::negate()
 {
     MathUtil::negateMatrix(m, m);
@@ -518,6 +518,14 @@ public:
      */
     bool isIdentity() const;
 
+    /**
+     * Determines if this matrix is a pure 2D affine transform, i.e. it only rotates, scales,
+     * skews and translates in the XY plane and leaves Z and W untouched.
+     *
+     * @return true if only m[0], m[1], m[4], m[5], m[12] and m[13] differ from the identity.
+     */
+    bool isAffine2D() const;
+
     /**
      * Multiplies the components of this matrix by the specified scalar.
      *
@@ -558,6 +566,18 @@ public:
      */
     static void multiply(const Mat4& m1, const Mat4& m2, Mat4* dst);
 
+    /**
+     * Multiplies m1 by the 2D affine matrix m2 and stores the result in dst.
+     *
+     * Only the 2x3 affine part of m2 is read, so this is cheaper than multiply(),
+     * but the result is only correct when m2.isAffine2D() is true.
+     *
+     * @param m1 The first matrix to multiply.
+     * @param m2 The 2D affine matrix to multiply.
+     * @param dst A matrix to store the result in.
+     */
+    static void multiplyAffine2D(const Mat4& m1, const Mat4& m2, Mat4* dst);
+
     /**
      * Negates this matrix.
      */
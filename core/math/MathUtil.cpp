@@ -193,6 +193,27 @@ void MathUtil::multiplyMatrix(const float* m1, const float* m2, float* dst)
 #endif
 }
 
+void MathUtil::multiplyAffine2D(const float* m1, const float* m2, float* dst)
+{
+#if defined(AX_SSE_INTRINSICS)
+    MathUtilSSE::multiplyAffine2D(reinterpret_cast<const _xm128_t*>(m1), reinterpret_cast<const _xm128_t*>(m2),
+                                  reinterpret_cast<_xm128_t*>(dst));
+#elif defined(AX_NEON_INTRINSICS)
+#    if AX_64BITS || AX_NEON_INTRINSICS > 1
+    MathUtilNeon::multiplyAffine2D(reinterpret_cast<const _xm128_t*>(m1), reinterpret_cast<const _xm128_t*>(m2),
+                                   reinterpret_cast<_xm128_t*>(dst));
+#    else
+    if (isNeon32Enabled())
+        MathUtilNeon::multiplyAffine2D(reinterpret_cast<const _xm128_t*>(m1), reinterpret_cast<const _xm128_t*>(m2),
+                                       reinterpret_cast<_xm128_t*>(dst));
+    else
+        MathUtilC::multiplyAffine2D(m1, m2, dst);
+#    endif
+#else
+    MathUtilC::multiplyAffine2D(m1, m2, dst);
+#endif
+}
+
 void MathUtil::negateMatrix(const float* m, float* dst)
 {
 #if defined(AX_SSE_INTRINSICS)
@@ -109,6 +109,8 @@ private:
 
     static void multiplyMatrix(const float* m1, const float* m2, float* dst);
 
+    static void multiplyAffine2D(const float* m1, const float* m2, float* dst);
+
     static void negateMatrix(const float* m, float* dst);
 
     static void transposeMatrix(const float* m, float* dst);
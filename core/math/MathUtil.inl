@@ -132,6 +132,35 @@ public:
         memcpy(dst, product, sizeof(product));
     }
 
+    inline static void multiplyAffine2D(const float* m1, const float* m2, float* dst)
+    {
+        // m2 only carries the 2x3 affine part (m2[0], m2[1], m2[4], m2[5], m2[12], m2[13]),
+        // the third column of m1 passes through untouched.
+        float product[16];
+
+        product[0] = m1[0] * m2[0] + m1[4] * m2[1];
+        product[1] = m1[1] * m2[0] + m1[5] * m2[1];
+        product[2] = m1[2] * m2[0] + m1[6] * m2[1];
+        product[3] = m1[3] * m2[0] + m1[7] * m2[1];
+
+        product[4] = m1[0] * m2[4] + m1[4] * m2[5];
+        product[5] = m1[1] * m2[4] + m1[5] * m2[5];
+        product[6] = m1[2] * m2[4] + m1[6] * m2[5];
+        product[7] = m1[3] * m2[4] + m1[7] * m2[5];
+
+        product[8]  = m1[8];
+        product[9]  = m1[9];
+        product[10] = m1[10];
+        product[11] = m1[11];
+
+        product[12] = m1[0] * m2[12] + m1[4] * m2[13] + m1[12];
+        product[13] = m1[1] * m2[12] + m1[5] * m2[13] + m1[13];
+        product[14] = m1[2] * m2[12] + m1[6] * m2[13] + m1[14];
+        product[15] = m1[3] * m2[12] + m1[7] * m2[13] + m1[15];
+
+        memcpy(dst, product, sizeof(product));
+    }
+
     inline static void negateMatrix(const float* m, float* dst)
     {
         dst[0]  = -m[0];
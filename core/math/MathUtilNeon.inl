@@ -80,6 +80,20 @@ struct MathUtilNeon
         memcpy(dst, product, sizeof(product));
     }
 
+    inline static void multiplyAffine2D(const _xm128_t* m1, const _xm128_t* m2, _xm128_t* dst)
+    {
+        float32x4_t c0 = vmulq_n_f32(m1[0], vgetq_lane_f32(m2[0], 0));
+        c0             = vmlaq_n_f32(c0, m1[1], vgetq_lane_f32(m2[0], 1));
+        float32x4_t c1 = vmulq_n_f32(m1[0], vgetq_lane_f32(m2[1], 0));
+        c1             = vmlaq_n_f32(c1, m1[1], vgetq_lane_f32(m2[1], 1));
+        float32x4_t c3 = vmlaq_n_f32(m1[3], m1[0], vgetq_lane_f32(m2[3], 0));
+        c3             = vmlaq_n_f32(c3, m1[1], vgetq_lane_f32(m2[3], 1));
+        dst[2]         = m1[2];
+        dst[0]         = c0;
+        dst[1]         = c1;
+        dst[3]         = c3;
+    }
+
     inline static void negateMatrix(const _xm128_t* m, _xm128_t* dst)
     {
         AX_UNROLL
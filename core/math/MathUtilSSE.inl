@@ -146,6 +146,25 @@ struct MathUtilSSE
         dst[3] = dst3;
     }
 
+    static void multiplyAffine2D(const __m128 m1[4], const __m128 m2[4], __m128 dst[4])
+    {
+        __m128 a0 = _mm_shuffle_ps(m2[0], m2[0], _MM_SHUFFLE(0, 0, 0, 0));
+        __m128 b0 = _mm_shuffle_ps(m2[0], m2[0], _MM_SHUFFLE(1, 1, 1, 1));
+        __m128 a1 = _mm_shuffle_ps(m2[1], m2[1], _MM_SHUFFLE(0, 0, 0, 0));
+        __m128 b1 = _mm_shuffle_ps(m2[1], m2[1], _MM_SHUFFLE(1, 1, 1, 1));
+        __m128 a3 = _mm_shuffle_ps(m2[3], m2[3], _MM_SHUFFLE(0, 0, 0, 0));
+        __m128 b3 = _mm_shuffle_ps(m2[3], m2[3], _MM_SHUFFLE(1, 1, 1, 1));
+
+        __m128 dst0 = _mm_add_ps(_mm_mul_ps(m1[0], a0), _mm_mul_ps(m1[1], b0));
+        __m128 dst1 = _mm_add_ps(_mm_mul_ps(m1[0], a1), _mm_mul_ps(m1[1], b1));
+        __m128 dst3 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m1[0], a3), _mm_mul_ps(m1[1], b3)), m1[3]);
+
+        dst[2] = m1[2];
+        dst[0] = dst0;
+        dst[1] = dst1;
+        dst[3] = dst3;
+    }
+
     static void negateMatrix(const __m128 m[4], __m128 dst[4])
     {
         __m128 z = _mm_setzero_ps();
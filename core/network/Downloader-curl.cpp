@@ -27,7 +27,10 @@
 #if !defined(__EMSCRIPTEN__)
 #    include "network/Downloader-curl.h"
 
+#    include <algorithm>
+#    include <chrono>
 #    include <cinttypes>
+#    include <deque>
 #    include <set>
 
 #    include <curl/curl.h>
@@ -54,6 +57,12 @@
 
 #    define AX_CURL_POLL_TIMEOUT_MS 1000
 
+// a failed segment is fetched again this many times before the whole task fails
+#    define AX_CURL_SEGMENT_MAX_RETRIES 3
+
+// "AXSG", the journal of a segmented download: a header, then one record per segment
+#    define AX_CURL_SEGMENT_JOURNAL_MAGIC 0x47535841u
+
 enum
 {
     kCheckSumStateSucceed = 1,
@@ -105,15 +114,39 @@ public:
 
         _fs.reset();
         _fsMd5.reset();
+        _fsJournal.reset();
     }
 
-    bool init(std::string_view filename, std::string_view tempSuffix)
+    // a byte range of a segmented file task, fetched by its own curl handle
+    struct Segment
+    {
+        DownloadTaskCURL* owner = nullptr;
+        size_t index            = 0;
+        int64_t begin           = 0;
+        int64_t length          = -1;  // unknown while the first segment probes the file size
+        int64_t received        = 0;
+        int retries             = 0;
+        bool done               = false;
+        bool restored           = false;  // done in a previous run, md5State never saw its bytes
+        CURL* curl              = nullptr;
+        MD5state_st md5State;
+        uint8_t digest[16]{};
+
+        // the validators of the response being received
+        int64_t rangeTotal = -1;
+        std::string etag;
+        std::string lastModified;
+    };
+
+    bool init(std::string_view filename, std::string_view tempSuffix, const DownloaderHints& hints)
     {
         // data task
         if (filename.empty())
             return true;
 
         // file task
+        _segmented    = hints.countOfMaxSegmentsPerTask > 1 && hints.segmentSize > 0;
+        _segmentSize  = hints.segmentSize;
         _fileName     = filename;
         _tempFileName = filename;
         _tempFileName.append(tempSuffix);
@@ -170,6 +203,12 @@ public:
                 }
             }
 
+            if (_segmented)
+            {
+                ret = openSegmentedFiles();
+                break;
+            }
+
             // open file
             _fs = FileUtils::getInstance()->openFileStream(_tempFileName, IFileStream::Mode::APPEND);
             if (!_fs)
@@ -308,9 +347,354 @@ public:
         return ret;
     }
 
+    bool openSegmentedFiles()
+    {
+        // segments land at their own offsets, the temp file is written in place
+        _fs = FileUtils::getInstance()->openFileStream(_tempFileName, IFileStream::Mode::OVERLAPPED);
+        if (!_fs)
+        {
+            setErrorDesc(DownloadTask::ERROR_OPEN_FILE_FAILED, 0, "Can't open file:" + _tempFileName);
+            return false;
+        }
+
+        _checksumFileName = _tempFileName + ".segments";
+        _fsJournal = FileUtils::getInstance()->openFileStream(_checksumFileName, IFileStream::Mode::OVERLAPPED);
+        if (!_fsJournal)
+        {
+            setErrorDesc(DownloadTask::ERROR_OPEN_FILE_FAILED, 0, "Can't open segment journal:" + _checksumFileName);
+            return false;
+        }
+
+        MD5_Init(&_md5State);
+
+        if (!loadSegmentJournal())
+        {
+            // nothing to resume, the first segment also probes the size and range support
+            _segments.clear();
+            _fs->resize(0);
+            _fsJournal->resize(0);
+            addSegment(0, -1);
+        }
+
+        _totalBytesReceived = 0;
+        for (auto&& segment : _segments)
+            _totalBytesReceived += segment.received;
+        _transferOffset = _startBytes = _totalBytesReceived;
+        _startTime                    = std::chrono::steady_clock::now();
+        return true;
+    }
+
+    Segment& addSegment(int64_t begin, int64_t length)
+    {
+        auto& segment  = _segments.emplace_back();
+        segment.owner  = this;
+        segment.index  = _segments.size() - 1;
+        segment.begin  = begin;
+        segment.length = length;
+        MD5_Init(&segment.md5State);
+        return segment;
+    }
+
+    bool loadSegmentJournal()
+    {
+        SegmentJournalHeader header{};
+        _fsJournal->seek(0, SEEK_SET);
+        if (_fsJournal->read(&header, sizeof(header)) != sizeof(header) ||
+            header.magic != AX_CURL_SEGMENT_JOURNAL_MAGIC || header.segmentSize != _segmentSize ||
+            header.fileSize <= 0 || header.segmentCount != (header.fileSize + _segmentSize - 1) / _segmentSize)
+            return false;
+
+        _totalBytesExpected = header.fileSize;
+        _rangesSupported    = true;
+        memcpy(_validator, header.validator, sizeof(_validator));
+        for (uint32_t i = 0; i < header.segmentCount; ++i)
+        {
+            SegmentRecord record{};
+            if (_fsJournal->read(&record, sizeof(record)) != sizeof(record))
+                return false;
+
+            const int64_t begin = static_cast<int64_t>(i) * _segmentSize;
+            auto& segment       = addSegment(begin, std::min<int64_t>(_segmentSize, header.fileSize - begin));
+
+            // only trust a finished segment whose bytes on disk still hash to what was recorded
+            if (record.done && verifySegmentOnDisk(segment, record.digest))
+            {
+                segment.done     = true;
+                segment.restored = true;
+                segment.received = segment.length;
+                memcpy(segment.digest, record.digest, sizeof(segment.digest));
+            }
+        }
+        return true;
+    }
+
+    bool verifySegmentOnDisk(const Segment& segment, const uint8_t* digest)
+    {
+        if (_fs->size() < segment.begin + segment.length)
+            return false;
+
+        MD5state_st state;
+        MD5_Init(&state);
+        hashFileRange(state, segment.begin, segment.length);
+
+        uint8_t actual[16];
+        MD5_Final(actual, &state);
+        return memcmp(actual, digest, sizeof(actual)) == 0;
+    }
+
+    void hashFileRange(MD5state_st& state, int64_t begin, int64_t length)
+    {
+        uint8_t block[64 * 1024];
+        _fs->seek(begin, SEEK_SET);
+        while (length > 0)
+        {
+            const int n = _fs->read(block, static_cast<unsigned int>(std::min<int64_t>(length, sizeof(block))));
+            if (n <= 0)
+                break;
+            MD5_Update(&state, block, n);
+            length -= n;
+        }
+    }
+
+    // a previous run already stored a file matching the checksum, the journal of that run is gone
+    bool verifyStoredFile(std::string_view requiredsum)
+    {
+        if (requiredsum.empty())
+            return false;
+
+        auto fs = FileUtils::getInstance()->openFileStream(_fileName, IFileStream::Mode::READ);
+        if (!fs)
+            return false;
+
+        MD5state_st state;
+        MD5_Init(&state);
+        uint8_t block[64 * 1024];
+        int n = 0;
+        while ((n = fs->read(block, sizeof(block))) > 0)
+            MD5_Update(&state, block, n);
+
+        std::string digest(16, '\0');
+        MD5_Final((uint8_t*)&digest.front(), &state);
+        if (requiredsum != utils::bin2hex(digest))
+            return false;
+
+        _fsJournal.reset();
+        FileUtils::getInstance()->removeFile(_checksumFileName);
+        return true;
+    }
+
+    // ETag, or Last-Modified when the server sends no ETag, reduced to a digest, all zero when there is neither
+    static void digestValidator(const Segment& segment, uint8_t* digest)
+    {
+        const auto& validator = !segment.etag.empty() ? segment.etag : segment.lastModified;
+        memset(digest, 0, 16);
+        if (validator.empty())
+            return;
+
+        MD5state_st state;
+        MD5_Init(&state);
+        MD5_Update(&state, validator.data(), validator.size());
+        MD5_Final(digest, &state);
+    }
+
+    // a range response of a resumed file must come from the same file the journal was started for
+    bool isSameSource(const Segment& segment) const
+    {
+        uint8_t validator[16];
+        digestValidator(segment, validator);
+        return segment.rangeTotal == _totalBytesExpected && memcmp(validator, _validator, sizeof(validator)) == 0;
+    }
+
+    // the remote file changed, drop what was received so the next attempt starts over
+    void discardSegments()
+    {
+        std::lock_guard<std::recursive_mutex> lock(_mutex);
+
+        _fsJournal.reset();
+        FileUtils::getInstance()->removeFile(_checksumFileName);
+        _fs->resize(0);
+    }
+
+    void writeSegmentJournal()
+    {
+        SegmentJournalHeader header{AX_CURL_SEGMENT_JOURNAL_MAGIC, static_cast<uint32_t>(_segments.size()),
+                                    _totalBytesExpected, _segmentSize};
+        memcpy(header.validator, _validator, sizeof(header.validator));
+        _fsJournal->resize(0);
+        _fsJournal->seek(0, SEEK_SET);
+        _fsJournal->write(&header, sizeof(header));
+        for (auto&& segment : _segments)
+            writeSegmentRecord(segment);
+    }
+
+    void writeSegmentRecord(const Segment& segment)
+    {
+        SegmentRecord record{};
+        record.done = segment.done ? 1 : 0;
+        memcpy(record.digest, segment.digest, sizeof(record.digest));
+        _fsJournal->seek(sizeof(SegmentJournalHeader) + segment.index * sizeof(SegmentRecord), SEEK_SET);
+        _fsJournal->write(&record, sizeof(record));
+    }
+
+    size_t headerSegmentProc(Segment& segment, const char* buffer, size_t size)
+    {
+        using namespace cxx17;  // for string_view literal
+        std::lock_guard<std::recursive_mutex> lock(_mutex);
+
+        std::string_view line{buffer, size};
+        if (cxx20::ic::starts_with(line, "Content-Range:"_sv))
+        {
+            // Content-Range: bytes 0-1023/146515
+            auto slash         = line.rfind('/');
+            segment.rangeTotal = slash != std::string_view::npos ? strtoll(line.data() + slash + 1, nullptr, 10) : -1;
+        }
+        else if (cxx20::ic::starts_with(line, "ETag:"_sv))
+            segment.etag = headerValue(line);
+        else if (cxx20::ic::starts_with(line, "Last-Modified:"_sv))
+            segment.lastModified = headerValue(line);
+        else if (line == "\r\n"_sv || line == "\n"_sv)
+        {
+            // end of the headers of one response, redirects send several
+            long responseCode = 0;
+            curl_easy_getinfo(segment.curl, CURLINFO_RESPONSE_CODE, &responseCode);
+            bool accepted = true;
+            if (segment.length < 0)
+            {
+                if (responseCode == 206 && segment.rangeTotal > 0)
+                {
+                    digestValidator(segment, _validator);
+                    setupSegments(segment, segment.rangeTotal);
+                }
+                else if (responseCode == 200)
+                {
+                    // ranges are ignored, the whole file streams into the first segment
+                    curl_off_t contentLength = -1;
+                    curl_easy_getinfo(segment.curl, CURLINFO_CONTENT_LENGTH_DOWNLOAD_T, &contentLength);
+                    _totalBytesExpected = contentLength > 0 ? contentLength : -1;
+                    _rangesSupported    = false;
+                }
+            }
+            else if (responseCode == 200 || (responseCode == 206 && !isSameSource(segment)))
+                accepted = false;
+
+            segment.rangeTotal = -1;
+            segment.etag.clear();
+            segment.lastModified.clear();
+            if (!accepted)
+            {
+                // spliced with the segments already on disk the file would be corrupt
+                _sourceChanged = true;
+                return 0;
+            }
+        }
+        return size;
+    }
+
+    static std::string headerValue(std::string_view line)
+    {
+        auto colon = line.find(':');
+        auto first = line.find_first_not_of(" \t", colon + 1);
+        auto last  = line.find_last_not_of(" \t\r\n");
+        return first != std::string_view::npos && last >= first ? std::string{line.substr(first, last - first + 1)}
+                                                                : std::string{};
+    }
+
+    void setupSegments(Segment& probe, int64_t fileSize)
+    {
+        _totalBytesExpected = fileSize;
+        _rangesSupported    = true;
+        probe.length        = std::min<int64_t>(_segmentSize, fileSize);
+        for (int64_t begin = probe.length; begin < fileSize; begin += _segmentSize)
+            addSegment(begin, std::min<int64_t>(_segmentSize, fileSize - begin));
+        writeSegmentJournal();
+    }
+
+    size_t writeSegmentProc(Segment& segment, unsigned char* buffer, size_t size, size_t count)
+    {
+        std::lock_guard<std::recursive_mutex> lock(_mutex);
+
+        const auto bytes_transferred = size * count;
+        if (segment.length >= 0 && segment.received + static_cast<int64_t>(bytes_transferred) > segment.length)
+            return 0;  // more than the range asked for, fails the segment
+
+        _fs->seek(segment.begin + segment.received, SEEK_SET);
+        if (_fs->write(buffer, static_cast<unsigned int>(bytes_transferred)) != static_cast<int>(bytes_transferred))
+            return 0;
+
+        ::MD5_Update(&segment.md5State, buffer, bytes_transferred);
+        segment.received += bytes_transferred;
+        _bytesReceived += bytes_transferred;
+        _totalBytesReceived += bytes_transferred;
+
+        // throughput of all segments together
+        auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - _startTime).count();
+        if (elapsed > 0)
+            _speed = static_cast<curl_off_t>((_totalBytesReceived - _startBytes) / elapsed);
+
+        return bytes_transferred;
+    }
+
+    void completeSegment(Segment& segment)
+    {
+        std::lock_guard<std::recursive_mutex> lock(_mutex);
+
+        auto state = segment.md5State;  // keep the running state, the single segment one is the file digest
+        MD5_Final(segment.digest, &state);
+        segment.done = true;
+        if (_rangesSupported)
+            writeSegmentRecord(segment);
+    }
+
+    void resetSegment(Segment& segment)
+    {
+        std::lock_guard<std::recursive_mutex> lock(_mutex);
+
+        _totalBytesReceived -= segment.received;
+        segment.received = 0;
+        MD5_Init(&segment.md5State);
+    }
+
+    bool allSegmentsDone() const
+    {
+        return !_segments.empty() &&
+               std::all_of(_segments.begin(), _segments.end(), [](const Segment& segment) { return segment.done; });
+    }
+
+    // all segments are on disk, prepare the md5 state the finish checks and drop the journal
+    void finishSegments(std::string_view requiredsum)
+    {
+        std::lock_guard<std::recursive_mutex> lock(_mutex);
+
+        if (_segments.size() == 1 && !_segments.front().restored)
+            _md5State = _segments.front().md5State;
+        else if (!requiredsum.empty())
+        {
+            MD5_Init(&_md5State);
+            hashFileRange(_md5State, 0, _totalBytesExpected);
+        }
+
+        _fsJournal.reset();
+        FileUtils::getInstance()->removeFile(_checksumFileName);
+    }
+
 private:
     friend class DownloaderCURL;
 
+    struct SegmentJournalHeader
+    {
+        uint32_t magic;
+        uint32_t segmentCount;
+        int64_t fileSize;
+        int64_t segmentSize;
+        uint8_t validator[16];  // of the file the segments were fetched from
+    };
+
+    struct SegmentRecord
+    {
+        uint8_t done;
+        uint8_t digest[16];
+    };
+
     // for lock object instance
     std::recursive_mutex _mutex;
 
@@ -343,6 +727,18 @@ private:
     // calculate md5 in downloading time support
     std::unique_ptr<IFileStream> _fsMd5{};  // store md5 state realtime
     MD5state_st _md5State;
+
+    // segmented download, the deque keeps segment addresses stable for the curl callbacks
+    bool _segmented         = false;
+    bool _rangesSupported   = false;
+    int64_t _segmentSize    = 0;
+    bool _sourceChanged     = false;
+    int64_t _startBytes     = 0;
+    int _activeSegments     = 0;
+    uint8_t _validator[16]{};
+    std::chrono::steady_clock::time_point _startTime;
+    std::deque<Segment> _segments;
+    std::unique_ptr<IFileStream> _fsJournal{};  // which segments are complete and their digests
 };
 int DownloadTaskCURL::_sSerialId;
 std::mutex DownloadTaskCURL::_sStoragePathSetMutex;
@@ -452,7 +848,7 @@ private:
             return -1;
         if (coTask->_cancelled)
             return 1;
-        if (coTask->_totalBytesExpected < 0 && dltotal > 0)
+        if (!coTask->_segmented && coTask->_totalBytesExpected < 0 && dltotal > 0)
             coTask->_totalBytesExpected = dltotal + coTask->_transferOffset;
         if (dlnow > 0 && task->background)
         {
@@ -468,6 +864,48 @@ private:
         return pTask.openSocket(propose, addr);
     }
 
+    static size_t _outputSegmentCallbackProc(void* buffer,
+                                             size_t size,
+                                             size_t count,
+                                             DownloadTaskCURL::Segment* segment)
+    {
+        return segment->owner->writeSegmentProc(*segment, (unsigned char*)buffer, size, count);
+    }
+
+    static size_t _headerSegmentCallbackProc(char* buffer,
+                                             size_t size,
+                                             size_t count,
+                                             DownloadTaskCURL::Segment* segment)
+    {
+        return segment->owner->headerSegmentProc(*segment, buffer, size * count);
+    }
+
+    void _initCommonCurlOptionsProc(CURL* handle, std::shared_ptr<DownloadTask>& task)
+    {
+        if (hints.timeoutInSeconds)
+        {
+            curl_easy_setopt(handle, CURLOPT_CONNECTTIMEOUT, hints.timeoutInSeconds);
+        }
+
+        curl_easy_setopt(handle, CURLOPT_LOW_SPEED_LIMIT, 1L);
+        curl_easy_setopt(handle, CURLOPT_LOW_SPEED_TIME, 10L);
+
+        if (task->cacertPath.empty())
+        {
+            curl_easy_setopt(handle, CURLOPT_SSL_VERIFYPEER, 0L);
+            curl_easy_setopt(handle, CURLOPT_SSL_VERIFYHOST, 0L);
+        }
+        else
+        {
+            curl_easy_setopt(handle, CURLOPT_SSL_VERIFYPEER, 1L);
+            curl_easy_setopt(handle, CURLOPT_SSL_VERIFYHOST, 2L);
+            curl_easy_setopt(handle, CURLOPT_CAINFO, task->cacertPath.c_str());
+        }
+
+        curl_easy_setopt(handle, CURLOPT_FOLLOWLOCATION, 1L);
+        curl_easy_setopt(handle, CURLOPT_MAXREDIRS, 5L);
+    }
+
     // this function designed call in work thread
     // the curl handle destroyed in _threadProc
     // handle inited for get header
@@ -506,32 +944,163 @@ private:
             curl_easy_setopt(handle, CURLOPT_RESUME_FROM_LARGE, (curl_off_t)coTask->_totalBytesReceived);
         }
 
-        if (hints.timeoutInSeconds)
+        _initCommonCurlOptionsProc(handle, task);
+
+        coTask->_curl = handle;
+
+        return CURLE_OK;
+    }
+
+    // handle fetches one byte range of a segmented task, the first one without a known length also probes the
+    // file size from Content-Range
+    void _initSegmentCurlHandleProc(CURL* handle,
+                                    std::shared_ptr<DownloadTask>& task,
+                                    DownloadTaskCURL::Segment& segment)
+    {
+        DownloadTaskCURL* coTask = static_cast<DownloadTaskCURL*>(task->_coTask.get());
+
+        curl_easy_setopt(handle, CURLOPT_URL, task->requestURL.c_str());
+        curl_easy_setopt(handle, CURLOPT_PRIVATE, &segment);
+
+        curl_easy_setopt(handle, CURLOPT_NOPROGRESS, 0L);
+        curl_easy_setopt(handle, CURLOPT_XFERINFOFUNCTION, _progressCallbackProc);
+        curl_easy_setopt(handle, CURLOPT_XFERINFODATA, task.get());
+
+        curl_easy_setopt(handle, CURLOPT_WRITEFUNCTION, _outputSegmentCallbackProc);
+        curl_easy_setopt(handle, CURLOPT_WRITEDATA, &segment);
+
+        curl_easy_setopt(handle, CURLOPT_FAILONERROR, 1L);
+        curl_easy_setopt(handle, CURLOPT_NOSIGNAL, 1L);
+        curl_easy_setopt(handle, CURLOPT_HEADER, 0L);
+
+        // the headers probe the file size or validate the file a resumed segment belongs to
+        curl_easy_setopt(handle, CURLOPT_HEADERFUNCTION, _headerSegmentCallbackProc);
+        curl_easy_setopt(handle, CURLOPT_HEADERDATA, &segment);
+
+        char buf[128];
+        if (segment.length < 0)
+            snprintf(buf, sizeof(buf), "0-%" PRId64, coTask->_segmentSize - 1);
+        else
+            snprintf(buf, sizeof(buf), "%" PRId64 "-%" PRId64, segment.begin, segment.begin + segment.length - 1);
+        curl_easy_setopt(handle, CURLOPT_RANGE, buf);
+
+        _initCommonCurlOptionsProc(handle, task);
+    }
+
+    // starts pending segments of the task up to countOfMaxSegmentsPerTask, returns false when a handle can't be added
+    bool _launchSegmentsProc(CURLM* curlmHandle,
+                             std::unordered_map<CURL*, std::shared_ptr<DownloadTask>>& coTaskMap,
+                             std::shared_ptr<DownloadTask>& task)
+    {
+        auto coTask = static_cast<DownloadTaskCURL*>(task->_coTask.get());
+        for (auto&& segment : coTask->_segments)
         {
-            curl_easy_setopt(handle, CURLOPT_CONNECTTIMEOUT, hints.timeoutInSeconds);
+            if (coTask->_activeSegments >= static_cast<int>(hints.countOfMaxSegmentsPerTask))
+                break;
+            if (segment.done || segment.curl)
+                continue;
+
+            CURL* curlHandle = curl_easy_init();
+            if (nullptr == curlHandle)
+            {
+                coTask->setErrorDesc(DownloadTask::ERROR_IMPL_INTERNAL, 0, "Alloc curl handle failed.");
+                return false;
+            }
+
+            _initSegmentCurlHandleProc(curlHandle, task, segment);
+
+            auto mcode = curl_multi_add_handle(curlmHandle, curlHandle);
+            if (CURLM_OK != mcode)
+            {
+                curl_easy_cleanup(curlHandle);
+                coTask->setErrorDesc(DownloadTask::ERROR_IMPL_INTERNAL, mcode, curl_multi_strerror(mcode));
+                return false;
+            }
+
+            segment.curl = curlHandle;
+            ++coTask->_activeSegments;
+            coTaskMap[curlHandle] = task;
         }
+        return true;
+    }
 
-        curl_easy_setopt(handle, CURLOPT_LOW_SPEED_LIMIT, 1L);
-        curl_easy_setopt(handle, CURLOPT_LOW_SPEED_TIME, 10L);
+    void _abortSegmentsProc(CURLM* curlmHandle, std::unordered_map<CURL*, std::shared_ptr<DownloadTask>>& coTaskMap,
+                            std::shared_ptr<DownloadTask>& task)
+    {
+        auto coTask = static_cast<DownloadTaskCURL*>(task->_coTask.get());
+        for (auto&& segment : coTask->_segments)
+        {
+            if (!segment.curl)
+                continue;
+            curl_multi_remove_handle(curlmHandle, segment.curl);
+            curl_easy_cleanup(segment.curl);
+            coTaskMap.erase(segment.curl);
+            segment.curl = nullptr;
+        }
+        coTask->_activeSegments = 0;
+    }
 
-        if (task->cacertPath.empty())
+    // handles a finished segment handle, returns true when the whole task is finished
+    bool _onSegmentDoneProc(CURLM* curlmHandle,
+                            std::unordered_map<CURL*, std::shared_ptr<DownloadTask>>& coTaskMap,
+                            std::shared_ptr<DownloadTask>& task,
+                            DownloadTaskCURL::Segment& segment,
+                            CURLcode errCode)
+    {
+        auto coTask = static_cast<DownloadTaskCURL*>(task->_coTask.get());
+        auto curlHandle = segment.curl;
+        segment.curl    = nullptr;
+        --coTask->_activeSegments;
+
+        bool failed = false;
+        if (coTask->_sourceChanged)
         {
-            curl_easy_setopt(handle, CURLOPT_SSL_VERIFYPEER, 0L);
-            curl_easy_setopt(handle, CURLOPT_SSL_VERIFYHOST, 0L);
+            coTask->setErrorDesc(DownloadTask::ERROR_IMPL_INTERNAL, errCode,
+                                 "The remote file changed since the download was started");
+            coTask->discardSegments();
+            failed = true;
+        }
+        else if (CURLE_OK == errCode && (segment.length < 0 || segment.received == segment.length))
+        {
+            if (segment.length < 0)
+            {
+                // the server ignored the range, the single segment is the whole file
+                segment.length              = segment.received;
+                coTask->_totalBytesExpected = segment.received;
+            }
+            coTask->completeSegment(segment);
+        }
+        else if (!coTask->_cancelled && ++segment.retries <= AX_CURL_SEGMENT_MAX_RETRIES)
+        {
+            AXLOGD("    _threadProc retry segment {} of task {}, errCode:{}", segment.index, coTask->serialId,
+                   static_cast<int>(errCode));
+            coTask->resetSegment(segment);
         }
         else
         {
-            curl_easy_setopt(handle, CURLOPT_SSL_VERIFYPEER, 1L);
-            curl_easy_setopt(handle, CURLOPT_SSL_VERIFYHOST, 2L);
-            curl_easy_setopt(handle, CURLOPT_CAINFO, task->cacertPath.c_str());
+            std::string errorMsg = CURLE_OK != errCode ? curl_easy_strerror(errCode) : "Segment length mismatch";
+            if (errCode == CURLE_HTTP_RETURNED_ERROR)
+            {
+                long responeCode = 0;
+                curl_easy_getinfo(curlHandle, CURLINFO_RESPONSE_CODE, &responeCode);
+                fmt::format_to(std::back_inserter(errorMsg), FMT_COMPILE(": {}"), responeCode);
+            }
+            coTask->setErrorDesc(DownloadTask::ERROR_IMPL_INTERNAL, errCode, std::move(errorMsg));
+            failed = true;
         }
 
-        curl_easy_setopt(handle, CURLOPT_FOLLOWLOCATION, 1L);
-        curl_easy_setopt(handle, CURLOPT_MAXREDIRS, 5L);
-
-        coTask->_curl = handle;
+        if (failed || !_launchSegmentsProc(curlmHandle, coTaskMap, task))
+        {
+            _abortSegmentsProc(curlmHandle, coTaskMap, task);
+            return true;
+        }
 
-        return CURLE_OK;
+        if (coTask->_activeSegments == 0)
+        {
+            coTask->finishSegments(task->checksum);
+            return true;
+        }
+        return false;
     }
 
     void _threadProc()
@@ -546,6 +1115,7 @@ private:
         // init curl content
         CURLM* curlmHandle = curl_multi_init();
         std::unordered_map<CURL*, std::shared_ptr<DownloadTask>> coTaskMap;
+        std::set<std::shared_ptr<DownloadTask>> segmentedTasks;
         int runningHandles = 0;
         CURLMcode mcode    = CURLM_OK;
         int rc             = 0;  // select return code
@@ -599,6 +1169,26 @@ private:
 
                         // remove from multi-handle
                         curl_multi_remove_handle(curlmHandle, curlHandle);
+
+                        DownloadTaskCURL::Segment* segment = nullptr;
+                        curl_easy_getinfo(curlHandle, CURLINFO_PRIVATE, (char**)&segment);
+                        if (segment)
+                        {
+                            bool finished = _onSegmentDoneProc(curlmHandle, coTaskMap, task, *segment, errCode);
+                            curl_easy_cleanup(curlHandle);
+                            coTaskMap.erase(curlHandle);
+                            if (finished)
+                            {
+                                segmentedTasks.erase(task);
+                                {
+                                    std::lock_guard<std::mutex> lock(_processMutex);
+                                    _processSet.erase(task);
+                                }
+                                finishTask(task);
+                            }
+                            continue;
+                        }
+
                         do
                         {
                             auto coTask = static_cast<DownloadTaskCURL*>(task->_coTask.get());
@@ -647,6 +1237,24 @@ private:
                         finishTask(task);
                     }
                 } while (m);
+
+                // the probe segment may have revealed the file size, start the remaining segments
+                for (auto it = segmentedTasks.begin(); it != segmentedTasks.end();)
+                {
+                    auto task = *it;
+                    if (_launchSegmentsProc(curlmHandle, coTaskMap, task))
+                    {
+                        ++it;
+                        continue;
+                    }
+                    _abortSegmentsProc(curlmHandle, coTaskMap, task);
+                    it = segmentedTasks.erase(it);
+                    {
+                        std::lock_guard<std::mutex> lock(_processMutex);
+                        _processSet.erase(task);
+                    }
+                    finishTask(task);
+                }
             }
 
             // process tasks in _requestList
@@ -682,6 +1290,37 @@ private:
                     continue;
                 }
 
+                if (coTask->_segmented)
+                {
+                    // Check if the file has already been downloaded
+                    if (coTask->verifyStoredFile(task->checksum))
+                    {
+                        coTask->_alreadyDownloaded = true;
+                        finishTask(task);
+                        continue;
+                    }
+
+                    // every segment verified from a previous run
+                    if (coTask->allSegmentsDone())
+                    {
+                        coTask->finishSegments(task->checksum);
+                        finishTask(task);
+                        continue;
+                    }
+
+                    if (!_launchSegmentsProc(curlmHandle, coTaskMap, task))
+                    {
+                        _abortSegmentsProc(curlmHandle, coTaskMap, task);
+                        finishTask(task);
+                        continue;
+                    }
+
+                    segmentedTasks.insert(task);
+                    std::lock_guard<std::mutex> lock(_processMutex);
+                    _processSet.insert(task);
+                    continue;
+                }
+
                 // Check if the file has already been downloaded
                 int status = coTask->verifyFileIntegrity(task->checksum);
                 if (status & kCheckSumStateSucceed || DownloadTask::ERROR_NO_ERROR != coTask->_errCode)
@@ -778,7 +1417,7 @@ void DownloaderCURL::startTask(std::shared_ptr<DownloadTask>& task)
 {
     DownloadTaskCURL* coTask = new DownloadTaskCURL(*this);
     task->_coTask.reset(coTask);  // coTask auto managed by task
-    if (coTask->init(task->storagePath, _impl->hints.tempFileNameSuffix))
+    if (coTask->init(task->storagePath, _impl->hints.tempFileNameSuffix, _impl->hints))
     {
         AXLOGD("DownloaderCURL: createTask: Id({})", coTask->serialId);
 
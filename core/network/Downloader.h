@@ -103,6 +103,13 @@ public:
     uint32_t countOfMaxProcessingTasks;
     uint32_t timeoutInSeconds;
     std::string tempFileNameSuffix;
+
+    // Large file tasks are split into HTTP range segments of segmentSize bytes, up to countOfMaxSegmentsPerTask
+    // of them are fetched concurrently. Each segment is hashed while it arrives and recorded once complete, an
+    // interrupted task resumes with the segments still missing as long as the server reports the same ETag (or
+    // Last-Modified) and size, otherwise the task fails and starts over. 1 keeps the single stream download.
+    uint32_t countOfMaxSegmentsPerTask = 1;
+    uint32_t segmentSize               = 8 * 1024 * 1024;
 };
 
 class AX_DLL Downloader final
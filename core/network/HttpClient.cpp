@@ -32,6 +32,7 @@
 #include <errno.h>
 #include "base/Utils.h"
 #include "base/Director.h"
+#include "base/ZipUtils.h"
 #include "platform/FileUtils.h"
 #include "yasio/yasio.hpp"
 
@@ -45,6 +46,11 @@ namespace network
 
 static HttpClient* _httpClient = nullptr;  // pointer to singleton
 
+static std::string makeHostKey(const Uri& uri)
+{
+    return fmt::format("{}://{}:{}", uri.getScheme(), uri.getHost(), uri.getPort());
+}
+
 template <typename _Cont, typename _Fty>
 static void __clearQueueUnsafe(_Cont& queue, _Fty pred)
 {
@@ -120,6 +126,9 @@ HttpClient::HttpClient()
     , _timeoutForRead(60)
     , _cookie(nullptr)
     , _clearResponsePredicate(nullptr)
+    , _keepAliveEnabled(true)
+    , _keepAliveTimeout(15)
+    , _gzipEnabled(false)
 {
     AXLOGD("In the constructor of HttpClient!");
     _scheduler = Director::getInstance()->getScheduler();
@@ -182,6 +191,41 @@ void HttpClient::tickInput()
 void HttpClient::handleNetworkStatusChanged()
 {
     _service->set_option(YOPT_S_DNS_DIRTY, 1);
+
+    // connections kept alive over the old network are most likely dead
+    _service->schedule(std::chrono::microseconds(0), [this](io_service& s) {
+        for (int i = 0; i < HttpClient::MAX_CHANNELS; ++i)
+        {
+            if (!s.channel_at(i)->ud_.ptr && _channelStates[i].transport)
+                s.close(i);
+        }
+        return true;
+    });
+}
+
+void HttpClient::setKeepAliveEnabled(bool enabled)
+{
+    _keepAliveEnabled = enabled;
+}
+
+HttpClient::ConnectionStats HttpClient::getConnectionStats() const
+{
+    ConnectionStats stats;
+    stats.requests          = _requestCount;
+    stats.connectionsOpened = _connectionsOpened;
+    stats.connectionsReused = _connectionsReused;
+    if (stats.connectionsOpened > 0)
+        stats.averageHandshakeMs = _handshakeMicros / 1000.0 / stats.connectionsOpened;
+    stats.handshakeMsSaved = stats.averageHandshakeMs * stats.connectionsReused;
+    return stats;
+}
+
+void HttpClient::resetConnectionStats()
+{
+    _requestCount      = 0;
+    _connectionsOpened = 0;
+    _connectionsReused = 0;
+    _handshakeMicros   = 0;
 }
 
 void HttpClient::setNameServers(std::string_view servers)
@@ -223,21 +267,21 @@ void HttpClient::processResponse(HttpResponse* response, int channelIndex)
 
     if (response->validateUri())
     {
+        if (channelIndex == -1 && _keepAliveEnabled)
+        {
+            // warm connections are only looked up on the network thread
+            _service->schedule(std::chrono::microseconds(0), [this, response](io_service&) {
+                dispatchResponse(response);
+                return true;
+            });
+            return;
+        }
+
         if (channelIndex == -1)
             channelIndex = tryTakeAvailChannel();
 
         if (channelIndex != -1)
-        {
-            auto channelHandle = _service->channel_at(channelIndex);
-            auto& requestUri = response->getRequestUri();
-            channelHandle->ud_.ptr = response;
-            _service->set_option(YOPT_C_REMOTE_ENDPOINT, channelIndex, requestUri.getHost().data(),
-                                 (int)requestUri.getPort());
-            if (requestUri.isSecure())
-                _service->open(channelIndex, YCK_SSL_CLIENT);
-            else
-                _service->open(channelIndex, YCK_TCP_CLIENT);
-        }
+            openChannel(response, channelIndex);
         else
             _pendingResponseQueue.emplace_back(response);
     }
@@ -245,18 +289,211 @@ void HttpClient::processResponse(HttpResponse* response, int channelIndex)
         finishResponse(response);
 }
 
+void HttpClient::dispatchResponse(HttpResponse* response)
+{
+    // prefer a connection kept alive for the same host
+    auto hostKey = makeHostKey(response->getRequestUri());
+    for (int i = 0; i < HttpClient::MAX_CHANNELS; ++i)
+    {
+        auto channel = _service->channel_at(i);
+        auto& state  = _channelStates[i];
+        if (!channel->ud_.ptr && state.transport && state.hostKey == hostKey)
+        {
+            channel->ud_.ptr = response;
+            state.reused     = true;
+            ++_connectionsReused;
+            sendRequest(response, channel, state.transport);
+            return;
+        }
+    }
+
+    int channelIndex = tryTakeAvailChannel();
+    if (channelIndex != -1)
+    {
+        openChannel(response, channelIndex);
+        return;
+    }
+
+    _pendingResponseQueue.emplace_back(response);
+
+    // every channel is taken, give up one that is only kept alive for another host,
+    // the pending response gets it once it is closed
+    for (int i = 0; i < HttpClient::MAX_CHANNELS; ++i)
+    {
+        if (!_service->channel_at(i)->ud_.ptr && _channelStates[i].transport)
+        {
+            _service->close(i);
+            break;
+        }
+    }
+}
+
+void HttpClient::openChannel(HttpResponse* response, int channelIndex)
+{
+    auto channelHandle = _service->channel_at(channelIndex);
+    auto& requestUri   = response->getRequestUri();
+    auto& state        = _channelStates[channelIndex];
+    state.hostKey      = makeHostKey(requestUri);
+    state.transport    = nullptr;
+    state.reused       = false;
+    state.openTime     = std::chrono::steady_clock::now();
+
+    channelHandle->ud_.ptr = response;
+    _service->set_option(YOPT_C_REMOTE_ENDPOINT, channelIndex, requestUri.getHost().data(), (int)requestUri.getPort());
+    if (requestUri.isSecure())
+        _service->open(channelIndex, YCK_SSL_CLIENT);
+    else
+        _service->open(channelIndex, YCK_TCP_CLIENT);
+}
+
+void HttpClient::sendRequest(HttpResponse* response, yasio::io_channel* channel, yasio::transport_handle_t transport)
+{
+    obstream obs;
+    bool usePostData = false;
+    auto request     = response->getHttpRequest();
+    switch (request->getRequestType())
+    {
+    case HttpRequest::Type::GET:
+        obs.write_bytes("GET");
+        break;
+    case HttpRequest::Type::PATCH:
+        obs.write_bytes("PATCH");
+        usePostData = true;
+        break;
+    case HttpRequest::Type::POST:
+        obs.write_bytes("POST");
+        usePostData = true;
+        break;
+    case HttpRequest::Type::DELETE:
+        obs.write_bytes("DELETE");
+        break;
+    case HttpRequest::Type::PUT:
+        obs.write_bytes("PUT");
+        usePostData = true;
+        break;
+    default:
+        obs.write_bytes("GET");
+        break;
+    }
+    obs.write_bytes(" ");
+
+    auto& uri = response->getRequestUri();
+    obs.write_bytes(uri.getPathEtc());
+
+    obs.write_bytes(" HTTP/1.1\r\n");
+
+    obs.write_bytes("Host: ");
+    obs.write_bytes(uri.getHost());
+    obs.write_bytes("\r\n");
+
+    // process custom headers
+    struct HeaderFlag
+    {
+        enum
+        {
+            UESR_AGENT      = 1,
+            CONTENT_TYPE    = 1 << 1,
+            ACCEPT          = 1 << 2,
+            ACCEPT_ENCODING = 1 << 3,
+            CONNECTION      = 1 << 4,
+        };
+    };
+    int headerFlags = 0;
+    auto& headers   = request->getHeaders();
+    if (!headers.empty())
+    {
+        using namespace cxx17;  // for string_view literal
+        for (auto&& header : headers)
+        {
+            obs.write_bytes(header);
+            obs.write_bytes("\r\n");
+
+            if (cxx20::ic::starts_with(cxx17::string_view{header}, "User-Agent:"_sv))
+                headerFlags |= HeaderFlag::UESR_AGENT;
+            else if (cxx20::ic::starts_with(cxx17::string_view{header}, "Content-Type:"_sv))
+                headerFlags |= HeaderFlag::CONTENT_TYPE;
+            else if (cxx20::ic::starts_with(cxx17::string_view{header}, "Accept:"_sv))
+                headerFlags |= HeaderFlag::ACCEPT;
+            else if (cxx20::ic::starts_with(cxx17::string_view{header}, "Accept-Encoding:"_sv))
+                headerFlags |= HeaderFlag::ACCEPT_ENCODING;
+            else if (cxx20::ic::starts_with(cxx17::string_view{header}, "Connection:"_sv))
+                headerFlags |= HeaderFlag::CONNECTION;
+        }
+    }
+
+    if (_cookie)
+    {
+        auto cookies = _cookie->checkAndGetFormatedMatchCookies(uri);
+        if (!cookies.empty())
+        {
+            obs.write_bytes("Cookie: ");
+            obs.write_bytes(cookies);
+        }
+    }
+
+    if (!(headerFlags & HeaderFlag::UESR_AGENT))
+        obs.write_bytes("User-Agent: yasio-http\r\n");
+
+    if (!(headerFlags & HeaderFlag::ACCEPT))
+        obs.write_bytes("Accept: */*;q=0.8\r\n");
+
+    if (_gzipEnabled && !(headerFlags & HeaderFlag::ACCEPT_ENCODING))
+        obs.write_bytes("Accept-Encoding: gzip\r\n");
+
+    if (!_keepAliveEnabled && !(headerFlags & HeaderFlag::CONNECTION))
+        obs.write_bytes("Connection: close\r\n");
+
+    if (usePostData)
+    {
+        if (!(headerFlags & HeaderFlag::CONTENT_TYPE))
+            obs.write_bytes("Content-Type: application/x-www-form-urlencoded;charset=UTF-8\r\n");
+
+        char strContentLength[128] = {0};
+        auto requestData           = request->getRequestData();
+        auto requestDataSize       = request->getRequestDataSize();
+        snprintf(strContentLength, sizeof(strContentLength), "Content-Length: %d\r\n\r\n",
+                 static_cast<int>(requestDataSize));
+        obs.write_bytes(strContentLength);
+
+        if (requestData && requestDataSize > 0)
+            obs.write_bytes(cxx17::string_view{requestData, static_cast<size_t>(requestDataSize)});
+    }
+    else
+    {
+        obs.write_bytes("\r\n");
+    }
+
+    ++_requestCount;
+    _service->write(transport, std::move(obs.buffer()));
+
+    int channelIndex   = channel->index();
+    auto& timerForRead = channel->get_user_timer();
+    timerForRead.cancel();
+    timerForRead.expires_from_now(std::chrono::seconds(this->_timeoutForRead));
+    timerForRead.async_wait([response, channelIndex](io_service& s) {
+        response->updateInternalCode(yasio::errc::read_timeout);
+        s.close(channelIndex);  // timeout
+        return true;
+    });
+}
+
 void HttpClient::handleNetworkEvent(yasio::io_event* event)
 {
     int channelIndex       = event->cindex();
     auto channel           = _service->channel_at(event->cindex());
     HttpResponse* response = (HttpResponse*)channel->ud_.ptr;
-    assert(response);
+    auto& state            = _channelStates[channelIndex];
 
-    bool responseFinished = response->isFinished();
     switch (event->kind())
     {
     case YEK_ON_PACKET:
-        if (!responseFinished)
+        if (!response)
+        {
+            // nothing was asked on this kept alive connection
+            _service->close(channelIndex);
+            break;
+        }
+        if (!response->isFinished())
         {
             auto&& pkt = event->packet_view();
             response->handleInput(pkt.data(), pkt.size());
@@ -264,135 +501,136 @@ void HttpClient::handleNetworkEvent(yasio::io_event* event)
         if (response->isFinished())
         {
             response->updateInternalCode(yasio::errc::eof);
-            _service->close(event->cindex());
+            if (_keepAliveEnabled && response->shouldKeepAlive())
+                handleResponseComplete(response, channel);
+            else
+                _service->close(event->cindex());
         }
         break;
     case YEK_ON_OPEN:
         if (event->status() == 0)
         {
-            obstream obs;
-            bool usePostData = false;
-            auto request     = response->getHttpRequest();
-            switch (request->getRequestType())
-            {
-            case HttpRequest::Type::GET:
-                obs.write_bytes("GET");
-                break;
-            case HttpRequest::Type::PATCH:
-                obs.write_bytes("PATCH");
-                usePostData = true;
-                break;
-            case HttpRequest::Type::POST:
-                obs.write_bytes("POST");
-                usePostData = true;
-                break;
-            case HttpRequest::Type::DELETE:
-                obs.write_bytes("DELETE");
-                break;
-            case HttpRequest::Type::PUT:
-                obs.write_bytes("PUT");
-                usePostData = true;
-                break;
-            default:
-                obs.write_bytes("GET");
-                break;
-            }
-            obs.write_bytes(" ");
-
-            auto& uri = response->getRequestUri();
-            obs.write_bytes(uri.getPathEtc());
-
-            obs.write_bytes(" HTTP/1.1\r\n");
-
-            obs.write_bytes("Host: ");
-            obs.write_bytes(uri.getHost());
-            obs.write_bytes("\r\n");
-
-            // process custom headers
-            struct HeaderFlag
-            {
-                enum
-                {
-                    UESR_AGENT   = 1,
-                    CONTENT_TYPE = 1 << 1,
-                    ACCEPT       = 1 << 2,
-                };
-            };
-            int headerFlags = 0;
-            auto& headers   = request->getHeaders();
-            if (!headers.empty())
-            {
-                using namespace cxx17;  // for string_view literal
-                for (auto&& header : headers)
-                {
-                    obs.write_bytes(header);
-                    obs.write_bytes("\r\n");
-
-                    if (cxx20::ic::starts_with(cxx17::string_view{header}, "User-Agent:"_sv))
-                        headerFlags |= HeaderFlag::UESR_AGENT;
-                    else if (cxx20::ic::starts_with(cxx17::string_view{header}, "Content-Type:"_sv))
-                        headerFlags |= HeaderFlag::CONTENT_TYPE;
-                    else if (cxx20::ic::starts_with(cxx17::string_view{header}, "Accept:"_sv))
-                        headerFlags |= HeaderFlag::ACCEPT;
-                }
-            }
-
-            if (_cookie)
-            {
-                auto cookies = _cookie->checkAndGetFormatedMatchCookies(uri);
-                if (!cookies.empty())
-                {
-                    obs.write_bytes("Cookie: ");
-                    obs.write_bytes(cookies);
-                }
-            }
-
-            if (!(headerFlags & HeaderFlag::UESR_AGENT))
-                obs.write_bytes("User-Agent: yasio-http\r\n");
-
-            if (!(headerFlags & HeaderFlag::ACCEPT))
-                obs.write_bytes("Accept: */*;q=0.8\r\n");
-
-            if (usePostData)
-            {
-                if (!(headerFlags & HeaderFlag::CONTENT_TYPE))
-                    obs.write_bytes("Content-Type: application/x-www-form-urlencoded;charset=UTF-8\r\n");
-
-                char strContentLength[128] = {0};
-                auto requestData           = request->getRequestData();
-                auto requestDataSize       = request->getRequestDataSize();
-                snprintf(strContentLength, sizeof(strContentLength), "Content-Length: %d\r\n\r\n",
-                         static_cast<int>(requestDataSize));
-                obs.write_bytes(strContentLength);
-
-                if (requestData && requestDataSize > 0)
-                    obs.write_bytes(cxx17::string_view{requestData, static_cast<size_t>(requestDataSize)});
-            }
-            else
-            {
-                obs.write_bytes("\r\n");
-            }
-
-            _service->write(event->transport(), std::move(obs.buffer()));
-
-            auto& timerForRead = channel->get_user_timer();
-            timerForRead.cancel();
-            timerForRead.expires_from_now(std::chrono::seconds(this->_timeoutForRead));
-            timerForRead.async_wait([=](io_service& s) {
-                response->updateInternalCode(yasio::errc::read_timeout);
-                s.close(channelIndex);  // timeout
-                return true;
-            });
+            state.transport = event->transport();
+            ++_connectionsOpened;
+            _handshakeMicros += std::chrono::duration_cast<std::chrono::microseconds>(
+                                    std::chrono::steady_clock::now() - state.openTime)
+                                    .count();
+            sendRequest(response, channel, event->transport());
         }
         else
         {
+            state.hostKey.clear();
             handleNetworkEOF(response, channel, event->status());
         }
         break;
     case YEK_ON_CLOSE:
-        handleNetworkEOF(response, channel, event->status());
+    {
+        const bool reused = state.reused;
+        state.hostKey.clear();
+        state.transport = nullptr;
+        state.reused    = false;
+
+        if (!response)
+        {
+            // an idle connection timed out, was dropped by the server or given up for another host
+            channel->get_user_timer().cancel();
+            recycleChannel(channelIndex);
+        }
+        else if (reused && response->getResponseCode() == -1 && response->getResponseHeaders().empty() &&
+                 response->getResponseData()->empty())
+        {
+            // the server closed the kept alive connection before it saw the request, retry once on a new one
+            channel->get_user_timer().cancel();
+            openChannel(response, channelIndex);
+        }
+        else
+            handleNetworkEOF(response, channel, event->status());
         break;
     }
+    }
+}
+
+void HttpClient::handleResponseComplete(HttpResponse* response, yasio::io_channel* channel)
+{
+    channel->ud_.ptr = nullptr;
+    channel->get_user_timer().cancel();
+
+    switch (response->getResponseCode())
+    {
+    case 301:
+    case 302:
+    case 307:
+        if (response->tryRedirect())
+        {
+            // the location may be on another host, dispatch it like a new request
+            releaseConnection(channel);
+            dispatchResponse(response);
+            break;
+        }
+    default:
+        finishResponse(response);
+        releaseConnection(channel);
+    }
+}
+
+void HttpClient::releaseConnection(yasio::io_channel* channel)
+{
+    int channelIndex = channel->index();
+    auto& state      = _channelStates[channelIndex];
+
+    auto lck = _pendingResponseQueue.get_lock();
+    for (auto it = _pendingResponseQueue.unsafe_begin(); it != _pendingResponseQueue.unsafe_end(); ++it)
+    {
+        // queue the next request for the same host onto the warm connection
+        if (makeHostKey((*it)->getRequestUri()) == state.hostKey)
+        {
+            auto pendingResponse = *it;
+            _pendingResponseQueue.unsafe_erase(it);
+            lck.unlock();
+
+            channel->ud_.ptr = pendingResponse;
+            state.reused     = true;
+            ++_connectionsReused;
+            sendRequest(pendingResponse, channel, state.transport);
+            return;
+        }
+    }
+
+    if (!_pendingResponseQueue.unsafe_empty())
+    {
+        // a request for another host waits for a channel
+        lck.unlock();
+        _service->close(channelIndex);
+        return;
+    }
+    lck.unlock();
+
+    auto& timerForIdle = channel->get_user_timer();
+    timerForIdle.cancel();
+    timerForIdle.expires_from_now(std::chrono::seconds(this->_keepAliveTimeout));
+    timerForIdle.async_wait([channelIndex](io_service& s) {
+        s.close(channelIndex);  // idle timeout
+        return true;
+    });
+}
+
+void HttpClient::recycleChannel(int channelIndex)
+{
+    // try process pending response
+    auto lck = _pendingResponseQueue.get_lock();
+    if (!_pendingResponseQueue.unsafe_empty())
+    {
+        auto pendingResponse = _pendingResponseQueue.unsafe_front();
+        _pendingResponseQueue.unsafe_pop_front();
+        lck.unlock();
+
+        processResponse(pendingResponse, channelIndex);
+        pendingResponse->release();
+    }
+    else
+    {  // recycle channel
+        _availChannelQueue.push_front(channelIndex);
+    }
 }
 
 void HttpClient::handleNetworkEOF(HttpResponse* response, yasio::io_channel* channel, int internalErrorCode)
@@ -415,22 +653,7 @@ void HttpClient::handleNetworkEOF(HttpResponse* response, yasio::io_channel* cha
         }
     default:
         finishResponse(response);
-
-        // try process pending response
-        auto lck = _pendingResponseQueue.get_lock();
-        if (!_pendingResponseQueue.unsafe_empty())
-        {
-            auto pendingResponse = _pendingResponseQueue.unsafe_front();
-            _pendingResponseQueue.unsafe_pop_front();
-            lck.unlock();
-
-            processResponse(pendingResponse, channel->index());
-            pendingResponse->release();
-        }
-        else
-        {  // recycle channel
-            _availChannelQueue.push_front(channel->index());
-        }
+        recycleChannel(channel->index());
     }
 }
 
@@ -439,6 +662,9 @@ void HttpClient::finishResponse(HttpResponse* response)
     auto request   = response->getHttpRequest();
     auto syncState = request->getSyncState();
 
+    if (_gzipEnabled)
+        decodeResponseData(response);
+
     if (_cookie)
     {
         auto cookieRange = response->getResponseHeaders().equal_range("set-cookie");
@@ -459,6 +685,26 @@ void HttpClient::finishResponse(HttpResponse* response)
     }
 }
 
+void HttpClient::decodeResponseData(HttpResponse* response)
+{
+    auto iter = response->_responseHeaders.find("content-encoding");
+    if (iter == response->_responseHeaders.end() || !cxx20::ic::iequals(cxx17::string_view{iter->second}, "gzip"))
+        return;
+
+    auto& data = response->_responseData;
+    if (data.empty())
+        return;
+
+    auto decoded = ZipUtils::decompressGZ(data.data(), data.size());
+    if (decoded.empty())
+    {
+        AXLOGW("HttpClient: failed to inflate the gzip response of {}", response->getHttpRequest()->getUrl());
+        return;
+    }
+    auto first = reinterpret_cast<const char*>(decoded.data());
+    data.assign(first, first + decoded.size());
+}
+
 void HttpClient::invokeResposneCallbackAndRelease(HttpResponse* response)
 {
     HttpRequest* request                  = response->getHttpRequest();
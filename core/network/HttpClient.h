@@ -32,6 +32,8 @@
 #include <thread>
 #include <condition_variable>
 #include <deque>
+#include <atomic>
+#include <chrono>
 
 #include "base/Scheduler.h"
 #include "network/HttpRequest.h"
@@ -66,6 +68,18 @@ public:
      */
     static const int MAX_CHANNELS       = 21;
 
+    /**
+     * Connection reuse counters, see getConnectionStats().
+     */
+    struct ConnectionStats
+    {
+        uint64_t requests          = 0;  ///< requests written to a connection, redirects and retries included
+        uint64_t connectionsOpened = 0;  ///< connections established, TCP plus TLS for https
+        uint64_t connectionsReused = 0;  ///< requests sent on a connection kept alive from an earlier request
+        double averageHandshakeMs  = 0;  ///< average time to establish a connection, DNS lookup included
+        double handshakeMsSaved    = 0;  ///< estimated, connectionsReused * averageHandshakeMs
+    };
+
     /**
      * Get instance of HttpClient.
      *
@@ -150,6 +164,38 @@ public:
      */
     int getTimeoutForRead();
 
+    /**
+     * Keep connections open after a response so later requests to the same scheme, host and port skip the
+     * TCP and TLS handshakes. Enabled by default, servers answering with "Connection: close" are honored.
+     *
+     * @param enabled false to close every connection once its response finished.
+     */
+    void setKeepAliveEnabled(bool enabled);
+    bool isKeepAliveEnabled() const { return _keepAliveEnabled; }
+
+    /**
+     * Set how long an idle connection is kept open waiting for the next request.
+     *
+     * @param seconds the idle timeout in seconds, 15 by default.
+     */
+    void setKeepAliveTimeout(int seconds) { _keepAliveTimeout = seconds; }
+    int getKeepAliveTimeout() const { return _keepAliveTimeout; }
+
+    /**
+     * Ask servers for gzip compressed responses and inflate them before the callback runs.
+     * Requests setting their own Accept-Encoding header are sent unchanged.
+     *
+     * @param enabled true to send "Accept-Encoding: gzip", disabled by default.
+     */
+    void setGzipEnabled(bool enabled) { _gzipEnabled = enabled; }
+    bool isGzipEnabled() const { return _gzipEnabled; }
+
+    /**
+     * Get the connection reuse counters since the last resetConnectionStats().
+     */
+    ConnectionStats getConnectionStats() const;
+    void resetConnectionStats();
+
     HttpCookie* getCookie() const { return _cookie; }
 
     std::recursive_mutex& getCookieFileMutex() { return _cookieFileMutex; }
@@ -205,6 +251,21 @@ private:
 
     int tryTakeAvailChannel();
 
+    // network thread only, the response is already retained
+    void dispatchResponse(HttpResponse* response);
+
+    void openChannel(HttpResponse* response, int channelIndex);
+
+    void sendRequest(HttpResponse* response, yasio::io_channel* channel, yasio::transport_handle_t transport);
+
+    void handleResponseComplete(HttpResponse* response, yasio::io_channel* channel);
+
+    void releaseConnection(yasio::io_channel* channel);
+
+    void recycleChannel(int channelIndex);
+
+    void decodeResponseData(HttpResponse* response);
+
     void handleNetworkEvent(yasio::io_event* event);
 
     void handleNetworkEOF(HttpResponse* response, yasio::io_channel* channel, int internalErrorCode);
@@ -244,6 +305,25 @@ private:
     HttpCookie* _cookie;
 
     ClearResponsePredicate _clearResponsePredicate;
+
+    // the connection a channel holds, only touched on the network thread once the channel is opened
+    struct ChannelState
+    {
+        std::string hostKey;                           // scheme://host:port, empty while closed
+        yasio::transport_handle_t transport = nullptr;  // set while the connection is open
+        std::chrono::steady_clock::time_point openTime;
+        bool reused = false;  // the current request went out on a connection kept alive
+    };
+    ChannelState _channelStates[MAX_CHANNELS];
+
+    bool _keepAliveEnabled;
+    int _keepAliveTimeout;
+    bool _gzipEnabled;
+
+    std::atomic<uint64_t> _requestCount{0};
+    std::atomic<uint64_t> _connectionsOpened{0};
+    std::atomic<uint64_t> _connectionsReused{0};
+    std::atomic<uint64_t> _handshakeMicros{0};
 };
 
 }  // namespace network
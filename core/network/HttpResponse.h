@@ -144,6 +144,11 @@ private:
      */
     bool isFinished() const { return _finished; }
 
+    /**
+     * Whether the connection can carry the next request, only meaningful once the response completed.
+     */
+    bool shouldKeepAlive() const { return _responseCode != -1 && llhttp_should_keep_alive(&_context) != 0; }
+
     void handleInput(const char* d, size_t n)
     {
         enum llhttp_errno err = llhttp_execute(&_context, d, n);
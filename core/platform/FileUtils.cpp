@@ -36,6 +36,7 @@ THE SOFTWARE.
 #include "base/Director.h"
 #include "platform/SAXParser.h"
 #include "platform/FileStream.h"
+#include "base/ZipUtils.h"
 
 #ifdef MINIZIP_FROM_SYSTEM
 #    include <minizip/unzip.h>
@@ -46,8 +47,8 @@ THE SOFTWARE.
 
 #if defined(_WIN32)
 #    include "ntcvt/ntcvt.hpp"
-#    include "yasio/string_view.hpp"
 #endif
+#include "yasio/string_view.hpp"
 
 #include "pugixml/pugixml.hpp"
 
@@ -479,6 +480,65 @@ void FileUtils::setDelegate(FileUtils* delegate)
 std::string FileUtils::s_exeDir;
 #endif
 
+namespace
+{
+// a read only stream over an archive entry, inflated once at open so each stream owns its cursor
+class ArchiveEntryStream : public IFileStream
+{
+public:
+    explicit ArchiveEntryStream(std::vector<char>&& data) : _data(std::move(data)) {}
+
+    bool open(std::string_view /*path*/, IFileStream::Mode /*mode*/) override { return false; }
+    int close() override
+    {
+        _data.clear();
+        _data.shrink_to_fit();
+        _open = false;
+        return 0;
+    }
+
+    int64_t seek(int64_t offset, int origin) const override
+    {
+        int64_t pos = -1;
+        switch (origin)
+        {
+        case SEEK_SET:
+            pos = offset;
+            break;
+        case SEEK_CUR:
+            pos = _pos + offset;
+            break;
+        case SEEK_END:
+            pos = static_cast<int64_t>(_data.size()) + offset;
+            break;
+        default:;
+        }
+        if (pos < 0)
+            return -1;
+        _pos = pos;
+        return pos;
+    }
+    int read(void* buf, unsigned int size) const override
+    {
+        if (_pos >= static_cast<int64_t>(_data.size()))
+            return 0;
+        const auto n = static_cast<unsigned int>((std::min)(static_cast<int64_t>(size), static_cast<int64_t>(_data.size()) - _pos));
+        memcpy(buf, _data.data() + _pos, n);
+        _pos += n;
+        return static_cast<int>(n);
+    }
+    int write(const void* /*buf*/, unsigned int /*size*/) const override { return -1; }
+    int64_t tell() const override { return _pos; }
+    int64_t size() const override { return static_cast<int64_t>(_data.size()); }
+    bool isOpen() const override { return _open; }
+
+private:
+    std::vector<char> _data;
+    mutable int64_t _pos = 0;
+    bool _open           = true;
+};
+}  // namespace
+
 FileUtils::FileUtils() : _writablePath() {}
 
 FileUtils::~FileUtils() {}
@@ -584,6 +644,13 @@ FileUtils::Status FileUtils::getContents(std::string_view filename, ResizableBuf
 
     const auto fullPath = fileUtils->fullPathForFilename(filename);
 
+    Status archiveStatus = Status::NotExists;
+    if (visitArchiveEntry(fullPath, [&](ZipFile* archive, std::string_view entryName) {
+            if (archive->fileExists(entryName))
+                archiveStatus = archive->getFileData(entryName, buffer) ? Status::OK : Status::ReadFailed;
+        }))
+        return archiveStatus;
+
     FileStream fileStream;
     fileStream.open(fullPath, IFileStream::Mode::READ);
     if (!fileStream)
@@ -684,6 +751,25 @@ std::string FileUtils::fullPathForFilename(std::string_view filename) const
 
     std::string fullpath;
 
+    // files in mounted archives take priority over loose files, the list is only read under the lock since
+    // mountArchive may run on another thread
+    {
+        std::shared_lock<std::shared_mutex> lck(_mountedArchivesMutex);
+        for (const auto& mounted : _mountedArchives)
+        {
+            if (!cxx20::starts_with(filename, cxx17::string_view{mounted.mountPoint}))
+                continue;
+            auto entryName = filename.substr(mounted.mountPoint.size());
+            if (mounted.archive->fileExists(entryName))
+            {
+                fullpath.reserve(mounted.fullPath.size() + entryName.size() + 1);
+                fullpath.append(mounted.fullPath).append(1, '/').append(entryName);
+                _fullPathCache.emplace(filename, fullpath);
+                return fullpath;
+            }
+        }
+    }
+
     for (const auto& searchIt : _searchPathArray)
     {
         fullpath = this->getPathForFilename(filename, searchIt);
@@ -840,6 +926,68 @@ void FileUtils::setSearchPaths(const std::vector<std::string>& searchPaths)
     }
 }
 
+bool FileUtils::mountArchive(std::string_view archivePath, std::string_view mountPoint)
+{
+    auto fullPath = fullPathForFilename(archivePath);
+    if (fullPath.empty())
+        return false;
+
+    std::shared_ptr<ZipFile> archive{ZipFile::createFromFile(fullPath)};
+    if (!archive)
+    {
+        AXLOGW("mountArchive: {} isn't a valid zip archive", fullPath);
+        return false;
+    }
+
+    std::string prefix{mountPoint};
+    if (!prefix.empty() && prefix.back() != '/')
+        prefix += '/';
+
+    {
+        std::unique_lock<std::shared_mutex> lck(_mountedArchivesMutex);
+        _mountedArchives.insert(_mountedArchives.begin(),
+                                MountedArchive{std::string{archivePath}, std::move(fullPath), std::move(prefix),
+                                               std::move(archive)});
+    }
+
+    _fullPathCache.clear();
+    return true;
+}
+
+bool FileUtils::unmountArchive(std::string_view archivePath)
+{
+    std::shared_ptr<ZipFile> archive;
+    {
+        std::unique_lock<std::shared_mutex> lck(_mountedArchivesMutex);
+        auto it = std::find_if(_mountedArchives.begin(), _mountedArchives.end(),
+                               [archivePath](const MountedArchive& mounted) { return mounted.archivePath == archivePath; });
+        if (it == _mountedArchives.end())
+            return false;
+        archive = std::move(it->archive);
+        _mountedArchives.erase(it);
+    }
+
+    _fullPathCache.clear();
+    return true;
+}
+
+bool FileUtils::visitArchiveEntry(std::string_view fullPath,
+                                  const std::function<void(ZipFile*, std::string_view)>& visitor) const
+{
+    std::shared_lock<std::shared_mutex> lck(_mountedArchivesMutex);
+    for (const auto& mounted : _mountedArchives)
+    {
+        const auto& archivePath = mounted.fullPath;
+        if (fullPath.size() > archivePath.size() && fullPath[archivePath.size()] == '/' &&
+            cxx20::starts_with(fullPath, cxx17::string_view{archivePath}))
+        {
+            visitor(mounted.archive.get(), fullPath.substr(archivePath.size() + 1));
+            return true;
+        }
+    }
+    return false;
+}
+
 void FileUtils::addSearchPath(std::string_view searchpath, const bool front)
 {
     std::string path;
@@ -899,6 +1047,10 @@ bool FileUtils::isFileExist(std::string_view filename) const
 {
     if (isAbsolutePath(filename))
     {
+        bool exists = false;
+        if (visitArchiveEntry(filename,
+                              [&](ZipFile* archive, std::string_view entryName) { exists = archive->fileExists(entryName); }))
+            return exists;
         return isFileExistInternal(filename);
     }
     else
@@ -1037,6 +1189,15 @@ void FileUtils::listFilesRecursivelyAsync(std::string_view dirPath,
 
 std::unique_ptr<IFileStream> FileUtils::openFileStream(std::string_view filePath, IFileStream::Mode mode) const
 {
+    std::unique_ptr<IFileStream> entryStream;
+    if (mode == IFileStream::Mode::READ && visitArchiveEntry(filePath, [&](ZipFile* archive, std::string_view entryName) {
+            std::vector<char> data;
+            ResizableBufferAdapter<std::vector<char>> buffer(&data);
+            if (archive->getFileData(entryName, &buffer))
+                entryStream = std::make_unique<ArchiveEntryStream>(std::move(data));
+        }))
+        return entryStream;
+
     FileStream fs;
     return fs.open(filePath, mode) ? std::make_unique<FileStream>(std::move(fs)) : nullptr;
 }
@@ -1295,6 +1456,12 @@ int64_t FileUtils::getFileSize(std::string_view filepath) const
     else
         path = filepath;
 
+    int64_t archiveEntrySize = -1;
+    if (visitArchiveEntry(path, [&](ZipFile* archive, std::string_view entryName) {
+            archiveEntrySize = archive->getFileSize(entryName);
+        }))
+        return archiveEntrySize;
+
     struct stat info;
     // Get data associated with "crt_stat.c":
     int result = ::stat(path.data(), &info);
@@ -32,7 +32,9 @@ THE SOFTWARE.
 #include <unordered_map>
 #include <type_traits>
 #include <mutex>
+#include <shared_mutex>
 #include <memory>
+#include <functional>
 
 #include "platform/IFileStream.h"
 #include "platform/PlatformMacros.h"
@@ -48,6 +50,8 @@ THE SOFTWARE.
 namespace ax
 {
 
+class ZipFile;
+
 /**
  * @addtogroup platform
  * @{
@@ -330,6 +334,28 @@ public:
      */
     void addSearchPath(std::string_view path, const bool front = false);
 
+    /**
+     * Mounts a zip/pak archive as a virtual directory.
+     *
+     * Files found in a mounted archive take priority over loose files in the search paths, the most recently
+     * mounted archive wins. An archive entry resolves to the full path "<archive full path>/<entry name>", which
+     * getContents, getFileSize, isFileExist and openFileStream accept from any thread.
+     *
+     * @param archivePath The archive file, relative to the search paths or absolute.
+     * @param mountPoint The relative path the archive root is mounted at, e.g. with "ui/" the file "ui/a.png" is
+     *        looked up as the entry "a.png". Empty mounts the archive root at the resource root.
+     * @return true if the archive was opened and mounted.
+     */
+    bool mountArchive(std::string_view archivePath, std::string_view mountPoint = ""sv);
+
+    /**
+     * Unmounts an archive mounted with mountArchive.
+     *
+     * @param archivePath The same path passed to mountArchive.
+     * @return true if the archive was mounted.
+     */
+    bool unmountArchive(std::string_view archivePath);
+
     /**
      *  Gets the array of search paths.
      *
@@ -836,6 +862,30 @@ protected:
     virtual std::string getFullPathForFilenameWithinDirectory(std::string_view directory,
                                                               std::string_view filename) const;
 
+    /**
+     *  Calls visitor with the mounted archive and the entry name when the full path points into a mounted archive.
+     *  The archive stays mounted for the duration of the call.
+     *
+     *  @return false if the full path doesn't belong to a mounted archive.
+     */
+    bool visitArchiveEntry(std::string_view fullPath,
+                           const std::function<void(ZipFile*, std::string_view)>& visitor) const;
+
+    struct MountedArchive
+    {
+        std::string archivePath;  // as passed to mountArchive
+        std::string fullPath;
+        std::string mountPoint;
+        std::shared_ptr<ZipFile> archive;
+    };
+
+    /**
+     * The mounted archives, the lower index the higher priority. Guarded by _mountedArchivesMutex since archive
+     * entries may be read from worker threads.
+     */
+    std::vector<MountedArchive> _mountedArchives;
+    mutable std::shared_mutex _mountedArchivesMutex;
+
     /**
      * The vector contains search paths.
      * The lower index of the element in this vector, the higher priority for this search path.
@@ -1309,7 +1309,26 @@ bool Image::initWithPngData(uint8_t* data, ssize_t dataLen)
         {
             row_pointers[i] = _data + i * rowbytes;
         }
-        png_read_image(png_ptr, row_pointers);
+
+        // premultiply each row right after it's decoded, while it's still in cache. interlaced images only have
+        // final rows after the last pass, so they are premultiplied as a whole afterwards
+        const bool premultiplyRows = AX_ENABLE_PREMULTIPLIED_ALPHA && PNG_PREMULTIPLIED_ALPHA_ENABLED &&
+                                     (color_type == PNG_COLOR_TYPE_RGB_ALPHA || color_type == PNG_COLOR_TYPE_GRAY_ALPHA) &&
+                                     png_get_interlace_type(png_ptr, info_ptr) == PNG_INTERLACE_NONE;
+        if (premultiplyRows)
+        {
+            for (unsigned short i = 0; i < _height; ++i)
+            {
+                png_read_row(png_ptr, row_pointers[i], nullptr);
+                if (_pixelFormat == backend::PixelFormat::RGBA8)
+                    backend::PixelFormatUtils::premultiplyAlphaRGBA8(row_pointers[i], _width);
+                else
+                    backend::PixelFormatUtils::premultiplyAlphaRG8(row_pointers[i], _width);
+            }
+            _hasPremultipliedAlpha = true;
+        }
+        else
+            png_read_image(png_ptr, row_pointers);
 
         png_read_end(png_ptr, nullptr);
 
@@ -1318,7 +1337,8 @@ bool Image::initWithPngData(uint8_t* data, ssize_t dataLen)
         {
             if (PNG_PREMULTIPLIED_ALPHA_ENABLED)
             {
-                premultiplyAlpha();
+                if (!premultiplyRows)
+                    premultiplyAlpha();
             }
             else
             {
@@ -2621,23 +2641,10 @@ void Image::premultiplyAlpha()
              || (_pixelFormat == backend::PixelFormat::RG8),
               "The pixel format should be RGBA8888 or RG88.");
 
-    if (_pixelFormat ==  backend::PixelFormat::RGBA8) {
-        unsigned int* fourBytes = (unsigned int*)_data;
-        for (int i = 0; i < _width * _height; i++)
-        {
-            uint8_t* p   = _data + i * 4;
-            fourBytes[i] = AX_RGB_PREMULTIPLY_ALPHA(p[0], p[1], p[2], p[3]);
-        }
-    }
+    if (_pixelFormat ==  backend::PixelFormat::RGBA8)
+        backend::PixelFormatUtils::premultiplyAlphaRGBA8(_data, static_cast<size_t>(_width) * _height);
     else
-    {
-        uint16_t* twoBytes = (uint16_t*)_data;
-        for (int i = 0; i < _width * _height; i++)
-        {
-            uint8_t* p   = _data + i * 2;
-            twoBytes[i] = ((p[0] * p[1] + 1) >> 8) | (p[1] << 8);
-        }
-    }
+        backend::PixelFormatUtils::premultiplyAlphaRG8(_data, static_cast<size_t>(_width) * _height);
 
     _hasPremultipliedAlpha = true;
 #else
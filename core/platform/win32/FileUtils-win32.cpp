@@ -26,6 +26,7 @@ THE SOFTWARE.
 ****************************************************************************/
 #include "platform/win32/FileUtils-win32.h"
 #include "platform/Common.h"
+#include "base/ZipUtils.h"
 #include <Shlobj.h>
 #include <cstdlib>
 #include <regex>
@@ -153,6 +154,13 @@ int64_t FileUtilsWin32::getFileSize(std::string_view filepath) const
 {
     if (filepath.empty())
         return -1;
+
+    int64_t archiveEntrySize = -1;
+    if (visitArchiveEntry(filepath, [&](ZipFile* archive, std::string_view entryName) {
+            archiveEntrySize = archive->getFileSize(entryName);
+        }))
+        return archiveEntrySize;
+
     WIN32_FILE_ATTRIBUTE_DATA attrs = {0};
     if (GetFileAttributesExW(ntcvt::from_chars(filepath).c_str(), GetFileExInfoStandard, &attrs) &&
         !(attrs.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY))
@@ -28,6 +28,7 @@ THE SOFTWARE.
 #include <regex>
 #include "platform/winrt/WinRTUtils.h"
 #include "platform/Common.h"
+#include "base/ZipUtils.h"
 #include "ntcvt/ntcvt.hpp"
 
 #include <winrt/Windows.Storage.h>
@@ -123,6 +124,20 @@ std::string FileUtilsWinRT::getFullPathForFilenameWithinDirectory(std::string_vi
 
 int64_t FileUtilsWinRT::getFileSize(std::string_view filepath) const
 {
+    std::string fullPath;
+    if (!isAbsolutePath(filepath))
+    {
+        fullPath = fullPathForFilename(filepath);
+        if (!fullPath.empty())
+            filepath = fullPath;
+    }
+
+    int64_t archiveEntrySize = -1;
+    if (visitArchiveEntry(filepath, [&](ZipFile* archive, std::string_view entryName) {
+            archiveEntrySize = archive->getFileSize(entryName);
+        }))
+        return archiveEntrySize;
+
     WIN32_FILE_ATTRIBUTE_DATA fad;
     if (!GetFileAttributesEx(ntcvt::from_chars(filepath).c_str(), GetFileExInfoStandard, &fad))
     {
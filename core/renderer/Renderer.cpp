@@ -26,6 +26,7 @@
 #include "renderer/Renderer.h"
 
 #include <algorithm>
+#include <cstring>
 
 #include "renderer/TrianglesCommand.h"
 #include "renderer/CustomCommand.h"
@@ -53,14 +54,17 @@ namespace ax
 {
 
 // helper
-static bool compareRenderCommand(RenderCommand* a, RenderCommand* b)
+// maps a float to an unsigned integer that sorts in the same order
+static inline uint32_t orderedFloatBits(float value)
 {
-    return a->getGlobalOrder() < b->getGlobalOrder();
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
 }
 
-static bool compare3DCommand(RenderCommand* a, RenderCommand* b)
+static inline uint64_t makeSortKey(uint32_t order, size_t index)
 {
-    return a->getDepth() > b->getDepth();
+    return (static_cast<uint64_t>(order) << 32) | static_cast<uint32_t>(index);
 }
 
 // queue
@@ -71,11 +75,15 @@ void RenderQueue::emplace_back(RenderCommand* command)
     float z = command->getGlobalOrder();
     if (z < 0)
     {
-        _commands[QUEUE_GROUP::GLOBALZ_NEG].emplace_back(command);
+        auto& commands = _commands[QUEUE_GROUP::GLOBALZ_NEG];
+        _sortKeys[QUEUE_GROUP::GLOBALZ_NEG].emplace_back(makeSortKey(orderedFloatBits(z), commands.size()));
+        commands.emplace_back(command);
     }
     else if (z > 0)
     {
-        _commands[QUEUE_GROUP::GLOBALZ_POS].emplace_back(command);
+        auto& commands = _commands[QUEUE_GROUP::GLOBALZ_POS];
+        _sortKeys[QUEUE_GROUP::GLOBALZ_POS].emplace_back(makeSortKey(orderedFloatBits(z), commands.size()));
+        commands.emplace_back(command);
     }
     else
     {
@@ -83,7 +91,11 @@ void RenderQueue::emplace_back(RenderCommand* command)
         {
             if (command->isTransparent())
             {
-                _commands[QUEUE_GROUP::TRANSPARENT_3D].emplace_back(command);
+                // farthest first
+                auto& commands = _commands[QUEUE_GROUP::TRANSPARENT_3D];
+                _sortKeys[QUEUE_GROUP::TRANSPARENT_3D].emplace_back(
+                    makeSortKey(~orderedFloatBits(command->getDepth()), commands.size()));
+                commands.emplace_back(command);
             }
             else
             {
@@ -111,12 +123,31 @@ ssize_t RenderQueue::size() const
 void RenderQueue::sort()
 {
     // Don't sort _queue0, it already comes sorted
-    std::stable_sort(std::begin(_commands[QUEUE_GROUP::TRANSPARENT_3D]),
-                     std::end(_commands[QUEUE_GROUP::TRANSPARENT_3D]), compare3DCommand);
-    std::stable_sort(std::begin(_commands[QUEUE_GROUP::GLOBALZ_NEG]), std::end(_commands[QUEUE_GROUP::GLOBALZ_NEG]),
-                     compareRenderCommand);
-    std::stable_sort(std::begin(_commands[QUEUE_GROUP::GLOBALZ_POS]), std::end(_commands[QUEUE_GROUP::GLOBALZ_POS]),
-                     compareRenderCommand);
+    sortSubQueue(QUEUE_GROUP::TRANSPARENT_3D);
+    sortSubQueue(QUEUE_GROUP::GLOBALZ_NEG);
+    sortSubQueue(QUEUE_GROUP::GLOBALZ_POS);
+}
+
+void RenderQueue::sortSubQueue(QUEUE_GROUP group)
+{
+    auto& keys     = _sortKeys[group];
+    auto& commands = _commands[group];
+    AXASSERT(keys.size() == commands.size(), "sort keys out of sync with the commands");
+
+    // commands mostly arrive in order already, e.g. a whole layer shares one global z
+    if (std::is_sorted(keys.begin(), keys.end()))
+        return;
+
+    // the index in the low bits makes every key unique, so the result matches a stable sort
+    std::sort(keys.begin(), keys.end());
+
+    _sortedCommands.resize(commands.size());
+    for (size_t i = 0, count = keys.size(); i < count; ++i)
+    {
+        _sortedCommands[i] = commands[static_cast<uint32_t>(keys[i])];
+        keys[i]            = makeSortKey(static_cast<uint32_t>(keys[i] >> 32), i);
+    }
+    commands.swap(_sortedCommands);
 }
 
 RenderCommand* RenderQueue::operator[](ssize_t index) const
@@ -140,6 +171,7 @@ void RenderQueue::clear()
     for (int i = 0; i < QUEUE_GROUP::QUEUE_COUNT; ++i)
     {
         _commands[i].clear();
+        _sortKeys[i].clear();
     }
 }
 
@@ -149,6 +181,8 @@ void RenderQueue::realloc(size_t reserveSize)
     {
         _commands[i].clear();
         _commands[i].reserve(reserveSize);
+        _sortKeys[i].clear();
+        _sortKeys[i].reserve(reserveSize);
     }
 }
 
@@ -177,9 +211,9 @@ Renderer::~Renderer()
 {
     _renderGroups.clear();
 
-    for (auto&& clearCommand : _callbackCommandsPool)
-        delete clearCommand;
-    _callbackCommandsPool.clear();
+    for (auto&& block : _callbackCommandBlocks)
+        delete[] block;
+    _callbackCommandBlocks.clear();
 
     for (auto&& clearCommand : _groupCommandPool)
         delete clearCommand;
@@ -342,7 +376,6 @@ void Renderer::processRenderCommand(RenderCommand* command)
     case RenderCommand::Type::CALLBACK_COMMAND:
         flush();
         static_cast<CallbackCommand*>(command)->execute();
-        _callbackCommandsPool.emplace_back(static_cast<CallbackCommand*>(command));
         break;
     default:
         assert(false);
@@ -453,6 +486,28 @@ void Renderer::clean()
 
     // Clear batch commands
     _queuedTriangleCommands.clear();
+
+    // Recycle the callback commands, dropping their captures right away
+    for (size_t i = 0; i < _usedCallbackCommands; ++i)
+        _callbackCommandBlocks[i / CALLBACK_COMMAND_BLOCK_SIZE][i % CALLBACK_COMMAND_BLOCK_SIZE].func = nullptr;
+    _usedCallbackCommands = 0;
+}
+
+void Renderer::discard()
+{
+    // render() returns the group commands to the pool as it executes them
+    for (auto&& renderqueue : _renderGroups)
+    {
+        for (int i = 0; i < RenderQueue::QUEUE_COUNT; ++i)
+        {
+            for (auto* command : renderqueue.getSubQueue(static_cast<RenderQueue::QUEUE_GROUP>(i)))
+            {
+                if (command->getType() == RenderCommand::Type::GROUP_COMMAND)
+                    _groupCommandPool.emplace_back(static_cast<GroupCommand*>(command));
+            }
+        }
+    }
+    clean();
 }
 
 void Renderer::setDepthTest(bool value)
@@ -893,15 +948,13 @@ void Renderer::clear(ClearFlag flags, const Color4F& color, float depth, unsigne
 
 CallbackCommand* Renderer::nextCallbackCommand()
 {
-    CallbackCommand* cmd = nullptr;
-    if (!_callbackCommandsPool.empty())
-    {
-        cmd = _callbackCommandsPool.back();
-        cmd->reset();
-        _callbackCommandsPool.pop_back();
-    }
-    else
-        cmd = new CallbackCommand();
+    const size_t block = _usedCallbackCommands / CALLBACK_COMMAND_BLOCK_SIZE;
+    if (block == _callbackCommandBlocks.size())
+        _callbackCommandBlocks.emplace_back(new CallbackCommand[CALLBACK_COMMAND_BLOCK_SIZE]);
+
+    auto cmd = &_callbackCommandBlocks[block][_usedCallbackCommands % CALLBACK_COMMAND_BLOCK_SIZE];
+    ++_usedCallbackCommands;
+    cmd->reset();
     return cmd;
 }
 
@@ -71,7 +71,7 @@ class Texture2D;
  the correct order, the only `RenderCommand` objects that need to be sorted,
  are the ones that have `z < 0` and `z > 0`.
 */
-class RenderQueue
+class AX_DLL RenderQueue
 {
 public:
     /**
@@ -113,8 +113,16 @@ public:
     ssize_t getSubQueueSize(QUEUE_GROUP group) const { return _commands[group].size(); }
 
 protected:
+    /**Sorts a sub group by its keys, ties keep their submission order.*/
+    void sortSubQueue(QUEUE_GROUP group);
+
     /**The commands in the render queue.*/
     std::vector<RenderCommand*> _commands[QUEUE_COUNT];
+    /**Sort keys of the sorted groups, the order in the high 32 bits and the index in _commands in the low 32 bits.
+     Kept next to each other so sorting never touches the commands themselves.*/
+    std::vector<uint64_t> _sortKeys[QUEUE_COUNT];
+    /**Scratch buffer used to apply the sorted order.*/
+    std::vector<RenderCommand*> _sortedCommands;
 
     /**Cull state.*/
     bool _isCullEnabled;
@@ -175,6 +183,9 @@ public:
     /** Cleans all `RenderCommand`s in the queue */
     void clean();
 
+    /** Drops all the queued `RenderCommand`s without rendering them */
+    void discard();
+
     /* returns the number of drawn batches in the last frame */
     ssize_t getDrawnBatches() const { return _drawnBatches; }
     /* RenderCommands (except) TrianglesCommand should update this value */
@@ -503,8 +514,11 @@ protected:
 
     std::vector<TrianglesCommand*> _queuedTriangleCommands;
 
-    // the pool for callback commands
-    std::vector<CallbackCommand*> _callbackCommandsPool;
+    // callback commands only live until the end of render(), they are handed out from contiguous
+    // blocks that are reused every frame instead of being allocated one by one
+    static constexpr size_t CALLBACK_COMMAND_BLOCK_SIZE = 256;
+    std::vector<CallbackCommand*> _callbackCommandBlocks;
+    size_t _usedCallbackCommands = 0;
 
     std::vector<GroupCommand*> _groupCommandPool;
 
@@ -25,6 +25,14 @@
 
 #include "PixelFormatUtils.h"
 #include "Macros.h"
+#include "platform/PlatformConfig.h"
+
+// 32 bits arm builds only get NEON at runtime, see MathUtil
+#if defined(AX_SSE_INTRINSICS)
+#    define AX_PIXEL_SSE 1
+#elif defined(AX_NEON_INTRINSICS) && (AX_64BITS || AX_NEON_INTRINSICS > 1)
+#    define AX_PIXEL_NEON 1
+#endif
 
 namespace ax
 {
@@ -114,6 +122,48 @@ uint32_t computeRowPitch(PixelFormat format, uint32_t width)
     return 0;
 }
 
+//////////////////////////////////////////////////////////////////////////
+// SIMD kernels, they process whole blocks of pixels and leave the tail to the scalar loops
+
+#if defined(AX_PIXEL_SSE)
+// 4 RGBA8 pixels in 32 bits lanes -> RGB565 in the low 16 bits, sign extended for _mm_packs_epi32
+static inline __m128i packRGBA8ToRGB565(__m128i v)
+{
+    const __m128i r = _mm_slli_epi32(_mm_and_si128(v, _mm_set1_epi32(0xF8)), 8);
+    const __m128i g = _mm_and_si128(_mm_srli_epi32(v, 5), _mm_set1_epi32(0x07E0));
+    const __m128i b = _mm_and_si128(_mm_srli_epi32(v, 19), _mm_set1_epi32(0x1F));
+    const __m128i c = _mm_or_si128(_mm_or_si128(r, g), b);
+    return _mm_srai_epi32(_mm_slli_epi32(c, 16), 16);
+}
+
+// 4 RGBA8 pixels in 32 bits lanes -> RGBA4 in the low 16 bits, sign extended for _mm_packs_epi32
+static inline __m128i packRGBA8ToRGBA4(__m128i v)
+{
+    const __m128i r = _mm_slli_epi32(_mm_and_si128(v, _mm_set1_epi32(0xF0)), 8);
+    const __m128i g = _mm_and_si128(_mm_srli_epi32(v, 4), _mm_set1_epi32(0x0F00));
+    const __m128i b = _mm_and_si128(_mm_srli_epi32(v, 16), _mm_set1_epi32(0xF0));
+    const __m128i a = _mm_srli_epi32(v, 28);
+    const __m128i c = _mm_or_si128(_mm_or_si128(r, g), _mm_or_si128(b, a));
+    return _mm_srai_epi32(_mm_slli_epi32(c, 16), 16);
+}
+
+// 2 RGBA8 pixels in 16 bits lanes, (c * (a + 1)) >> 8 like AX_RGB_PREMULTIPLY_ALPHA
+static inline __m128i premultiplyRGBA16(__m128i c)
+{
+    __m128i a = _mm_shufflelo_epi16(c, _MM_SHUFFLE(3, 3, 3, 3));
+    a         = _mm_shufflehi_epi16(a, _MM_SHUFFLE(3, 3, 3, 3));
+    return _mm_srli_epi16(_mm_mullo_epi16(c, _mm_add_epi16(a, _mm_set1_epi16(1))), 8);
+}
+#elif defined(AX_PIXEL_NEON)
+// (c * (a + 1)) >> 8 like AX_RGB_PREMULTIPLY_ALPHA
+static inline uint8x16_t premultiplyChannel(uint8x16_t c, uint8x16_t a)
+{
+    const uint16x8_t lo = vaddw_u8(vmull_u8(vget_low_u8(c), vget_low_u8(a)), vget_low_u8(c));
+    const uint16x8_t hi = vaddw_u8(vmull_u8(vget_high_u8(c), vget_high_u8(a)), vget_high_u8(c));
+    return vcombine_u8(vshrn_n_u16(lo, 8), vshrn_n_u16(hi, 8));
+}
+#endif
+
 //////////////////////////////////////////////////////////////////////////
 // convertor function
 
@@ -286,7 +336,31 @@ static void convertRGB8ToRGB565(const unsigned char* data, size_t dataLen, unsig
 static void convertRGBA8ToRGB565(const unsigned char* data, size_t dataLen, unsigned char* outData)
 {
     unsigned short* out16 = (unsigned short*)outData;
-    for (ssize_t i = 0, l = dataLen - 3; i < l; i += 4)
+    ssize_t i             = 0;
+#if defined(AX_PIXEL_SSE)
+    for (; i + 32 <= (ssize_t)dataLen; i += 32, out16 += 8)
+    {
+        const __m128i v0 = _mm_loadu_si128((const __m128i*)(data + i));
+        const __m128i v1 = _mm_loadu_si128((const __m128i*)(data + i + 16));
+        _mm_storeu_si128((__m128i*)out16, _mm_packs_epi32(packRGBA8ToRGB565(v0), packRGBA8ToRGB565(v1)));
+    }
+#elif defined(AX_PIXEL_NEON)
+    for (; i + 64 <= (ssize_t)dataLen; i += 64, out16 += 16)
+    {
+        const uint8x16x4_t px = vld4q_u8(data + i);
+        for (int half = 0; half < 2; ++half)
+        {
+            const auto r = half ? vget_high_u8(px.val[0]) : vget_low_u8(px.val[0]);
+            const auto g = half ? vget_high_u8(px.val[1]) : vget_low_u8(px.val[1]);
+            const auto b = half ? vget_high_u8(px.val[2]) : vget_low_u8(px.val[2]);
+            uint16x8_t out = vshll_n_u8(r, 8);
+            out            = vsriq_n_u16(out, vshll_n_u8(g, 8), 5);
+            out            = vsriq_n_u16(out, vshll_n_u8(b, 8), 11);
+            vst1q_u16(out16 + half * 8, out);
+        }
+    }
+#endif
+    for (ssize_t l = dataLen - 3; i < l; i += 4)
     {
         *out16++ = (data[i] & 0x00F8) << 8         // R
                    | (data[i + 1] & 0x00FC) << 3   // G
@@ -349,7 +423,33 @@ static void convertRGB8ToRGBA4(const unsigned char* data, size_t dataLen, unsign
 static void convertRGBA8ToRGBA4(const unsigned char* data, size_t dataLen, unsigned char* outData)
 {
     unsigned short* out16 = (unsigned short*)outData;
-    for (ssize_t i = 0, l = dataLen - 3; i < l; i += 4)
+    ssize_t i             = 0;
+#if defined(AX_PIXEL_SSE)
+    for (; i + 32 <= (ssize_t)dataLen; i += 32, out16 += 8)
+    {
+        const __m128i v0 = _mm_loadu_si128((const __m128i*)(data + i));
+        const __m128i v1 = _mm_loadu_si128((const __m128i*)(data + i + 16));
+        _mm_storeu_si128((__m128i*)out16, _mm_packs_epi32(packRGBA8ToRGBA4(v0), packRGBA8ToRGBA4(v1)));
+    }
+#elif defined(AX_PIXEL_NEON)
+    for (; i + 64 <= (ssize_t)dataLen; i += 64, out16 += 16)
+    {
+        const uint8x16x4_t px = vld4q_u8(data + i);
+        for (int half = 0; half < 2; ++half)
+        {
+            const auto r = half ? vget_high_u8(px.val[0]) : vget_low_u8(px.val[0]);
+            const auto g = half ? vget_high_u8(px.val[1]) : vget_low_u8(px.val[1]);
+            const auto b = half ? vget_high_u8(px.val[2]) : vget_low_u8(px.val[2]);
+            const auto a = half ? vget_high_u8(px.val[3]) : vget_low_u8(px.val[3]);
+            uint16x8_t out = vshll_n_u8(r, 8);
+            out            = vsriq_n_u16(out, vshll_n_u8(g, 8), 4);
+            out            = vsriq_n_u16(out, vshll_n_u8(b, 8), 8);
+            out            = vsriq_n_u16(out, vshll_n_u8(a, 8), 12);
+            vst1q_u16(out16 + half * 8, out);
+        }
+    }
+#endif
+    for (ssize_t l = dataLen - 3; i < l; i += 4)
     {
         *out16++ = (data[i] & 0x00F0) << 8        // R
                    | (data[i + 1] & 0x00F0) << 4  // G
@@ -443,7 +543,30 @@ static void convertR8ToRGBA8(const unsigned char* data, size_t dataLen, unsigned
 static void convertBGRA8ToRGBA8(const unsigned char* data, size_t dataLen, unsigned char* outData)
 {
     const size_t pixelCounts = dataLen / 4;
-    for (size_t i = 0; i < pixelCounts; i++)
+    size_t i                 = 0;
+#if defined(AX_PIXEL_SSE)
+    const __m128i gaMask = _mm_set1_epi32((int)0xFF00FF00);
+    const __m128i rMask  = _mm_set1_epi32(0x00FF0000);
+    const __m128i bMask  = _mm_set1_epi32(0x000000FF);
+    for (; i + 4 <= pixelCounts; i += 4, outData += 16)
+    {
+        const __m128i v = _mm_loadu_si128((const __m128i*)(data + i * 4));
+        const __m128i out =
+            _mm_or_si128(_mm_and_si128(v, gaMask), _mm_or_si128(_mm_and_si128(_mm_slli_epi32(v, 16), rMask),
+                                                                _mm_and_si128(_mm_srli_epi32(v, 16), bMask)));
+        _mm_storeu_si128((__m128i*)outData, out);
+    }
+#elif defined(AX_PIXEL_NEON)
+    for (; i + 16 <= pixelCounts; i += 16, outData += 64)
+    {
+        uint8x16x4_t px = vld4q_u8(data + i * 4);
+        const auto b    = px.val[0];
+        px.val[0]       = px.val[2];
+        px.val[2]       = b;
+        vst4q_u8(outData, px);
+    }
+#endif
+    for (; i < pixelCounts; i++)
     {
         *outData++ = data[i * 4 + 2];
         *outData++ = data[i * 4 + 1];
@@ -821,6 +944,74 @@ static PixelFormat convertBGRA8ToFormat(const unsigned char* data,
  rgba(1) -> 12345678
 
  */
+void premultiplyAlphaRGBA8(unsigned char* data, size_t pixelCount)
+{
+    size_t i = 0;
+#if defined(AX_PIXEL_SSE)
+    const __m128i zero      = _mm_setzero_si128();
+    const __m128i alphaMask = _mm_set1_epi32((int)0xFF000000);
+    for (; i + 4 <= pixelCount; i += 4)
+    {
+        const __m128i px = _mm_loadu_si128((const __m128i*)(data + i * 4));
+        const __m128i lo = premultiplyRGBA16(_mm_unpacklo_epi8(px, zero));
+        const __m128i hi = premultiplyRGBA16(_mm_unpackhi_epi8(px, zero));
+        const __m128i out =
+            _mm_or_si128(_mm_andnot_si128(alphaMask, _mm_packus_epi16(lo, hi)), _mm_and_si128(alphaMask, px));
+        _mm_storeu_si128((__m128i*)(data + i * 4), out);
+    }
+#elif defined(AX_PIXEL_NEON)
+    for (; i + 16 <= pixelCount; i += 16)
+    {
+        uint8x16x4_t px = vld4q_u8(data + i * 4);
+        px.val[0]       = premultiplyChannel(px.val[0], px.val[3]);
+        px.val[1]       = premultiplyChannel(px.val[1], px.val[3]);
+        px.val[2]       = premultiplyChannel(px.val[2], px.val[3]);
+        vst4q_u8(data + i * 4, px);
+    }
+#endif
+    for (; i < pixelCount; i++)
+    {
+        uint8_t* p        = data + i * 4;
+        const unsigned a1 = p[3] + 1u;
+        p[0]              = static_cast<uint8_t>((p[0] * a1) >> 8);
+        p[1]              = static_cast<uint8_t>((p[1] * a1) >> 8);
+        p[2]              = static_cast<uint8_t>((p[2] * a1) >> 8);
+    }
+}
+
+void premultiplyAlphaRG8(unsigned char* data, size_t pixelCount)
+{
+    size_t i = 0;
+#if defined(AX_PIXEL_SSE)
+    const __m128i lumMask = _mm_set1_epi16(0x00FF);
+    const __m128i one     = _mm_set1_epi16(1);
+    for (; i + 8 <= pixelCount; i += 8)
+    {
+        const __m128i px  = _mm_loadu_si128((const __m128i*)(data + i * 2));
+        const __m128i l   = _mm_and_si128(px, lumMask);
+        const __m128i a   = _mm_srli_epi16(px, 8);
+        const __m128i pl  = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(l, a), one), 8);
+        _mm_storeu_si128((__m128i*)(data + i * 2), _mm_or_si128(pl, _mm_slli_epi16(a, 8)));
+    }
+#elif defined(AX_PIXEL_NEON)
+    const uint16x8_t one = vdupq_n_u16(1);
+    for (; i + 16 <= pixelCount; i += 16)
+    {
+        uint8x16x2_t px     = vld2q_u8(data + i * 2);
+        const uint16x8_t lo = vaddq_u16(vmull_u8(vget_low_u8(px.val[0]), vget_low_u8(px.val[1])), one);
+        const uint16x8_t hi = vaddq_u16(vmull_u8(vget_high_u8(px.val[0]), vget_high_u8(px.val[1])), one);
+        px.val[0]           = vcombine_u8(vshrn_n_u16(lo, 8), vshrn_n_u16(hi, 8));
+        vst2q_u8(data + i * 2, px);
+    }
+#endif
+    uint16_t* twoBytes = (uint16_t*)data;
+    for (; i < pixelCount; i++)
+    {
+        uint8_t* p  = data + i * 2;
+        twoBytes[i] = ((p[0] * p[1] + 1) >> 8) | (p[1] << 8);
+    }
+}
+
 ax::backend::PixelFormat convertDataToFormat(const unsigned char* data,
                                                   size_t dataLen,
                                                   PixelFormat originFormat,
@@ -73,6 +73,16 @@ PixelFormat convertDataToFormat(const unsigned char* data,
                                 PixelFormat format,
                                 unsigned char** outData,
                                 size_t* outDataLen);
+
+/**
+ * Premultiply the color channels of RGBA8 pixels by their alpha, in place.
+ */
+void premultiplyAlphaRGBA8(unsigned char* data, size_t pixelCount);
+
+/**
+ * Premultiply the luminance of RG8 (luminance, alpha) pixels by their alpha, in place.
+ */
+void premultiplyAlphaRG8(unsigned char* data, size_t pixelCount);
 };  // namespace PixelFormatUtils
 }  // namespace backend
 }
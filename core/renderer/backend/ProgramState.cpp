@@ -30,7 +30,9 @@
 #include "base/EventDispatcher.h"
 #include "base/EventType.h"
 #include "base/Director.h"
+#include "2d/Camera.h"
 #include <algorithm>
+#include <cmath>
 #include "xxhash/xxhash.h"
 
 #include "axslcc/sgs-spec.h"
@@ -252,6 +254,78 @@ void ProgramState::setCallbackUniform(const backend::UniformLocation& uniformLoc
     _callbackUniforms[uniformLocation] = callback;
 }
 
+void ProgramState::setFrameCallbackUniform(const backend::UniformLocation& uniformLocation,
+                                           const UniformCallback& callback)
+{
+    _frameCallbackUniforms[uniformLocation] = callback;
+    _frameUniformsEpoch                     = 0;
+}
+
+void ProgramState::updateCallbackUniforms()
+{
+    if (!_frameCallbackUniforms.empty())
+    {
+        const auto epoch = getFrameUniforms().epoch;
+        if (epoch != _frameUniformsEpoch)
+        {
+            _frameUniformsEpoch = epoch;
+            for (auto&& cb : _frameCallbackUniforms)
+                cb.second(this, cb.first);
+        }
+    }
+
+    for (auto&& cb : _callbackUniforms)
+        cb.second(this, cb.first);
+}
+
+const ProgramState::FrameUniforms& ProgramState::getFrameUniforms()
+{
+    static FrameUniforms frameUniforms;
+    static unsigned int lastFrame = 0;
+
+    auto director = Director::getInstance();
+    auto camera   = Camera::getVisitingCamera();
+    auto frame    = director->getTotalFrames();
+
+    // the view projection is compared too, eye passes of a VR frame share the same camera
+    const auto& viewProjection =
+        camera ? camera->getViewProjectionMatrix() : director->getMatrix(MATRIX_STACK_TYPE::MATRIX_STACK_PROJECTION);
+    if (frameUniforms.epoch != 0 && frame == lastFrame &&
+        memcmp(viewProjection.m, frameUniforms.viewProjectionMatrix.m, sizeof(viewProjection.m)) == 0)
+        return frameUniforms;
+
+    if (frame != lastFrame || frameUniforms.epoch == 0)
+    {
+        lastFrame = frame;
+
+        // the director's clock keeps running on frames that draw nothing using these uniforms
+        const double t = director->getTotalTime();
+        frameUniforms.time =
+            Vec4(static_cast<float>(t / 10.0), static_cast<float>(t), static_cast<float>(t * 2.0),
+                 static_cast<float>(t * 4.0));
+        frameUniforms.sinTime =
+            Vec4(static_cast<float>(std::sin(t / 8.0)), static_cast<float>(std::sin(t / 4.0)),
+                 static_cast<float>(std::sin(t / 2.0)), static_cast<float>(std::sin(t)));
+        frameUniforms.cosTime =
+            Vec4(static_cast<float>(std::cos(t / 8.0)), static_cast<float>(std::cos(t / 4.0)),
+                 static_cast<float>(std::cos(t / 2.0)), static_cast<float>(std::cos(t)));
+    }
+
+    if (camera)
+    {
+        frameUniforms.viewMatrix       = camera->getViewMatrix();
+        frameUniforms.projectionMatrix = camera->getProjectionMatrix();
+    }
+    else
+    {
+        frameUniforms.viewMatrix       = Mat4::IDENTITY;
+        frameUniforms.projectionMatrix = viewProjection;
+    }
+    frameUniforms.viewProjectionMatrix = viewProjection;
+    ++frameUniforms.epoch;
+    return frameUniforms;
+}
+
 void ProgramState::setUniform(const backend::UniformLocation& uniformLocation, const void* data, std::size_t size)
 {
     if (uniformLocation.vertStage)
@@ -419,8 +493,47 @@ void ProgramState::applyAutoBinding(std::string_view uniformName, std::string_vi
     for (const auto resolver : _customAutoBindingResolvers)
     {
         if (resolver->resolveAutoBinding(this, uniformName, autoBinding))
-            break;
+            return;
     }
+
+    applyBuiltinAutoBinding(uniformName, autoBinding);
+}
+
+bool ProgramState::applyBuiltinAutoBinding(std::string_view uniformName, std::string_view autoBinding)
+{
+    using ValueGetter = const void* (*)(const FrameUniforms&);
+    struct BuiltinBinding
+    {
+        std::string_view name;
+        ValueGetter value;
+        std::size_t size;
+    };
+    static const BuiltinBinding builtinBindings[] = {
+        {"VIEW_MATRIX"sv, [](const FrameUniforms& u) -> const void* { return u.viewMatrix.m; }, sizeof(Mat4::m)},
+        {"PROJECTION_MATRIX"sv, [](const FrameUniforms& u) -> const void* { return u.projectionMatrix.m; },
+         sizeof(Mat4::m)},
+        {"VIEW_PROJECTION_MATRIX"sv, [](const FrameUniforms& u) -> const void* { return u.viewProjectionMatrix.m; },
+         sizeof(Mat4::m)},
+        {"TIME"sv, [](const FrameUniforms& u) -> const void* { return &u.time; }, sizeof(Vec4)},
+        {"SIN_TIME"sv, [](const FrameUniforms& u) -> const void* { return &u.sinTime; }, sizeof(Vec4)},
+        {"COS_TIME"sv, [](const FrameUniforms& u) -> const void* { return &u.cosTime; }, sizeof(Vec4)},
+    };
+
+    auto it = std::find_if(std::begin(builtinBindings), std::end(builtinBindings),
+                           [autoBinding](const BuiltinBinding& binding) { return binding.name == autoBinding; });
+    if (it == std::end(builtinBindings))
+        return false;
+
+    auto location = getUniformLocation(uniformName);
+    if (!location)
+        return false;
+
+    auto value = it->value;
+    auto size  = it->size;
+    setFrameCallbackUniform(location, [value, size](ProgramState* programState, const UniformLocation& uniform) {
+        programState->setUniform(uniform, value(getFrameUniforms()), size);
+    });
+    return true;
 }
 
 ProgramState::AutoBindingResolver::AutoBindingResolver()
@@ -33,6 +33,7 @@
 #include "platform/PlatformMacros.h"
 #include "base/Object.h"
 #include "base/EventListenerCustom.h"
+#include "math/Math.h"
 #include "renderer/backend/Types.h"
 #include "renderer/backend/Program.h"
 #include "renderer/backend/VertexLayout.h"
@@ -164,6 +165,41 @@ public:
         return _callbackUniforms;
     }
 
+    /**
+     * A callback to update a uniform whose value only depends on per frame state, such as the camera
+     * or the time. It runs once per frame and camera pass for this program state instead of once per draw.
+     * @param uniformLocation Specifies the uniform location.
+     * @param unifromCallback Specifies a callback function to update the uniform.
+     */
+    void setFrameCallbackUniform(const backend::UniformLocation&, const UniformCallback&);
+
+    /**
+     * Runs the uniform callbacks before a draw. Frame callbacks only run when the frame or the
+     * camera pass changed since they last ran for this program state.
+     */
+    void updateCallbackUniforms();
+
+    /**
+     * Values shared by every program state, evaluated once per frame and camera pass.
+     * They back the built-in auto bindings, see setParameterAutoBinding().
+     */
+    struct FrameUniforms
+    {
+        Mat4 viewMatrix;
+        Mat4 projectionMatrix;
+        Mat4 viewProjectionMatrix;
+        Vec4 time;     ///< (t / 10, t, t * 2, t * 4), t is the total rendering time in seconds
+        Vec4 sinTime;  ///< (sin(t / 8), sin(t / 4), sin(t / 2), sin(t))
+        Vec4 cosTime;  ///< (cos(t / 8), cos(t / 4), cos(t / 2), cos(t))
+        uint64_t epoch = 0;  ///< increases whenever the values above are re-evaluated
+    };
+
+    /**
+     * Gets the shared frame values, re-evaluating them first if the frame or the visiting camera changed.
+     * Must be called on the render thread.
+     */
+    static const FrameUniforms& getFrameUniforms();
+
     /**
      * Set texture.
      * @param uniformLocation Specifies texture location.
@@ -245,8 +281,9 @@ public:
      * Node. The resolver is NOT called each frame or each time the GLProgramState is bound.
      *
      * If no registered resolvers explicitly handle an auto binding, the binding will attempt
-     * to be resolved using the internal/built-in resolver, which is able to handle any
-     * auto bindings found in the GLProgramState::AutoBinding enumeration.
+     * to be resolved using the built-in bindings VIEW_MATRIX, PROJECTION_MATRIX,
+     * VIEW_PROJECTION_MATRIX, TIME, SIN_TIME and COS_TIME. They are bound as frame callbacks
+     * reading ProgramState::getFrameUniforms(), so their values are computed once per frame.
      *
      * When an instance of a class that extends AutoBindingResolver is created, it is automatically
      * registered as a custom auto binding handler. Likewise, it is automatically unregistered
@@ -389,8 +426,17 @@ protected:
      */
     void applyAutoBinding(std::string_view, std::string_view);
 
+    /**
+     * Binds one of the built-in auto bindings.
+     *
+     * @return true if autoBinding names a built-in binding and the uniform exists.
+     */
+    bool applyBuiltinAutoBinding(std::string_view uniformName, std::string_view autoBinding);
+
     backend::Program* _program = nullptr;
     std::unordered_map<UniformLocation, UniformCallback, UniformLocation> _callbackUniforms;
+    std::unordered_map<UniformLocation, UniformCallback, UniformLocation> _frameCallbackUniforms;
+    uint64_t _frameUniformsEpoch = 0;  ///< FrameUniforms::epoch the frame callbacks last ran for
     yasio::sbyte_buffer _uniformBuffers;
     std::size_t _vertexUniformBufferSize   = 0;
     std::size_t _fragmentUniformBufferSize = 0;
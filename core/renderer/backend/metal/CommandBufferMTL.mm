@@ -499,9 +499,7 @@ void CommandBufferMTL::setUniformBuffer() const
 {
     if (_programState)
     {
-        auto& callbackUniforms = _programState->getCallbackUniforms();
-        for (auto& cb : callbackUniforms)
-            cb.second(_programState, cb.first);
+        _programState->updateCallbackUniforms();
 
         // Uniform buffer: glsl-optimizer is bound to index 1, axslcc: bound to 0
         constexpr int bindingIndex = DriverMTL::VBO_BINDING_INDEX_START;
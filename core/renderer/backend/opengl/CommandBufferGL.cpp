@@ -68,6 +68,7 @@ CommandBufferGL::~CommandBufferGL()
 
 bool CommandBufferGL::beginFrame()
 {
+    _uniformRing.beginFrame();
     return true;
 }
 
@@ -379,15 +380,13 @@ void CommandBufferGL::bindUniforms(ProgramGL* program) const
     {
         assert(program == _programState->getProgram());
 
-        auto& callbacks = _programState->getCallbackUniforms();
-        for (auto&& cb : callbacks)
-            cb.second(_programState, cb.first);
+        _programState->updateCallbackUniforms();
 
         auto& uniformInfos = program->getAllActiveUniformInfo(ShaderStage::VERTEX);
 
         std::size_t bufferSize = 0;
         auto buffer            = _programState->getVertexUniformBuffer(bufferSize);
-        program->bindUniformBuffers(buffer, bufferSize);
+        program->bindUniformBuffers(buffer, bufferSize, &_uniformRing);
 
         const auto& textureInfo = _programState->getVertexTextureInfos();
         for (const auto& iter : textureInfo)
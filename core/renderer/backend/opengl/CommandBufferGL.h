@@ -29,6 +29,7 @@
 #include "../CommandBuffer.h"
 #include "base/EventListenerCustom.h"
 #include "platform/GL.h"
+#include "UniformRingBufferGL.h"
 
 #include "StdC.h"
 
@@ -217,6 +218,11 @@ public:
                     bool eglCacheHint,
                     PixelBufferDescriptor& pbd);
 
+    /**
+     * Get the uniform upload counters of the last completed frame.
+     */
+    const UniformRingBufferGL::FrameStats& getUniformStats() const { return _uniformRing.getLastFrameStats(); }
+
 protected:
 
     void prepareDrawing() const;
@@ -234,6 +240,7 @@ protected:
     DepthStencilStateGL* _depthStencilStateGL = nullptr;
     Viewport _viewPort;
     GLboolean _alphaTestEnabled               = false;
+    mutable UniformRingBufferGL _uniformRing;
 
 #if AX_ENABLE_CACHE_TEXTURE_DATA
     EventListenerCustom* _backToForegroundListener = nullptr;
@@ -31,6 +31,7 @@
 #include "TextureGL.h"
 #include "DepthStencilStateGL.h"
 #include "ProgramGL.h"
+#include "ProgramBinaryCacheGL.h"
 #include "DriverGL.h"
 #include "RenderTargetGL.h"
 #include "MacrosGL.h"
@@ -179,6 +180,7 @@ DriverGL::DriverGL()
 DriverGL::~DriverGL()
 {
     ProgramManager::destroyInstance();
+    ProgramBinaryCacheGL::destroyInstance();
 }
 
 GLint DriverGL::getDefaultFBO() const
@@ -289,8 +289,26 @@ struct OpenGLState
     }
     void bindUniformBufferBase(GLuint index, GLuint handle)
     {
-        try_callxu(glBindBufferBase, GL_UNIFORM_BUFFER, _uniformBufferState, index, handle);
+#if defined(AX_ENABLE_STATE_GUARD)
+        if (_uniformBufferState && _uniformBufferState->equals(index, handle))
+            return;
+        _uniformBufferState.emplace(index, handle);
+        // also rebinds the generic GL_UNIFORM_BUFFER target, a later bindBuffer must not be skipped
+        _bufferBindings[static_cast<int>(BufferType::UNIFORM)] = handle;
+#endif
+        glBindBufferBase(GL_UNIFORM_BUFFER, index, handle);
     }
+#if AX_GLES_PROFILE != 200
+    void bindUniformBufferRange(GLuint index, GLuint handle, GLintptr offset, GLsizeiptr size)
+    {
+        // also rebinds the generic GL_UNIFORM_BUFFER target, keep both cached states truthful
+        glBindBufferRange(GL_UNIFORM_BUFFER, index, handle, offset, size);
+        _uniformBufferState.reset();
+#    if defined(AX_ENABLE_STATE_GUARD)
+        _bufferBindings[static_cast<int>(BufferType::UNIFORM)] = handle;
+#    endif
+    }
+#endif
 
     // useful for multi GL context before GL context switch, reset VAO state
     // VAO not share between context
@@ -0,0 +1,273 @@
+/****************************************************************************
+ Copyright (c) 2019-present Axmol Engine contributors (see AUTHORS.md).
+
+ https://axmol.dev/
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ ****************************************************************************/
+
+#include "ProgramBinaryCacheGL.h"
+#include "renderer/backend/DriverBase.h"
+#include "platform/FileUtils.h"
+#include "base/Director.h"
+#include "base/EventDispatcher.h"
+#include "base/EventListenerCustom.h"
+#include "base/JobSystem.h"
+#include "xxhash/xxhash.h"
+
+#include <chrono>
+
+// Program binaries need GLES 3.0, desktop GL 4.1 or ARB_get_program_binary, WebGL has no equivalent.
+#if AX_GLES_PROFILE != 200 && AX_TARGET_PLATFORM != AX_PLATFORM_WASM
+#    define AX_GL_PROGRAM_BINARY 1
+#else
+#    define AX_GL_PROGRAM_BINARY 0
+#endif
+
+NS_AX_BACKEND_BEGIN
+
+namespace
+{
+constexpr uint32_t PROGRAM_BINARY_MAGIC   = 0x42505841;  // 'AXPB' little endian
+constexpr uint32_t PROGRAM_BINARY_VERSION = 1;
+
+struct ProgramBinaryHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint64_t driverHash;
+    uint32_t format;
+    uint32_t length;
+    float compileMs;
+    uint32_t reserved;
+};
+
+ProgramBinaryCacheGL* s_programBinaryCache = nullptr;
+
+double elapsedMs(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+}  // namespace
+
+ProgramBinaryCacheGL* ProgramBinaryCacheGL::getInstance()
+{
+    if (!s_programBinaryCache)
+        s_programBinaryCache = new ProgramBinaryCacheGL();
+    return s_programBinaryCache;
+}
+
+void ProgramBinaryCacheGL::destroyInstance()
+{
+    AX_SAFE_DELETE(s_programBinaryCache);
+}
+
+ProgramBinaryCacheGL::ProgramBinaryCacheGL()
+{
+#if AX_GL_PROGRAM_BINARY
+#    if defined(GLAD_GL_H_)
+    if (!glad_glGetProgramBinary || !glad_glProgramBinary || !glad_glProgramParameteri)
+        return;
+#    endif
+    GLint numFormats = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &numFormats);
+    // Drivers lacking the extension flag the enum as invalid, drop the error so it is not blamed on later calls
+    while (glGetError() != GL_NO_ERROR)
+        ;
+    _supported = numFormats > 0;
+#endif
+    if (!_supported)
+        return;
+
+    auto driver     = DriverBase::getInstance();
+    auto hashState  = XXH64_createState();
+    auto hashString = [hashState](const char* str) {
+        if (str)
+            XXH64_update(hashState, str, strlen(str) + 1);
+    };
+    XXH64_reset(hashState, PROGRAM_BINARY_VERSION);
+    hashString(driver->getVendor());
+    hashString(driver->getRenderer());
+    hashString(driver->getVersion());
+    hashString(driver->getShaderVersion());
+    _driverHash = XXH64_digest(hashState);
+    XXH64_freeState(hashState);
+
+    _cacheDir = FileUtils::getInstance()->getWritablePath();
+    _cacheDir += "program_binaries/";
+}
+
+uint64_t ProgramBinaryCacheGL::computeKey(std::string_view vertexShader, std::string_view fragmentShader) const
+{
+    auto hashState = XXH64_createState();
+    XXH64_reset(hashState, 0);
+    XXH64_update(hashState, vertexShader.data(), vertexShader.length());
+    XXH64_update(hashState, fragmentShader.data(), fragmentShader.length());
+    const auto key = XXH64_digest(hashState);
+    XXH64_freeState(hashState);
+    return key;
+}
+
+std::string ProgramBinaryCacheGL::getEntryPath(uint64_t key) const
+{
+    return fmt::format("{}{:016x}.bin", _cacheDir, key);
+}
+
+void ProgramBinaryCacheGL::scheduleReport()
+{
+    // Report once the first frame is out, by then the startup shaders are all loaded.
+    _reportPending  = false;
+    _reportListener = Director::getInstance()->getEventDispatcher()->addCustomEventListener(
+        Director::EVENT_AFTER_DRAW, [](EventCustom*) {
+            if (!s_programBinaryCache || !s_programBinaryCache->_reportListener)
+                return;
+            AXLOGI("{}", s_programBinaryCache->dumpStats());
+            Director::getInstance()->getEventDispatcher()->removeEventListener(s_programBinaryCache->_reportListener);
+            s_programBinaryCache->_reportListener = nullptr;
+        });
+}
+
+GLuint ProgramBinaryCacheGL::loadProgram(uint64_t key)
+{
+    // Every program asks the cache first, so this also covers launches where all programs hit.
+    if (_reportPending)
+        scheduleReport();
+
+#if AX_GL_PROGRAM_BINARY
+    if (!isEnabled())
+        return 0;
+
+    auto fileUtils  = FileUtils::getInstance();
+    const auto path = getEntryPath(key);
+    if (!fileUtils->isFileExist(path))
+        return 0;
+
+    const auto start = std::chrono::steady_clock::now();
+    const auto data  = fileUtils->getDataFromFile(path);
+
+    ProgramBinaryHeader header;
+    if (data.getSize() < static_cast<ssize_t>(sizeof(header)))
+    {
+        ++_stats.rejected;
+        return 0;
+    }
+    memcpy(&header, data.getBytes(), sizeof(header));
+    if (header.magic != PROGRAM_BINARY_MAGIC || header.version != PROGRAM_BINARY_VERSION ||
+        header.driverHash != _driverHash || header.length != static_cast<size_t>(data.getSize()) - sizeof(header))
+    {
+        ++_stats.rejected;
+        return 0;
+    }
+
+    GLuint program = glCreateProgram();
+    if (!program)
+        return 0;
+
+    glProgramBinary(program, header.format, data.getBytes() + sizeof(header), header.length);
+
+    GLint status = GL_FALSE;
+    glGetProgramiv(program, GL_LINK_STATUS, &status);
+    if (status == GL_FALSE)
+    {
+        // The driver may refuse binaries of its own after an update that kept the version string.
+        while (glGetError() != GL_NO_ERROR)
+            ;
+        glDeleteProgram(program);
+        ++_stats.rejected;
+        return 0;
+    }
+
+    const auto loadMs = elapsedMs(start);
+    ++_stats.hits;
+    _stats.loadMs += loadMs;
+    _stats.savedMs += header.compileMs - loadMs;
+    return program;
+#else
+    return 0;
+#endif
+}
+
+void ProgramBinaryCacheGL::prepareProgram(GLuint program) const
+{
+#if AX_GL_PROGRAM_BINARY
+    if (isEnabled())
+        glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+#endif
+}
+
+void ProgramBinaryCacheGL::saveProgram(GLuint program, uint64_t key, double compileMs)
+{
+    ++_stats.misses;
+    _stats.compileMs += compileMs;
+
+#if AX_GL_PROGRAM_BINARY
+    if (!isEnabled())
+        return;
+
+    GLint length = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0)
+        return;
+
+    ProgramBinaryHeader header{};
+    header.magic      = PROGRAM_BINARY_MAGIC;
+    header.version    = PROGRAM_BINARY_VERSION;
+    header.driverHash = _driverHash;
+    header.compileMs  = static_cast<float>(compileMs);
+
+    Data data;
+    auto bytes     = data.resize(sizeof(header) + length);
+    GLenum format  = 0;
+    GLsizei actual = 0;
+    glGetProgramBinary(program, length, &actual, &format, bytes + sizeof(header));
+    if (actual <= 0)
+        return;
+
+    header.format = format;
+    header.length = static_cast<uint32_t>(actual);
+    memcpy(bytes, &header, sizeof(header));
+    data.resize(sizeof(header) + actual);
+
+    // Only the disk write leaves the GL thread.
+    Director::getInstance()->getJobSystem()->enqueue(
+        [dir = _cacheDir, path = getEntryPath(key), data = std::move(data)]() {
+            auto fileUtils = FileUtils::getInstance();
+            if (fileUtils->createDirectories(dir))
+                fileUtils->writeDataToFile(data, path);
+        });
+#endif
+}
+
+std::string ProgramBinaryCacheGL::dumpStats() const
+{
+    if (!_supported)
+        return fmt::format("Program binary cache: unsupported by driver, {} programs compiled in {:.1f} ms",
+                           _stats.misses, _stats.compileMs);
+    return fmt::format(
+        "Program binary cache: {} hits loaded in {:.1f} ms, {} compiled in {:.1f} ms, {} rejected, ~{:.1f} ms saved",
+        _stats.hits, _stats.loadMs, _stats.misses, _stats.compileMs, _stats.rejected, _stats.savedMs);
+}
+
+void ProgramBinaryCacheGL::purge()
+{
+    if (!_cacheDir.empty())
+        FileUtils::getInstance()->removeDirectory(_cacheDir);
+}
+
+NS_AX_BACKEND_END
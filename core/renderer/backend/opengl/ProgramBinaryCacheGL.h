@@ -0,0 +1,107 @@
+/****************************************************************************
+ Copyright (c) 2019-present Axmol Engine contributors (see AUTHORS.md).
+
+ https://axmol.dev/
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ ****************************************************************************/
+
+#pragma once
+
+#include "../Macros.h"
+#include "platform/GL.h"
+
+#include <string>
+#include <string_view>
+
+namespace ax
+{
+class EventListenerCustom;
+}
+
+NS_AX_BACKEND_BEGIN
+/**
+ * @addtogroup _opengl
+ * @{
+ */
+
+/**
+ * Persists linked program binaries in the writable path, so later launches skip shader compile and link.
+ * Entries are keyed by the shader sources and tagged with the driver identity, a driver update or a binary the
+ * driver refuses silently falls back to compiling from source and refreshes the entry.
+ */
+class ProgramBinaryCacheGL
+{
+public:
+    struct Stats
+    {
+        unsigned int hits     = 0;  ///< programs created from a cached binary
+        unsigned int misses   = 0;  ///< programs compiled from source
+        unsigned int rejected = 0;  ///< cached binaries dropped for a driver mismatch or failed load
+        double loadMs         = 0;  ///< time spent creating programs from cached binaries
+        double compileMs      = 0;  ///< time spent compiling and linking programs from source
+        double savedMs        = 0;  ///< recorded compile time of the hits minus their load time
+    };
+
+    static ProgramBinaryCacheGL* getInstance();
+    static void destroyInstance();
+
+    /** Enabled by default where the driver exposes at least one program binary format. */
+    void setEnabled(bool enabled) { _enabled = enabled; }
+    bool isEnabled() const { return _enabled && _supported; }
+
+    /** Computes the cache key of a program. */
+    uint64_t computeKey(std::string_view vertexShader, std::string_view fragmentShader) const;
+
+    /**
+     * Creates and links a program from the cached binary.
+     * @return The program, or 0 when there is no usable binary for the key.
+     */
+    GLuint loadProgram(uint64_t key);
+
+    /** Call on a newly created program before linking it from source. */
+    void prepareProgram(GLuint program) const;
+
+    /** Stores the binary of a program linked from source, the compile time is kept to report what later hits save. */
+    void saveProgram(GLuint program, uint64_t key, double compileMs);
+
+    const Stats& getStats() const { return _stats; }
+    std::string dumpStats() const;
+
+    /** Removes all cached binaries from disk. */
+    void purge();
+
+private:
+    ProgramBinaryCacheGL();
+
+    std::string getEntryPath(uint64_t key) const;
+    void scheduleReport();
+
+    std::string _cacheDir;
+    uint64_t _driverHash = 0;
+    bool _supported      = false;
+    bool _enabled        = true;
+    bool _reportPending  = true;
+    EventListenerCustom* _reportListener = nullptr;
+    Stats _stats;
+};
+
+// end of _opengl group
+/// @}
+NS_AX_BACKEND_END
@@ -32,9 +32,13 @@
 #include "base/EventType.h"
 #include "base/axstd.h"
 #include "yasio/byte_buffer.hpp"
+#include "xxhash/xxhash.h"
 #include "renderer/backend/opengl/UtilsGL.h"
+#include "renderer/backend/opengl/ProgramBinaryCacheGL.h"
 #include "OpenGLState.h"
 
+#include <chrono>
+
 NS_AX_BACKEND_BEGIN
 
 #if AX_GLES_PROFILE == 200
@@ -165,8 +169,9 @@ void ProgramGL::reloadProgram()
     _activeUniformInfos.clear();
     _mapToCurrentActiveLocation.clear();
     _mapToOriginalLocation.clear();
-    static_cast<ShaderModuleGL*>(_vertexShaderModule)->compileShader(backend::ShaderStage::VERTEX, _vertexShader);
-    static_cast<ShaderModuleGL*>(_fragmentShaderModule)->compileShader(backend::ShaderStage::FRAGMENT, _fragmentShader);
+    // The context is gone with the old shader objects, compileProgram recompiles them unless the binary cache hits
+    _vertexShaderModule->_shader   = 0;
+    _fragmentShaderModule->_shader = 0;
     compileProgram();
     computeUniformInfos();
 
@@ -184,8 +189,16 @@ void ProgramGL::compileProgram()
     if (_vertexShaderModule == nullptr || _fragmentShaderModule == nullptr)
         return;
 
-    auto vertShader = _vertexShaderModule->getShader();
-    auto fragShader = _fragmentShaderModule->getShader();
+    auto binaryCache     = ProgramBinaryCacheGL::getInstance();
+    const auto binaryKey = binaryCache->computeKey(_vertexShader, _fragmentShader);
+    _program             = binaryCache->loadProgram(binaryKey);
+    if (_program)
+        return;
+
+    const auto compileStart = std::chrono::steady_clock::now();
+
+    auto vertShader = _vertexShaderModule->ensureShader(_vertexShader);
+    auto fragShader = _fragmentShaderModule->ensureShader(_fragmentShader);
 
     assert(vertShader != 0 && fragShader != 0);
     if (vertShader == 0 || fragShader == 0)
@@ -195,6 +208,7 @@ void ProgramGL::compileProgram()
     if (!_program)
         return;
 
+    binaryCache->prepareProgram(_program);
     glAttachShader(_program, vertShader);
     glAttachShader(_program, fragShader);
 
@@ -216,7 +230,12 @@ void ProgramGL::compileProgram()
             AXLOGE("axmol:ERROR: {}: failed to link program ", __FUNCTION__);
         glDeleteProgram(_program);
         _program = 0;
+        return;
     }
+
+    binaryCache->saveProgram(
+        _program, binaryKey,
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - compileStart).count());
 }
 
 void ProgramGL::setBuiltinLocations()
@@ -413,13 +432,54 @@ void ProgramGL::computeUniformInfos()
     }
 }
 
-void ProgramGL::bindUniformBuffers(const char* buffer, size_t bufferSize)
+void ProgramGL::bindUniformBuffers(const char* buffer, size_t bufferSize, UniformRingBufferGL* ring)
 {
 #if AX_GLES_PROFILE != 200
     for (GLuint blockIdx = 0; blockIdx < static_cast<GLuint>(_uniformBuffers.size()); ++blockIdx)
     {
-        auto& desc = _uniformBuffers[blockIdx];
-        desc._ubo->updateData(buffer + desc._location, desc._size);
+        auto& desc      = _uniformBuffers[blockIdx];
+        const auto data = buffer + desc._location;
+        const auto hash = XXH3_64bits(data, desc._size);
+
+        if (ring)
+        {
+            auto& stats = ring->getFrameStats();
+            if (desc._ringFrame == ring->getFrameId() && desc._ringHash == hash)
+            {
+                ++stats.blocksSkipped;
+                ring->bindRange(blockIdx, desc._ringOffset, desc._size);
+                continue;
+            }
+
+            GLintptr offset = 0;
+            if (ring->upload(data, desc._size, offset))
+            {
+                desc._ringHash   = hash;
+                desc._ringOffset = offset;
+                desc._ringFrame  = ring->getFrameId();
+                ++stats.blocksUploaded;
+                stats.bytesUploaded += desc._size;
+                ring->bindRange(blockIdx, offset, desc._size);
+                continue;
+            }
+
+            // ring is full this frame, fall back to the program's own block buffer
+            ring->invalidateBinding(blockIdx);
+            if (!desc._uboUploaded || desc._uboHash != hash)
+            {
+                ++stats.blocksUploaded;
+                stats.bytesUploaded += desc._size;
+            }
+            else
+                ++stats.blocksSkipped;
+        }
+
+        if (!desc._uboUploaded || desc._uboHash != hash)
+        {
+            desc._ubo->updateData(data, desc._size);
+            desc._uboHash     = hash;
+            desc._uboUploaded = true;
+        }
         __gl->bindUniformBufferBase(blockIdx, desc._ubo->getHandler());
     }
 #else
@@ -33,6 +33,7 @@
 #include "../Program.h"
 #include "renderer/backend/DriverBase.h"
 #include "renderer/backend/opengl/BufferGL.h"
+#include "renderer/backend/opengl/UniformRingBufferGL.h"
 
 #include <string>
 #include <vector>
@@ -74,6 +75,11 @@ struct UniformBlockDescriptor
 #if !AX_64BITS
     int __padding;
 #endif
+    uint64_t _uboHash     = 0;  // content hash of the data in _ubo, valid once _uboUploaded
+    uint64_t _ringHash    = 0;  // content hash of the data at _ringOffset, valid during _ringFrame
+    GLintptr _ringOffset  = 0;
+    uint32_t _ringFrame   = 0;
+    bool _uboUploaded     = false;
 };
 
 /**
@@ -161,7 +167,11 @@ public:
      */
     virtual const hlookup::string_map<UniformInfo>& getAllActiveUniformInfo(ShaderStage stage) const override;
 
-    void bindUniformBuffers(const char* buffer, size_t bufferSize);
+    /**
+     * Upload and bind the uniform blocks. Blocks go to ranges of the frame's uniform ring when one is given, and any
+     * block whose content hash matches its last upload is rebound without being uploaded again.
+     */
+    void bindUniformBuffers(const char* buffer, size_t bufferSize, UniformRingBufferGL* ring = nullptr);
 
 private:
     void compileProgram();
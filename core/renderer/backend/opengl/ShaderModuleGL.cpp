@@ -31,16 +31,20 @@
 
 NS_AX_BACKEND_BEGIN
 
-ShaderModuleGL::ShaderModuleGL(ShaderStage stage, std::string_view source) : ShaderModule(stage)
-{
-    compileShader(stage, source);
-}
+ShaderModuleGL::ShaderModuleGL(ShaderStage stage, std::string_view /*source*/) : ShaderModule(stage) {}
 
 ShaderModuleGL::~ShaderModuleGL()
 {
     deleteShader();
 }
 
+GLuint ShaderModuleGL::ensureShader(std::string_view source)
+{
+    if (!_shader)
+        compileShader(_stage, source);
+    return _shader;
+}
+
 void ShaderModuleGL::compileShader(ShaderStage stage, std::string_view source)
 {
     GLenum shaderType       = stage == ShaderStage::VERTEX ? GL_VERTEX_SHADER : GL_FRAGMENT_SHADER;
@@ -35,25 +35,27 @@ NS_AX_BACKEND_BEGIN
  */
 
 /**
- * Create and compile shader.
+ * Create and compile shader. Compilation is deferred to the first program that links it from source, so programs
+ * restored from the program binary cache never compile their stages.
  */
 class ShaderModuleGL : public ShaderModule
 {
 public:
     /**
      * @param stage Specifies whether is vertex shader or fragment shader.
-     * @param source Specifies shader source.
+     * @param source Specifies shader source, not retained: the program passes it again when it needs the shader.
      */
     ShaderModuleGL(ShaderStage stage, std::string_view source);
     ~ShaderModuleGL();
 
     /**
      * Get shader object.
-     * @return Shader object.
+     * @return Shader object, 0 until compiled.
      */
     inline GLuint getShader() const { return _shader; }
 
 private:
+    GLuint ensureShader(std::string_view source);
     void compileShader(ShaderStage stage, std::string_view source);
     void deleteShader();
 
@@ -0,0 +1,140 @@
+/****************************************************************************
+ Copyright (c) 2019-present Axmol Engine contributors (see AUTHORS.md).
+
+ https://axmol.dev/
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ ****************************************************************************/
+
+#include "UniformRingBufferGL.h"
+#include "OpenGLState.h"
+#include "MacrosGL.h"
+#include "base/Director.h"
+#include "base/EventDispatcher.h"
+#include "base/EventListenerCustom.h"
+#include "base/EventType.h"
+
+#include <algorithm>
+
+NS_AX_BACKEND_BEGIN
+
+UniformRingBufferGL::UniformRingBufferGL()
+{
+#if AX_GLES_PROFILE != 200
+    glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &_alignment);
+    _alignment = std::max(_alignment, 16);
+#endif
+
+#if AX_ENABLE_CACHE_TEXTURE_DATA
+    // The buffer died with the old context and holds nothing worth restoring, the next frame recreates it
+    _rendererRecreatedListener = EventListenerCustom::create(EVENT_RENDERER_RECREATED, [this](EventCustom*) {
+        _buffer = 0;
+        for (auto& binding : _bindings)
+            binding = Binding{};
+    });
+    Director::getInstance()->getEventDispatcher()->addEventListenerWithFixedPriority(_rendererRecreatedListener, -1);
+#endif
+}
+
+UniformRingBufferGL::~UniformRingBufferGL()
+{
+    if (_buffer)
+        __gl->deleteBuffer(BufferType::UNIFORM, _buffer);
+#if AX_ENABLE_CACHE_TEXTURE_DATA
+    Director::getInstance()->getEventDispatcher()->removeEventListener(_rendererRecreatedListener);
+#endif
+}
+
+void UniformRingBufferGL::beginFrame()
+{
+#if AX_GLES_PROFILE != 200
+    _lastFrameStats = _frameStats;
+    _frameStats     = FrameStats{};
+
+    if (_required > _capacity && _capacity < MAX_CAPACITY)
+    {
+        while (_capacity < _required && _capacity < MAX_CAPACITY)
+            _capacity *= 2;
+        if (_buffer)
+        {
+            __gl->deleteBuffer(BufferType::UNIFORM, _buffer);
+            _buffer = 0;
+        }
+    }
+
+    if (!_buffer)
+        glGenBuffers(1, &_buffer);
+
+    // Orphan last frame's storage so uploads never wait for the GPU to finish reading it
+    glBufferData(__gl->bindBuffer(BufferType::UNIFORM, _buffer), _capacity, nullptr, GL_STREAM_DRAW);
+    CHECK_GL_ERROR_DEBUG();
+
+    _cursor   = 0;
+    _required = 0;
+    if (++_frameId == 0)
+        _frameId = 1;
+    for (auto& binding : _bindings)
+        binding = Binding{};
+#endif
+}
+
+bool UniformRingBufferGL::upload(const void* data, std::size_t size, GLintptr& offset)
+{
+#if AX_GLES_PROFILE != 200
+    const std::size_t alignedOffset = (_cursor + _alignment - 1) & ~static_cast<std::size_t>(_alignment - 1);
+    _required                       = std::max(_required, alignedOffset + size);
+    if (!_buffer || alignedOffset + size > _capacity)
+    {
+        ++_frameStats.overflows;
+        return false;
+    }
+
+    glBufferSubData(__gl->bindBuffer(BufferType::UNIFORM, _buffer), alignedOffset, size, data);
+    CHECK_GL_ERROR_DEBUG();
+
+    offset  = static_cast<GLintptr>(alignedOffset);
+    _cursor = alignedOffset + size;
+    return true;
+#else
+    return false;
+#endif
+}
+
+void UniformRingBufferGL::bindRange(GLuint index, GLintptr offset, GLsizeiptr size)
+{
+#if AX_GLES_PROFILE != 200
+    if (index < MAX_BINDINGS)
+    {
+        auto& binding = _bindings[index];
+        if (binding.offset == offset && binding.size == size)
+            return;
+        binding.offset = offset;
+        binding.size   = size;
+    }
+    __gl->bindUniformBufferRange(index, _buffer, offset, size);
+#endif
+}
+
+void UniformRingBufferGL::invalidateBinding(GLuint index)
+{
+    if (index < MAX_BINDINGS)
+        _bindings[index] = Binding{};
+}
+
+NS_AX_BACKEND_END
@@ -0,0 +1,112 @@
+/****************************************************************************
+ Copyright (c) 2019-present Axmol Engine contributors (see AUTHORS.md).
+
+ https://axmol.dev/
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ ****************************************************************************/
+
+#pragma once
+
+#include "../Macros.h"
+#include "platform/GL.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ax
+{
+class EventListenerCustom;
+}
+
+NS_AX_BACKEND_BEGIN
+/**
+ * @addtogroup _opengl
+ * @{
+ */
+
+/**
+ * A frame scoped uniform buffer: every uniform block uploaded in a frame gets its own aligned range of one large UBO,
+ * bound with glBindBufferRange, instead of respecifying a per program UBO on each draw. The storage is orphaned at
+ * the start of each frame and grows to the peak usage when a frame overflows it.
+ */
+class UniformRingBufferGL
+{
+public:
+    struct FrameStats
+    {
+        std::size_t bytesUploaded   = 0;  ///< uniform bytes sent to the GPU
+        unsigned int blocksUploaded = 0;  ///< uniform blocks whose content changed since their last upload
+        unsigned int blocksSkipped  = 0;  ///< uniform blocks reused because their content hash did not change
+        unsigned int overflows      = 0;  ///< uploads that did not fit and fell back to the program's own UBO
+    };
+
+    UniformRingBufferGL();
+    ~UniformRingBufferGL();
+
+    void beginFrame();
+
+    /** Identifies the current frame, ranges allocated in an older frame are no longer valid. Never 0. */
+    uint32_t getFrameId() const { return _frameId; }
+
+    /**
+     * Copies data into the next aligned range of the ring.
+     * @return false when the ring is full for this frame.
+     */
+    bool upload(const void* data, std::size_t size, GLintptr& offset);
+
+    /** Binds a range of the ring to a uniform block binding point, skipping redundant binds. */
+    void bindRange(GLuint index, GLintptr offset, GLsizeiptr size);
+
+    /** Forgets the cached binding of an index that was bound to another buffer. */
+    void invalidateBinding(GLuint index);
+
+    FrameStats& getFrameStats() { return _frameStats; }
+    /** Counters of the last completed frame. */
+    const FrameStats& getLastFrameStats() const { return _lastFrameStats; }
+
+private:
+    static constexpr std::size_t INITIAL_CAPACITY = 256 * 1024;
+    static constexpr std::size_t MAX_CAPACITY     = 16 * 1024 * 1024;
+    static constexpr GLuint MAX_BINDINGS          = 16;
+
+    struct Binding
+    {
+        GLintptr offset  = -1;
+        GLsizeiptr size  = 0;
+    };
+
+    GLuint _buffer         = 0;
+    std::size_t _capacity  = INITIAL_CAPACITY;
+    std::size_t _cursor    = 0;
+    std::size_t _required  = 0;  // peak usage including overflowed uploads, drives growth
+    GLint _alignment       = 256;
+    uint32_t _frameId      = 1;
+    Binding _bindings[MAX_BINDINGS];
+    FrameStats _frameStats;
+    FrameStats _lastFrameStats;
+
+#if AX_ENABLE_CACHE_TEXTURE_DATA
+    EventListenerCustom* _rendererRecreatedListener = nullptr;
+#endif
+};
+
+// end of _opengl group
+/// @}
+NS_AX_BACKEND_END
@@ -31,6 +31,7 @@ THE SOFTWARE.
 #include "base/Director.h"
 #include "renderer/Renderer.h"
 #include "ui/UILayoutManager.h"
+#include "ui/UIScrollView.h"
 #include "2d/DrawNode.h"
 #include "2d/Layer.h"
 #include "2d/Sprite.h"
@@ -75,6 +76,7 @@ Layout::Layout()
     , _clippingRectDirty(true)
     , _stencilStateManager(new StencilStateManager())
     , _doLayoutDirty(true)
+    , _layoutManager(nullptr)
     , _isInterceptTouch(false)
     , _loopFocus(false)
     , _passFocusToChild(true)
@@ -86,6 +88,7 @@ Layout::Layout()
 Layout::~Layout()
 {
     AX_SAFE_RELEASE(_clippingStencil);
+    AX_SAFE_RELEASE(_layoutManager);
     AX_SAFE_DELETE(_stencilStateManager);
 }
 
@@ -882,6 +885,7 @@ const Vec2& Layout::getBackGroundImageTextureSize() const
 void Layout::setLayoutType(Type type)
 {
     _layoutType = type;
+    AX_SAFE_RELEASE_NULL(_layoutManager);
 
     for (auto&& child : _children)
     {
@@ -910,6 +914,22 @@ void Layout::requestDoLayout()
     _doLayoutDirty = true;
 }
 
+void Layout::onChildLayoutChanged()
+{
+    if (_layoutType == Type::ABSOLUTE)
+    {
+        return;
+    }
+    requestDoLayout();
+
+    // a list view sizes its inner container from the items, so it has to run its own layout
+    auto scrollView = dynamic_cast<ScrollView*>(_parent);
+    if (scrollView && scrollView->getInnerContainer() == this)
+    {
+        scrollView->requestDoLayout();
+    }
+}
+
 Vec2 Layout::getLayoutContentSize() const
 {
     return this->getContentSize();
@@ -956,11 +976,14 @@ void Layout::doLayout()
 
     sortAllChildren();
 
-    LayoutManager* executant = this->createLayoutManager();
-
-    if (executant)
+    if (!_layoutManager)
+    {
+        _layoutManager = this->createLayoutManager();
+        AX_SAFE_RETAIN(_layoutManager);
+    }
+    if (_layoutManager)
     {
-        executant->doLayout(this);
+        _layoutManager->doLayout(this);
     }
 
     _doLayoutDirty = false;
@@ -405,6 +405,13 @@ public:
      */
     virtual void requestDoLayout();
 
+    /**
+     * Called when the size or the layout parameter of a child widget changed. Layouts which position children by
+     * their sizes are marked dirty and laid out once on the next visit, the inner container of a scroll view
+     * passes the request on to the scroll view.
+     */
+    void onChildLayoutChanged();
+
     /**
      * @lua NA
      */
@@ -648,6 +655,7 @@ protected:
     //CallbackCommand _afterVisitCmdScissor;
 
     bool _doLayoutDirty;
+    LayoutManager* _layoutManager;  // cached for the layout type, created on the first pass
     bool _isInterceptTouch;
 
     // whether enable loop focus or not
@@ -26,6 +26,7 @@
 
 #include "ui/UILayoutManager.h"
 #include "ui/UILayout.h"
+#include <unordered_map>
 
 namespace ax
 {
@@ -43,7 +44,7 @@ LinearHorizontalLayoutManager* LinearHorizontalLayoutManager::create()
 void LinearHorizontalLayoutManager::doLayout(LayoutProtocol* layout)
 {
     Vec2 layoutSize         = layout->getLayoutContentSize();
-    Vector<Node*> container = layout->getLayoutElements();
+    auto&& container        = layout->getLayoutElements();
     float leftBoundary      = 0.0f;
     for (auto&& subWidget : container)
     {
@@ -55,7 +56,8 @@ void LinearHorizontalLayoutManager::doLayout(LayoutProtocol* layout)
             {
                 LinearLayoutParameter::LinearGravity childGravity = layoutParameter->getGravity();
                 Vec2 ap                                           = child->getAnchorPoint();
-                Vec2 cs                                           = child->getBoundingBox().size;
+                Rect box                                          = child->getBoundingBox();
+                Vec2 cs                                           = box.size;
                 float finalPosX                                   = leftBoundary + (ap.x * cs.width);
                 float finalPosY                                   = layoutSize.height - (1.0f - ap.y) * cs.height;
                 switch (childGravity)
@@ -75,8 +77,10 @@ void LinearHorizontalLayoutManager::doLayout(LayoutProtocol* layout)
                 Margin mg = layoutParameter->getMargin();
                 finalPosX += mg.left;
                 finalPosY -= mg.top;
+                // moving the child translates its bounding box, no need to measure it again
+                float offsetX = finalPosX - child->getPositionX();
                 child->setPosition(Vec2(finalPosX, finalPosY));
-                leftBoundary = child->getRightBoundary() + mg.right;
+                leftBoundary = box.getMaxX() + offsetX + mg.right;
             }
         }
     }
@@ -93,7 +97,7 @@ LinearVerticalLayoutManager* LinearVerticalLayoutManager::create()
 void LinearVerticalLayoutManager::doLayout(LayoutProtocol* layout)
 {
     Vec2 layoutSize         = layout->getLayoutContentSize();
-    Vector<Node*> container = layout->getLayoutElements();
+    auto&& container        = layout->getLayoutElements();
     float topBoundary       = layoutSize.height;
 
     for (auto&& subWidget : container)
@@ -128,8 +132,7 @@ void LinearVerticalLayoutManager::doLayout(LayoutProtocol* layout)
                 finalPosX += mg.left;
                 finalPosY -= mg.top;
                 subWidget->setPosition(finalPosX, finalPosY);
-                topBoundary = subWidget->getPosition().y -
-                              subWidget->getAnchorPoint().y * subWidget->getBoundingBox().size.height - mg.bottom;
+                topBoundary = finalPosY - ap.y * cs.height - mg.bottom;
             }
         }
     }
@@ -199,8 +202,7 @@ void LinearCenterVerticalLayoutManager::doLayout(LayoutProtocol* layout)
                 finalPosX += mg.left;
                 finalPosY -= mg.top;
                 subWidget->setPosition(finalPosX, finalPosY);
-                topBoundary = subWidget->getPosition().y -
-                              subWidget->getAnchorPoint().y * subWidget->getBoundingBox().size.height - mg.bottom;
+                topBoundary = finalPosY - ap.y * cs.height - mg.bottom;
             }
         }
     }
@@ -247,7 +249,8 @@ void LinearCenterHorizontalLayoutManager::doLayout(LayoutProtocol* layout)
             {
                 LinearLayoutParameter::LinearGravity childGravity = layoutParameter->getGravity();
                 Vec2 ap                                           = child->getAnchorPoint();
-                Vec2 cs                                           = child->getBoundingBox().size;
+                Rect box                                          = child->getBoundingBox();
+                Vec2 cs                                           = box.size;
                 float finalPosX                                   = leftBoundary + (ap.x * cs.width);
                 float finalPosY                                   = layoutSize.height - (1.0f - ap.y) * cs.height;
                 switch (childGravity)
@@ -267,8 +270,10 @@ void LinearCenterHorizontalLayoutManager::doLayout(LayoutProtocol* layout)
                 Margin mg = layoutParameter->getMargin();
                 finalPosX += mg.left;
                 finalPosY -= mg.top;
+                // moving the child translates its bounding box, no need to measure it again
+                float offsetX = finalPosX - child->getPositionX();
                 child->setPosition(Vec2(finalPosX, finalPosY));
-                leftBoundary = child->getRightBoundary() + mg.right;
+                leftBoundary = box.getMaxX() + offsetX + mg.right;
             }
         }
     }
@@ -285,8 +290,8 @@ RelativeLayoutManager* RelativeLayoutManager::create()
 
 Vector<Widget*> RelativeLayoutManager::getAllWidgets(ax::ui::LayoutProtocol* layout)
 {
-    Vector<Node*> container = layout->getLayoutElements();
-    Vector<Widget*> widgetChildren;
+    auto&& container = layout->getLayoutElements();
+    Vector<Widget*> widgetChildren(container.size());
     for (auto&& subWidget : container)
     {
         Widget* child = dynamic_cast<Widget*>(subWidget);
@@ -302,41 +307,58 @@ Vector<Widget*> RelativeLayoutManager::getAllWidgets(ax::ui::LayoutProtocol* lay
     return widgetChildren;
 }
 
-Widget* RelativeLayoutManager::getRelativeWidget(Widget* widget)
+void RelativeLayoutManager::resolveRelativeWidgets()
 {
-    Widget* relativeWidget                   = nullptr;
-    RelativeLayoutParameter* layoutParameter = dynamic_cast<RelativeLayoutParameter*>(widget->getLayoutParameter());
-    auto relativeName                        = layoutParameter->getRelativeToWidgetName();
+    // looked up by name once per pass instead of once per child and attempt, the first widget with a name wins
+    std::unordered_map<std::string_view, ssize_t> namedWidgets;  // views into the layout parameters
+    auto count = _widgetChildren.size();
+    for (ssize_t i = 0; i < count; ++i)
+    {
+        auto layoutParameter = static_cast<RelativeLayoutParameter*>(_widgetChildren.at(i)->getLayoutParameter());
+        auto relativeName    = layoutParameter->getRelativeName();
+        if (!relativeName.empty())
+        {
+            namedWidgets.emplace(relativeName, i);
+        }
+    }
 
-    if (!relativeName.empty())
+    _relativeIndices.assign(count, -1);
+    _boundingBoxes.resize(count);
+    for (ssize_t i = 0; i < count; ++i)
     {
-        for (auto&& sWidget : _widgetChildren)
+        auto widget          = _widgetChildren.at(i);
+        auto layoutParameter = static_cast<RelativeLayoutParameter*>(widget->getLayoutParameter());
+        auto relativeName    = layoutParameter->getRelativeToWidgetName();
+        if (!relativeName.empty())
         {
-            if (sWidget)
+            auto it = namedWidgets.find(relativeName);
+            if (it != namedWidgets.end())
             {
-                RelativeLayoutParameter* rlayoutParameter =
-                    dynamic_cast<RelativeLayoutParameter*>(sWidget->getLayoutParameter());
-                if (rlayoutParameter && rlayoutParameter->getRelativeName() == relativeName)
-                {
-                    relativeWidget    = sWidget;
-                    _relativeWidgetLP = rlayoutParameter;
-                    break;
-                }
+                _relativeIndices[i] = it->second;
             }
         }
+        _boundingBoxes[i] = widget->getBoundingBox();
     }
-    return relativeWidget;
 }
 
 bool RelativeLayoutManager::calculateFinalPositionWithRelativeWidget(LayoutProtocol* layout)
 {
     Vec2 ap = _widget->getAnchorPoint();
-    Vec2 cs = _widget->getBoundingBox().size;
+    Vec2 cs = _boundingBoxes[_widgetIndex].size;
 
     _finalPositionX = 0.0f;
     _finalPositionY = 0.0f;
 
-    Widget* relativeWidget = this->getRelativeWidget(_widget);
+    // boundaries of the relative widget come from the cached bounding box
+    ssize_t relativeIndex   = _relativeIndices[_widgetIndex];
+    const Rect* relativeBox = nullptr;
+    _relativeWidgetLP       = nullptr;
+    if (relativeIndex >= 0)
+    {
+        relativeBox       = &_boundingBoxes[relativeIndex];
+        _relativeWidgetLP =
+            static_cast<RelativeLayoutParameter*>(_widgetChildren.at(relativeIndex)->getLayoutParameter());
+    }
 
     RelativeLayoutParameter* layoutParameter = dynamic_cast<RelativeLayoutParameter*>(_widget->getLayoutParameter());
 
@@ -385,163 +407,163 @@ bool RelativeLayoutManager::calculateFinalPositionWithRelativeWidget(LayoutProto
         break;
 
     case RelativeLayoutParameter::RelativeAlign::LOCATION_ABOVE_LEFTALIGN:
-        if (relativeWidget)
+        if (relativeBox)
         {
             if (_relativeWidgetLP && !_relativeWidgetLP->_put)
             {
                 return false;
             }
-            float locationTop  = relativeWidget->getTopBoundary();
-            float locationLeft = relativeWidget->getLeftBoundary();
+            float locationTop  = relativeBox->getMaxY();
+            float locationLeft = relativeBox->getMinX();
             _finalPositionY    = locationTop + ap.y * cs.height;
             _finalPositionX    = locationLeft + ap.x * cs.width;
         }
         break;
     case RelativeLayoutParameter::RelativeAlign::LOCATION_ABOVE_CENTER:
-        if (relativeWidget)
+        if (relativeBox)
         {
             if (_relativeWidgetLP && !_relativeWidgetLP->_put)
             {
                 return false;
             }
-            Vec2 rbs          = relativeWidget->getBoundingBox().size;
-            float locationTop = relativeWidget->getTopBoundary();
+            Vec2 rbs          = relativeBox->size;
+            float locationTop = relativeBox->getMaxY();
 
             _finalPositionY = locationTop + ap.y * cs.height;
-            _finalPositionX = relativeWidget->getLeftBoundary() + rbs.width * 0.5f + ap.x * cs.width - cs.width * 0.5f;
+            _finalPositionX = relativeBox->getMinX() + rbs.width * 0.5f + ap.x * cs.width - cs.width * 0.5f;
         }
         break;
     case RelativeLayoutParameter::RelativeAlign::LOCATION_ABOVE_RIGHTALIGN:
-        if (relativeWidget)
+        if (relativeBox)
         {
             if (_relativeWidgetLP && !_relativeWidgetLP->_put)
             {
                 return false;
             }
-            float locationTop   = relativeWidget->getTopBoundary();
-            float locationRight = relativeWidget->getRightBoundary();
+            float locationTop   = relativeBox->getMaxY();
+            float locationRight = relativeBox->getMaxX();
             _finalPositionY     = locationTop + ap.y * cs.height;
             _finalPositionX     = locationRight - (1.0f - ap.x) * cs.width;
         }
         break;
     case RelativeLayoutParameter::RelativeAlign::LOCATION_LEFT_OF_TOPALIGN:
-        if (relativeWidget)
+        if (relativeBox)
         {
             if (_relativeWidgetLP && !_relativeWidgetLP->_put)
             {
                 return false;
             }
-            float locationTop  = relativeWidget->getTopBoundary();
-            float locationLeft = relativeWidget->getLeftBoundary();
+            float locationTop  = relativeBox->getMaxY();
+            float locationLeft = relativeBox->getMinX();
             _finalPositionY    = locationTop - (1.0f - ap.y) * cs.height;
             _finalPositionX    = locationLeft - (1.0f - ap.x) * cs.width;
         }
         break;
     case RelativeLayoutParameter::RelativeAlign::LOCATION_LEFT_OF_CENTER:
-        if (relativeWidget)
+        if (relativeBox)
         {
             if (_relativeWidgetLP && !_relativeWidgetLP->_put)
             {
                 return false;
             }
-            Vec2 rbs           = relativeWidget->getBoundingBox().size;
-            float locationLeft = relativeWidget->getLeftBoundary();
+            Vec2 rbs           = relativeBox->size;
+            float locationLeft = relativeBox->getMinX();
             _finalPositionX    = locationLeft - (1.0f - ap.x) * cs.width;
 
             _finalPositionY =
-                relativeWidget->getBottomBoundary() + rbs.height * 0.5f + ap.y * cs.height - cs.height * 0.5f;
+                relativeBox->getMinY() + rbs.height * 0.5f + ap.y * cs.height - cs.height * 0.5f;
         }
         break;
     case RelativeLayoutParameter::RelativeAlign::LOCATION_LEFT_OF_BOTTOMALIGN:
-        if (relativeWidget)
+        if (relativeBox)
         {
             if (_relativeWidgetLP && !_relativeWidgetLP->_put)
             {
                 return false;
             }
-            float locationBottom = relativeWidget->getBottomBoundary();
-            float locationLeft   = relativeWidget->getLeftBoundary();
+            float locationBottom = relativeBox->getMinY();
+            float locationLeft   = relativeBox->getMinX();
             _finalPositionY      = locationBottom + ap.y * cs.height;
             _finalPositionX      = locationLeft - (1.0f - ap.x) * cs.width;
         }
         break;
     case RelativeLayoutParameter::RelativeAlign::LOCATION_RIGHT_OF_TOPALIGN:
-        if (relativeWidget)
+        if (relativeBox)
         {
             if (_relativeWidgetLP && !_relativeWidgetLP->_put)
             {
                 return false;
             }
-            float locationTop   = relativeWidget->getTopBoundary();
-            float locationRight = relativeWidget->getRightBoundary();
+            float locationTop   = relativeBox->getMaxY();
+            float locationRight = relativeBox->getMaxX();
             _finalPositionY     = locationTop - (1.0f - ap.y) * cs.height;
             _finalPositionX     = locationRight + ap.x * cs.width;
         }
         break;
     case RelativeLayoutParameter::RelativeAlign::LOCATION_RIGHT_OF_CENTER:
-        if (relativeWidget)
+        if (relativeBox)
         {
             if (_relativeWidgetLP && !_relativeWidgetLP->_put)
             {
                 return false;
             }
-            Vec2 rbs            = relativeWidget->getBoundingBox().size;
-            float locationRight = relativeWidget->getRightBoundary();
+            Vec2 rbs            = relativeBox->size;
+            float locationRight = relativeBox->getMaxX();
             _finalPositionX     = locationRight + ap.x * cs.width;
 
             _finalPositionY =
-                relativeWidget->getBottomBoundary() + rbs.height * 0.5f + ap.y * cs.height - cs.height * 0.5f;
+                relativeBox->getMinY() + rbs.height * 0.5f + ap.y * cs.height - cs.height * 0.5f;
         }
         break;
     case RelativeLayoutParameter::RelativeAlign::LOCATION_RIGHT_OF_BOTTOMALIGN:
-        if (relativeWidget)
+        if (relativeBox)
         {
             if (_relativeWidgetLP && !_relativeWidgetLP->_put)
             {
                 return false;
             }
-            float locationBottom = relativeWidget->getBottomBoundary();
-            float locationRight  = relativeWidget->getRightBoundary();
+            float locationBottom = relativeBox->getMinY();
+            float locationRight  = relativeBox->getMaxX();
             _finalPositionY      = locationBottom + ap.y * cs.height;
             _finalPositionX      = locationRight + ap.x * cs.width;
         }
         break;
     case RelativeLayoutParameter::RelativeAlign::LOCATION_BELOW_LEFTALIGN:
-        if (relativeWidget)
+        if (relativeBox)
         {
             if (_relativeWidgetLP && !_relativeWidgetLP->_put)
             {
                 return false;
             }
-            float locationBottom = relativeWidget->getBottomBoundary();
-            float locationLeft   = relativeWidget->getLeftBoundary();
+            float locationBottom = relativeBox->getMinY();
+            float locationLeft   = relativeBox->getMinX();
             _finalPositionY      = locationBottom - (1.0f - ap.y) * cs.height;
             _finalPositionX      = locationLeft + ap.x * cs.width;
         }
         break;
     case RelativeLayoutParameter::RelativeAlign::LOCATION_BELOW_CENTER:
-        if (relativeWidget)
+        if (relativeBox)
         {
             if (_relativeWidgetLP && !_relativeWidgetLP->_put)
             {
                 return false;
             }
-            Vec2 rbs             = relativeWidget->getBoundingBox().size;
-            float locationBottom = relativeWidget->getBottomBoundary();
+            Vec2 rbs             = relativeBox->size;
+            float locationBottom = relativeBox->getMinY();
 
             _finalPositionY = locationBottom - (1.0f - ap.y) * cs.height;
-            _finalPositionX = relativeWidget->getLeftBoundary() + rbs.width * 0.5f + ap.x * cs.width - cs.width * 0.5f;
+            _finalPositionX = relativeBox->getMinX() + rbs.width * 0.5f + ap.x * cs.width - cs.width * 0.5f;
         }
         break;
     case RelativeLayoutParameter::RelativeAlign::LOCATION_BELOW_RIGHTALIGN:
-        if (relativeWidget)
+        if (relativeBox)
         {
             if (_relativeWidgetLP && !_relativeWidgetLP->_put)
             {
                 return false;
             }
-            float locationBottom = relativeWidget->getBottomBoundary();
-            float locationRight  = relativeWidget->getRightBoundary();
+            float locationBottom = relativeBox->getMinY();
+            float locationRight  = relativeBox->getMaxX();
             _finalPositionY      = locationBottom - (1.0f - ap.y) * cs.height;
             _finalPositionX      = locationRight - (1.0f - ap.x) * cs.width;
         }
@@ -651,39 +673,50 @@ void RelativeLayoutManager::doLayout(LayoutProtocol* layout)
 {
 
     _widgetChildren = this->getAllWidgets(layout);
+    this->resolveRelativeWidgets();
 
     while (_unlayoutChildCount > 0)
     {
-        for (auto&& subWidget : _widgetChildren)
+        ssize_t placedCount = 0;
+        for (_widgetIndex = 0; _widgetIndex < _widgetChildren.size(); ++_widgetIndex)
         {
-            _widget = static_cast<Widget*>(subWidget);
+            _widget = _widgetChildren.at(_widgetIndex);
 
             RelativeLayoutParameter* layoutParameter =
-                dynamic_cast<RelativeLayoutParameter*>(_widget->getLayoutParameter());
+                static_cast<RelativeLayoutParameter*>(_widget->getLayoutParameter());
 
-            if (layoutParameter)
+            if (layoutParameter->_put)
             {
-                if (layoutParameter->_put)
-                {
-                    continue;
-                }
+                continue;
+            }
 
-                bool ret = this->calculateFinalPositionWithRelativeWidget(layout);
-                if (!ret)
-                {
-                    continue;
-                }
+            bool ret = this->calculateFinalPositionWithRelativeWidget(layout);
+            if (!ret)
+            {
+                continue;
+            }
 
-                this->calculateFinalPositionWithRelativeAlign();
+            this->calculateFinalPositionWithRelativeAlign();
 
-                _widget->setPosition(Vec2(_finalPositionX, _finalPositionY));
+            Vec2 finalPosition(_finalPositionX, _finalPositionY);
+            _boundingBoxes[_widgetIndex].origin += finalPosition - _widget->getPosition();
+            _widget->setPosition(finalPosition);
 
-                layoutParameter->_put = true;
-            }
+            layoutParameter->_put = true;
+            ++placedCount;
+        }
+        _unlayoutChildCount -= placedCount;
+
+        // the remaining widgets wait for each other or for a widget which is never placed
+        if (placedCount == 0)
+        {
+            break;
         }
-        _unlayoutChildCount--;
     }
+    _unlayoutChildCount = 0;
     _widgetChildren.clear();
+    _widget           = nullptr;
+    _relativeWidgetLP = nullptr;
 }
 
 }  // namespace ui
@@ -29,6 +29,7 @@
 
 #include "base/Object.h"
 #include "base/Vector.h"
+#include "math/Rect.h"
 #include "ui/GUIExport.h"
 
 /**
@@ -143,6 +144,7 @@ class AX_GUI_DLL RelativeLayoutManager : public LayoutManager
 private:
     RelativeLayoutManager()
         : _unlayoutChildCount(0)
+        , _widgetIndex(0)
         , _widget(nullptr)
         , _finalPositionX(0.0f)
         , _finalPositionY(0.0f)
@@ -153,12 +155,15 @@ private:
     virtual void doLayout(LayoutProtocol* layout) override;
 
     Vector<Widget*> getAllWidgets(LayoutProtocol* layout);
-    Widget* getRelativeWidget(Widget* widget);
+    void resolveRelativeWidgets();
     bool calculateFinalPositionWithRelativeWidget(LayoutProtocol* layout);
     void calculateFinalPositionWithRelativeAlign();
 
     ssize_t _unlayoutChildCount;
     Vector<Widget*> _widgetChildren;
+    std::vector<ssize_t> _relativeIndices;  // index of the widget each child is placed relative to, -1 for none
+    std::vector<Rect> _boundingBoxes;       // measured once per pass, translated when a child is placed
+    ssize_t _widgetIndex;
     Widget* _widget;
     float _finalPositionX;
     float _finalPositionY;
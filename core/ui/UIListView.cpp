@@ -48,6 +48,14 @@ ListView::ListView()
     , _curSelectedIndex(-1)
     , _innerContainerDoLayoutDirty(true)
     , _eventCallback(nullptr)
+    , _virtual(false)
+    , _numItems(0)
+    , _virtualOverscan(1)
+    , _virtualFirstIndex(0)
+    , _virtualLayoutDirty(false)
+    , _virtualDataDirty(false)
+    , _itemCreator(nullptr)
+    , _itemRenderer(nullptr)
 {
     this->setTouchEnabled(true);
 }
@@ -109,6 +117,21 @@ void ListView::onItemListChanged()
 
 void ListView::updateInnerContainerSize()
 {
+    if (_virtual)
+    {
+        float itemsLength = 0.0f;
+        if (_numItems > 0)
+        {
+            float itemLength = _direction == Direction::HORIZONTAL ? _virtualItemSize.x : _virtualItemSize.y;
+            itemsLength      = _numItems * itemLength + (_numItems - 1) * _itemsMargin;
+        }
+        if (_direction == Direction::HORIZONTAL)
+            setInnerContainerSize(Vec2(itemsLength + _leftPadding + _rightPadding, _contentSize.height));
+        else
+            setInnerContainerSize(Vec2(_contentSize.width, itemsLength + _topPadding + _bottomPadding));
+        return;
+    }
+
     switch (_direction)
     {
     case Direction::VERTICAL:
@@ -338,6 +361,10 @@ void ListView::removeAllChildrenWithCleanup(bool cleanup)
     ScrollView::removeAllChildrenWithCleanup(cleanup);
     _curSelectedIndex = -1;
     _items.clear();
+    _virtualCells.clear();
+    _virtualCellPool.clear();
+    _virtualFirstIndex = 0;
+    _virtualDataDirty  = true;
     onItemListChanged();
 }
 
@@ -530,10 +557,10 @@ void ListView::setDirection(Direction dir)
     case Direction::BOTH:
         break;
     case Direction::VERTICAL:
-        setLayoutType(Type::VERTICAL);
+        setLayoutType(_virtual ? Type::ABSOLUTE : Type::VERTICAL);
         break;
     case Direction::HORIZONTAL:
-        setLayoutType(Type::HORIZONTAL);
+        setLayoutType(_virtual ? Type::ABSOLUTE : Type::HORIZONTAL);
         break;
     default:
         return;
@@ -549,6 +576,19 @@ void ListView::requestDoLayout()
 
 void ListView::doLayout()
 {
+    if (_virtual)
+    {
+        // called on every visit, only rebinds when the window moved or something changed
+        if (_innerContainerDoLayoutDirty)
+        {
+            updateInnerContainerSize();
+            _innerContainerDoLayoutDirty = false;
+            _virtualLayoutDirty          = true;
+        }
+        updateVirtualCells();
+        return;
+    }
+
     if (!_innerContainerDoLayoutDirty)
     {
         return;
@@ -618,7 +658,7 @@ void ListView::interceptTouchEvent(TouchEventType event, Widget* sender, Touch*
         {
             if (parent && (parent->getParent() == _innerContainer))
             {
-                _curSelectedIndex = getIndex(parent);
+                _curSelectedIndex = _virtual ? getVirtualIndex(parent) : getIndex(parent);
                 break;
             }
             parent = dynamic_cast<Widget*>(parent->getParent());
@@ -813,14 +853,30 @@ void ListView::jumpToPercentBothDirection(const Vec2& percent)
 
 void ListView::jumpToItem(ssize_t itemIndex, const Vec2& positionRatioInView, const Vec2& itemAnchorPoint)
 {
-    Widget* item = getItem(itemIndex);
-    if (item == nullptr)
+    Vec2 destination;
+    if (_virtual)
     {
-        return;
+        if (itemIndex < 0 || itemIndex >= _numItems)
+        {
+            return;
+        }
+        doLayout();
+
+        const Vec2& contentSize = getContentSize();
+        Vec2 positionInView(contentSize.width * positionRatioInView.x, contentSize.height * positionRatioInView.y);
+        destination = positionInView - getVirtualItemPosition(itemIndex, itemAnchorPoint);
     }
-    doLayout();
+    else
+    {
+        Widget* item = getItem(itemIndex);
+        if (item == nullptr)
+        {
+            return;
+        }
+        doLayout();
 
-    Vec2 destination = calculateItemDestination(positionRatioInView, item, itemAnchorPoint);
+        destination = calculateItemDestination(positionRatioInView, item, itemAnchorPoint);
+    }
     if (!_bounceEnabled)
     {
         Vec2 delta         = destination - getInnerContainerPosition();
@@ -840,6 +896,19 @@ void ListView::scrollToItem(ssize_t itemIndex,
                             const Vec2& itemAnchorPoint,
                             float timeInSec)
 {
+    if (_virtual)
+    {
+        if (itemIndex < 0 || itemIndex >= _numItems)
+        {
+            return;
+        }
+        const Vec2& contentSize = getContentSize();
+        Vec2 positionInView(contentSize.width * positionRatioInView.x, contentSize.height * positionRatioInView.y);
+        startAutoScrollToDestination(positionInView - getVirtualItemPosition(itemIndex, itemAnchorPoint), timeInSec,
+                                     true);
+        return;
+    }
+
     Widget* item = getItem(itemIndex);
     if (item == nullptr)
     {
@@ -855,8 +924,7 @@ ssize_t ListView::getCurSelectedIndex() const
 
 void ListView::setCurSelectedIndex(int itemIndex)
 {
-    Widget* item = getItem(itemIndex);
-    if (item == nullptr)
+    if (_virtual ? (itemIndex < 0 || itemIndex >= _numItems) : getItem(itemIndex) == nullptr)
     {
         return;
     }
@@ -904,7 +972,8 @@ void ListView::copySpecialProperties(Widget* model)
 
 Vec2 ListView::getHowMuchOutOfBoundary(const Vec2& addition)
 {
-    if (!_magneticAllowedOutOfBoundary || _items.empty())
+    const bool noItems = _virtual ? _numItems == 0 : _items.empty();
+    if (!_magneticAllowedOutOfBoundary || noItems)
     {
         return ScrollView::getHowMuchOutOfBoundary(addition);
     }
@@ -923,29 +992,30 @@ Vec2 ListView::getHowMuchOutOfBoundary(const Vec2& addition)
     float topBoundary    = _topBoundary;
     float bottomBoundary = _bottomBoundary;
     {
-        ssize_t lastItemIndex = _items.size() - 1;
-        Vec2 contentSize      = getContentSize();
+        Vec2 contentSize   = getContentSize();
+        Vec2 firstItemSize = _virtual ? _virtualItemSize : _items.front()->getContentSize();
+        Vec2 lastItemSize  = _virtual ? _virtualItemSize : _items.back()->getContentSize();
         Vec2 firstItemAdjustment, lastItemAdjustment;
         if (_magneticType == MagneticType::CENTER)
         {
-            firstItemAdjustment = (contentSize - _items.at(0)->getContentSize()) / 2;
-            lastItemAdjustment  = (contentSize - _items.at(lastItemIndex)->getContentSize()) / 2;
+            firstItemAdjustment = (contentSize - firstItemSize) / 2;
+            lastItemAdjustment  = (contentSize - lastItemSize) / 2;
         }
         else if (_magneticType == MagneticType::LEFT)
         {
-            lastItemAdjustment = contentSize - _items.at(lastItemIndex)->getContentSize();
+            lastItemAdjustment = contentSize - lastItemSize;
         }
         else if (_magneticType == MagneticType::RIGHT)
         {
-            firstItemAdjustment = contentSize - _items.at(0)->getContentSize();
+            firstItemAdjustment = contentSize - firstItemSize;
         }
         else if (_magneticType == MagneticType::TOP)
         {
-            lastItemAdjustment = contentSize - _items.at(lastItemIndex)->getContentSize();
+            lastItemAdjustment = contentSize - lastItemSize;
         }
         else if (_magneticType == MagneticType::BOTTOM)
         {
-            firstItemAdjustment = contentSize - _items.at(0)->getContentSize();
+            firstItemAdjustment = contentSize - firstItemSize;
         }
         leftBoundary += firstItemAdjustment.x;
         rightBoundary -= lastItemAdjustment.x;
@@ -1007,7 +1077,8 @@ void ListView::startAttenuatingAutoScroll(const Vec2& deltaMove, const Vec2& ini
 {
     Vec2 adjustedDeltaMove = deltaMove;
 
-    if (!_items.empty() && _magneticType != MagneticType::NONE)
+    const bool noItems = _virtual ? _numItems == 0 : _items.empty();
+    if (!noItems && _magneticType != MagneticType::NONE)
     {
         adjustedDeltaMove = flattenVectorByDirection(adjustedDeltaMove);
 
@@ -1033,9 +1104,19 @@ void ListView::startAttenuatingAutoScroll(const Vec2& deltaMove, const Vec2& ini
             magneticPosition.x += getContentSize().width * magneticAnchorPoint.x;
             magneticPosition.y += getContentSize().height * magneticAnchorPoint.y;
 
-            Widget* pTargetItem = getClosestItemToPosition(magneticPosition - adjustedDeltaMove, magneticAnchorPoint);
-            Vec2 itemPosition   = calculateItemPositionWithAnchor(pTargetItem, magneticAnchorPoint);
-            adjustedDeltaMove   = magneticPosition - itemPosition;
+            Vec2 itemPosition;
+            if (_virtual)
+            {
+                auto targetIndex = getClosestVirtualIndex(magneticPosition - adjustedDeltaMove, magneticAnchorPoint);
+                itemPosition     = getVirtualItemPosition(targetIndex, magneticAnchorPoint);
+            }
+            else
+            {
+                Widget* pTargetItem =
+                    getClosestItemToPosition(magneticPosition - adjustedDeltaMove, magneticAnchorPoint);
+                itemPosition = calculateItemPositionWithAnchor(pTargetItem, magneticAnchorPoint);
+            }
+            adjustedDeltaMove = magneticPosition - itemPosition;
         }
     }
     ScrollView::startAttenuatingAutoScroll(adjustedDeltaMove, initialVelocity);
@@ -1043,7 +1124,8 @@ void ListView::startAttenuatingAutoScroll(const Vec2& deltaMove, const Vec2& ini
 
 void ListView::startMagneticScroll()
 {
-    if (_items.empty() || _magneticType == MagneticType::NONE)
+    const bool noItems = _virtual ? _numItems == 0 : _items.empty();
+    if (noItems || _magneticType == MagneticType::NONE)
     {
         return;
     }
@@ -1054,9 +1136,242 @@ void ListView::startMagneticScroll()
     magneticPosition.x += getContentSize().width * magneticAnchorPoint.x;
     magneticPosition.y += getContentSize().height * magneticAnchorPoint.y;
 
+    if (_virtual)
+    {
+        scrollToItem(getClosestVirtualIndex(magneticPosition, magneticAnchorPoint), magneticAnchorPoint,
+                     magneticAnchorPoint);
+        return;
+    }
     Widget* pTargetItem = getClosestItemToPosition(magneticPosition, magneticAnchorPoint);
     scrollToItem(getIndex(pTargetItem), magneticAnchorPoint, magneticAnchorPoint);
 }
 
+void ListView::setVirtual(const Vec2& itemSize,
+                          const ccListViewItemRenderer& renderer,
+                          const ccListViewItemCreator& creator)
+{
+    AXASSERT(_items.empty(), "ListView: items must be removed before switching to virtual mode");
+    AXASSERT(itemSize.x > 0 && itemSize.y > 0, "ListView: invalid virtual item size");
+
+    _virtual         = true;
+    _virtualItemSize = itemSize;
+    _itemRenderer    = renderer;
+    _itemCreator     = creator;
+    // cells are positioned by updateVirtualCells, the inner container must not lay them out
+    setLayoutType(Type::ABSOLUTE);
+    _virtualDataDirty = true;
+    requestDoLayout();
+}
+
+void ListView::setNumItems(ssize_t numItems)
+{
+    if (!_virtual || numItems == _numItems)
+    {
+        return;
+    }
+    _numItems = std::max<ssize_t>(numItems, 0);
+    if (_curSelectedIndex >= _numItems)
+    {
+        _curSelectedIndex = -1;
+    }
+    _virtualDataDirty = true;
+    onItemListChanged();
+    requestDoLayout();
+}
+
+ssize_t ListView::getNumItems() const
+{
+    return _virtual ? _numItems : _items.size();
+}
+
+void ListView::setVirtualOverscan(int overscan)
+{
+    _virtualOverscan    = std::max(overscan, 0);
+    _virtualLayoutDirty = true;
+}
+
+void ListView::refreshVirtualList()
+{
+    _virtualDataDirty = true;
+}
+
+Widget* ListView::getVirtualItem(ssize_t index) const
+{
+    ssize_t offset = index - _virtualFirstIndex;
+    if (!_virtual || offset < 0 || offset >= _virtualCells.size())
+    {
+        return nullptr;
+    }
+    return _virtualCells.at(offset);
+}
+
+ssize_t ListView::getVirtualIndex(Widget* cell) const
+{
+    ssize_t offset = _virtualCells.getIndex(cell);
+    return offset < 0 ? -1 : _virtualFirstIndex + offset;
+}
+
+void ListView::moveInnerContainer(const Vec2& deltaMove, bool canStartBounceBack)
+{
+    ScrollView::moveInnerContainer(deltaMove, canStartBounceBack);
+    if (_virtual)
+    {
+        updateVirtualCells();
+    }
+}
+
+Vec2 ListView::getVirtualItemOrigin(ssize_t index) const
+{
+    const Vec2& innerSize = _innerContainer->getContentSize();
+    Vec2 origin;
+    if (_direction == Direction::HORIZONTAL)
+    {
+        origin.x = _leftPadding + index * (_virtualItemSize.x + _itemsMargin);
+        switch (_gravity)
+        {
+        case Gravity::BOTTOM:
+            origin.y = _bottomPadding;
+            break;
+        case Gravity::CENTER_VERTICAL:
+            origin.y = (innerSize.height - _virtualItemSize.y) / 2;
+            break;
+        default:
+            origin.y = innerSize.height - _topPadding - _virtualItemSize.y;
+            break;
+        }
+    }
+    else
+    {
+        origin.y = innerSize.height - _topPadding - index * (_virtualItemSize.y + _itemsMargin) - _virtualItemSize.y;
+        switch (_gravity)
+        {
+        case Gravity::RIGHT:
+            origin.x = innerSize.width - _rightPadding - _virtualItemSize.x;
+            break;
+        case Gravity::CENTER_HORIZONTAL:
+            origin.x = (innerSize.width - _virtualItemSize.x) / 2;
+            break;
+        default:
+            origin.x = _leftPadding;
+            break;
+        }
+    }
+    return origin;
+}
+
+Vec2 ListView::getVirtualItemPosition(ssize_t index, const Vec2& itemAnchorPoint) const
+{
+    return getVirtualItemOrigin(index) +
+           Vec2(_virtualItemSize.x * itemAnchorPoint.x, _virtualItemSize.y * itemAnchorPoint.y);
+}
+
+ssize_t ListView::getClosestVirtualIndex(const Vec2& targetPosition, const Vec2& itemAnchorPoint) const
+{
+    // items are evenly spaced, so the closest one is found by rounding instead of searching
+    float index;
+    if (_direction == Direction::HORIZONTAL)
+    {
+        index = (targetPosition.x - getVirtualItemPosition(0, itemAnchorPoint).x) / (_virtualItemSize.x + _itemsMargin);
+    }
+    else
+    {
+        index = (getVirtualItemPosition(0, itemAnchorPoint).y - targetPosition.y) / (_virtualItemSize.y + _itemsMargin);
+    }
+    return std::clamp<ssize_t>(static_cast<ssize_t>(std::round(index)), 0, std::max<ssize_t>(_numItems - 1, 0));
+}
+
+void ListView::updateVirtualCells()
+{
+    // the window of items intersecting the view, extended by the overscan
+    ssize_t first = 0, last = -1;
+    if (_numItems > 0)
+    {
+        float viewStart, viewLength, stride;
+        if (_direction == Direction::HORIZONTAL)
+        {
+            viewStart  = -_innerContainer->getPositionX() - _leftPadding;
+            viewLength = _contentSize.width;
+            stride     = _virtualItemSize.x + _itemsMargin;
+        }
+        else
+        {
+            viewStart = _innerContainer->getContentSize().height + _innerContainer->getPositionY() -
+                        _contentSize.height - _topPadding;
+            viewLength = _contentSize.height;
+            stride     = _virtualItemSize.y + _itemsMargin;
+        }
+        auto firstInView = static_cast<ssize_t>(std::floor(viewStart / stride));
+        auto lastInView  = static_cast<ssize_t>(std::floor((viewStart + viewLength) / stride));
+        first            = std::max<ssize_t>(firstInView - _virtualOverscan, 0);
+        last             = std::min<ssize_t>(lastInView + _virtualOverscan, _numItems - 1);
+        if (last < first)
+        {
+            first = 0;
+            last  = -1;
+        }
+    }
+
+    const ssize_t lastCellIndex = _virtualFirstIndex + _virtualCells.size() - 1;
+    if (!_virtualLayoutDirty && !_virtualDataDirty && first == _virtualFirstIndex && last == lastCellIndex)
+    {
+        return;
+    }
+
+    // recycle the cells leaving the window
+    for (ssize_t i = 0, count = _virtualCells.size(); i < count; ++i)
+    {
+        ssize_t index = _virtualFirstIndex + i;
+        if (index < first || index > last)
+        {
+            auto cell = _virtualCells.at(i);
+            cell->setVisible(false);
+            _virtualCellPool.pushBack(cell);
+        }
+    }
+
+    Vector<Widget*> cells(static_cast<ssize_t>(last - first + 1));
+    for (ssize_t index = first; index <= last; ++index)
+    {
+        Widget* cell = nullptr;
+        bool bound   = false;
+        if (index >= _virtualFirstIndex && index <= lastCellIndex)
+        {
+            cell  = _virtualCells.at(index - _virtualFirstIndex);
+            bound = !_virtualDataDirty;
+        }
+        else if (!_virtualCellPool.empty())
+        {
+            // still retained by the inner container
+            cell = _virtualCellPool.back();
+            _virtualCellPool.popBack();
+        }
+        else
+        {
+            cell = _itemCreator ? _itemCreator(this) : (_model ? _model->clone() : nullptr);
+            if (cell == nullptr)
+            {
+                AXLOGW("ListView: no cell for virtual item {}, set an item creator or an item model", index);
+                break;
+            }
+            ScrollView::addChild(cell);
+        }
+
+        cell->setVisible(true);
+        cell->setPosition(getVirtualItemOrigin(index) +
+                          Vec2(_virtualItemSize.x * cell->getAnchorPoint().x,
+                               _virtualItemSize.y * cell->getAnchorPoint().y));
+        if (!bound && _itemRenderer)
+        {
+            _itemRenderer(this, index, cell);
+        }
+        cells.pushBack(cell);
+    }
+
+    _virtualCells       = std::move(cells);
+    _virtualFirstIndex  = first;
+    _virtualLayoutDirty = false;
+    _virtualDataDirty   = false;
+}
+
 }  // namespace ui
 }
@@ -96,6 +96,13 @@ public:
      */
     typedef std::function<void(Object*, EventType)> ccListViewCallback;
 
+    /**
+     * Virtual mode item callbacks, the creator makes a new cell when the recycling pool is empty and the renderer
+     * binds the data of an item index to a cell.
+     */
+    typedef std::function<Widget*(ListView*)> ccListViewItemCreator;
+    typedef std::function<void(ListView*, ssize_t, Widget*)> ccListViewItemRenderer;
+
     /**
      * Default constructor
      * @js ctor
@@ -389,6 +396,45 @@ public:
      */
     void scrollToItem(ssize_t itemIndex, const Vec2& positionRatioInView, const Vec2& itemAnchorPoint, float timeInSec);
 
+    /**
+     * Switch the list view to virtual mode, for lists with many items of the same size.
+     *
+     * Only the items in view, plus an overscan on both sides, exist as widgets. Cells scrolled out of the window
+     * are hidden and reused for the items scrolled in, so the number of widgets, the layout work and the visit
+     * stay proportional to the view size instead of the item count. Items are not added as children in this mode,
+     * use setNumItems and refreshVirtualList instead of the item methods. Magnetic scrolling works on item indices.
+     *
+     * @param itemSize The size every item is laid out with.
+     * @param renderer Binds an item index to a cell.
+     * @param creator Creates a cell, a clone of the item model is used when it's nullptr.
+     */
+    void setVirtual(const Vec2& itemSize,
+                    const ccListViewItemRenderer& renderer,
+                    const ccListViewItemCreator& creator = nullptr);
+    bool isVirtual() const { return _virtual; }
+
+    /**
+     * Set the number of items in virtual mode.
+     */
+    void setNumItems(ssize_t numItems);
+    ssize_t getNumItems() const;
+
+    /**
+     * Set how many items outside the view are kept bound on each side in virtual mode, 1 by default.
+     */
+    void setVirtualOverscan(int overscan);
+    int getVirtualOverscan() const { return _virtualOverscan; }
+
+    /**
+     * Bind all cells in the window again, after the data behind the items changed.
+     */
+    void refreshVirtualList();
+
+    /**
+     * @return The cell currently showing the item index in virtual mode, nullptr if it's outside the window.
+     */
+    Widget* getVirtualItem(ssize_t index) const;
+
     /**
      * @brief Query current selected widget's index.
      *
@@ -444,6 +490,13 @@ protected:
 
     void startMagneticScroll();
 
+    void moveInnerContainer(const Vec2& deltaMove, bool canStartBounceBack) override;
+    void updateVirtualCells();
+    Vec2 getVirtualItemOrigin(ssize_t index) const;
+    Vec2 getVirtualItemPosition(ssize_t index, const Vec2& itemAnchorPoint) const;
+    ssize_t getClosestVirtualIndex(const Vec2& targetPosition, const Vec2& itemAnchorPoint) const;
+    ssize_t getVirtualIndex(Widget* cell) const;
+
 protected:
     Widget* _model;
 
@@ -465,6 +518,18 @@ protected:
 
     bool _innerContainerDoLayoutDirty;
     ccListViewCallback _eventCallback;
+
+    bool _virtual;
+    Vec2 _virtualItemSize;
+    ssize_t _numItems;
+    int _virtualOverscan;
+    ssize_t _virtualFirstIndex;        // item index of the first cell in the window
+    Vector<Widget*> _virtualCells;     // cells of the window in item order
+    Vector<Widget*> _virtualCellPool;  // hidden cells ready for reuse, still children of the inner container
+    bool _virtualLayoutDirty;
+    bool _virtualDataDirty;
+    ccListViewItemCreator _itemCreator;
+    ccListViewItemRenderer _itemRenderer;
 };
 
 }  // namespace ui
@@ -552,6 +552,11 @@ void Widget::onSizeChanged()
             }
         }
     }
+
+    if (auto layoutParent = dynamic_cast<Layout*>(_parent))
+    {
+        layoutParent->onChildLayoutChanged();
+    }
 }
 
 Vec2 Widget::getVirtualRendererSize() const
@@ -1160,6 +1165,11 @@ void Widget::setLayoutParameter(LayoutParameter* parameter)
     }
     _layoutParameterDictionary.insert((int)parameter->getLayoutType(), parameter);
     _layoutParameterType = parameter->getLayoutType();
+
+    if (auto layoutParent = dynamic_cast<Layout*>(_parent))
+    {
+        layoutParent->onChildLayoutChanged();
+    }
 }
 
 LayoutParameter* Widget::getLayoutParameter() const
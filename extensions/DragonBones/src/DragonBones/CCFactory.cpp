@@ -2,11 +2,41 @@
 #include "CCTextureAtlasData.h"
 #include "CCArmatureDisplay.h"
 #include "CCSlot.h"
+#include "mio/mio.hpp"
+#include "xxhash.h"
 
 DRAGONBONES_NAMESPACE_BEGIN
 
+// Bump when JSONDataParser::writeBinaryData() changes, converted files of older versions are ignored then.
+static const uint64_t BINARY_CACHE_VERSION = 1;
+
+static std::shared_ptr<mio::mmap_source> mapFile(std::string_view fullpath)
+{
+    std::shared_ptr<mio::mmap_source> mapping;
+    auto fileStream = ax::FileUtils::getInstance()->openFileStream(fullpath, ax::IFileStream::Mode::READ);
+    if (fileStream && fileStream->nativeHandle() != (ax::osfhnd_t)-1 && fileStream->size() > 0)
+    {
+        std::error_code error;
+        mapping = std::make_shared<mio::mmap_source>();
+        mapping->map(fileStream->nativeHandle(), 0, mio::map_entire_file, error);
+        if (error || !mapping->is_mapped())
+        {
+            mapping.reset();
+        }
+    }
+
+    return mapping;
+}
+
+static std::string getBinaryCachePath(std::string_view rawData)
+{
+    const auto hash = XXH64(rawData.data(), rawData.size(), BINARY_CACHE_VERSION);
+    return fmt::format("{}dragonbones/{:016x}.dbbin", ax::FileUtils::getInstance()->getWritablePath(), hash);
+}
+
 DragonBones* CCFactory::_dragonBonesInstance = nullptr;
 CCFactory* CCFactory::_factory               = nullptr;
+hlookup::string_map<std::pair<DragonBonesData*, unsigned>> CCFactory::_sharedDragonBonesData;
 
 TextureAtlasData* CCFactory::_buildTextureAtlasData(TextureAtlasData* textureAtlasData, void* textureAtlas) const
 {
@@ -150,34 +180,204 @@ DragonBonesData* CCFactory::loadDragonBonesData(std::string_view filePath, std::
         }
     }
 
-    const auto fullpath = ax::FileUtils::getInstance()->fullPathForFilename(filePath);
-    if (ax::FileUtils::getInstance()->isFileExist(filePath))
+    const auto fileUtils = ax::FileUtils::getInstance();
+    auto fullpath        = fileUtils->fullPathForFilename(filePath);
+    if (fullpath.empty())
+    {
+        return nullptr;
+    }
+
+    auto pos = fullpath.rfind(".json");
+    if (pos != std::string::npos)
     {
-        const auto pos = fullpath.find(".json");
+        // Binary exports carry the arrays preparsed, so skip the full JSON parse when one was shipped alongside.
+        auto binaryPath = fullpath;
+        binaryPath.replace(pos, 5, ".dbbin");
+        if (fileUtils->isFileExist(binaryPath))
+        {
+            fullpath = std::move(binaryPath);
+            pos      = std::string::npos;
+        }
+    }
 
-        if (pos != std::string::npos)
+    const auto sharedKey = fmt::format("{}@{}", fullpath, scale);
+    const auto sharedIt  = _sharedDragonBonesData.find(sharedKey);
+    if (sharedIt != _sharedDragonBonesData.end())
+    {
+        const auto data    = sharedIt->second.first;
+        const auto mapName = !name.empty() ? name : std::string_view{data->name};
+        if (getDragonBonesData(mapName) != data)
         {
-            const auto data = ax::FileUtils::getInstance()->getStringFromFile(filePath);
+            addDragonBonesData(data, name);
+            _sharedDataKeys.emplace(mapName, sharedKey);
+            ++sharedIt->second.second;
+        }
+
+        return data;
+    }
 
-            return parseDragonBonesData(data.c_str(), name, scale);
+    // Texture atlases embedded in the data are added to the parsing factory only, such data is not shared.
+    const auto countTextureAtlases = [this]() {
+        std::size_t count = 0;
+        for (const auto& pair : _textureAtlasDataMap)
+        {
+            count += pair.second.size();
         }
-        else
+        return count;
+    };
+    const auto textureAtlasCount = countTextureAtlases();
+
+    DragonBonesData* data = nullptr;
+    if (pos != std::string::npos)
+    {
+        // JSON is converted to binary once, later loads only read it to find the converted file.
+        const auto rawData   = fileUtils->getStringFromFile(fullpath);
+        const auto cachePath = getBinaryCachePath(rawData);
+        if (fileUtils->isFileExist(cachePath))
+        {
+            data = _parseMappedDragonBonesData(cachePath, name, scale);
+        }
+
+        if (data == nullptr)
+        {
+            data = parseDragonBonesData(rawData.c_str(), name, scale);
+            if (data != nullptr && _dataParser == &_jsonParser)
+            {
+                _writeBinaryCache(rawData, *data, cachePath);
+            }
+        }
+    }
+    else
+    {
+        data = _parseMappedDragonBonesData(fullpath, name, scale);
+        if (data == nullptr)
         {
-#if COCOS2D_VERSION >= 0x00031200
             ax::Data cocos2dData;
-            ax::FileUtils::getInstance()->getContents(fullpath, &cocos2dData);
-#else
-            const auto cocos2dData = ax::FileUtils::getInstance()->getDataFromFile(fullpath);
-#endif
-            const auto binary = (unsigned char*)malloc(sizeof(unsigned char) * cocos2dData.getSize());
+            fileUtils->getContents(fullpath, &cocos2dData);
+            if (cocos2dData.isNull())
+            {
+                return nullptr;
+            }
+
+            const auto binary = new char[cocos2dData.getSize()];
             memcpy(binary, cocos2dData.getBytes(), cocos2dData.getSize());
-            const auto data = parseDragonBonesData((char*)binary, name, scale);
+            data = parseDragonBonesData(binary, name, scale);
+            if (data == nullptr)
+            {
+                delete[] binary;
+            }
+        }
+    }
+
+    if (data != nullptr && countTextureAtlases() == textureAtlasCount)
+    {
+        _sharedDragonBonesData.emplace(sharedKey, std::make_pair(data, 1u));
+        _sharedDataKeys.emplace(!name.empty() ? name : std::string_view{data->name}, sharedKey);
+    }
+
+    return data;
+}
 
-            return data;
+DragonBonesData* CCFactory::_parseMappedDragonBonesData(std::string_view fullpath, std::string_view name, float scale)
+{
+    const auto mapping = mapFile(fullpath);
+    if (!mapping || mapping->size() < 12 || memcmp(mapping->data(), "DBDT", 4) != 0)
+    {
+        return nullptr;
+    }
+
+    uint32_t headerLength = 0;
+    memcpy(&headerLength, mapping->data() + 8, sizeof(headerLength));
+    if (headerLength > mapping->size() - 12)
+    {
+        return nullptr;
+    }
+
+    const auto data = parseDragonBonesData(mapping->data(), name, scale);
+    if (data != nullptr)
+    {
+        data->mappedBinary = mapping;
+    }
+
+    return data;
+}
+
+void CCFactory::_writeBinaryCache(std::string_view rawData, const DragonBonesData& data, std::string_view cachePath)
+{
+    std::string binary;
+    if (!_jsonParser.writeBinaryData(rawData.data(), data, binary))
+    {
+        return;
+    }
+
+    // Written aside and renamed, so a load never maps a partly written file.
+    const auto fileUtils = ax::FileUtils::getInstance();
+    const auto tempPath  = fmt::format("{}.tmp", cachePath);
+    if (!fileUtils->createDirectories(fmt::format("{}dragonbones/", fileUtils->getWritablePath())) ||
+        !fileUtils->writeStringToFile(binary, tempPath))
+    {
+        return;
+    }
+
+    // A converted file that failed to load is replaced.
+    if (fileUtils->isFileExist(cachePath))
+    {
+        fileUtils->removeFile(cachePath);
+    }
+
+    if (!fileUtils->renameFile(tempPath, cachePath))
+    {
+        fileUtils->removeFile(tempPath);
+    }
+}
+
+void CCFactory::removeDragonBonesData(std::string_view name, bool disposeData)
+{
+    const auto iterator = _sharedDataKeys.find(name);
+    if (iterator != _sharedDataKeys.end())
+    {
+        // Other factories still build armatures from it, only the last holder may dispose it.
+        if (!_releaseSharedDragonBonesData(iterator->second))
+        {
+            disposeData = false;
         }
+
+        _sharedDataKeys.erase(iterator);
     }
 
-    return nullptr;
+    BaseFactory::removeDragonBonesData(name, disposeData);
+}
+
+void CCFactory::clear(bool disposeData)
+{
+    for (const auto& pair : _sharedDataKeys)
+    {
+        if (!_releaseSharedDragonBonesData(pair.second))
+        {
+            BaseFactory::removeDragonBonesData(pair.first, false);
+        }
+    }
+
+    _sharedDataKeys.clear();
+
+    BaseFactory::clear(disposeData);
+}
+
+bool CCFactory::_releaseSharedDragonBonesData(std::string_view key)
+{
+    const auto iterator = _sharedDragonBonesData.find(key);
+    if (iterator == _sharedDragonBonesData.end())
+    {
+        return true;
+    }
+
+    if (--iterator->second.second > 0)
+    {
+        return false;
+    }
+
+    _sharedDragonBonesData.erase(iterator);
+    return true;
 }
 
 TextureAtlasData* CCFactory::loadTextureAtlasData(std::string_view filePath, std::string_view name, float scale)
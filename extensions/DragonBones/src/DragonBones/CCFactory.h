@@ -45,6 +45,15 @@ class CCFactory : public BaseFactory
 private:
     static DragonBones* _dragonBonesInstance;
     static CCFactory* _factory;
+    /**
+     * - Parsed data shared by all factories, keyed by full path and scale, with the number of factories holding it.
+     */
+    static hlookup::string_map<std::pair<DragonBonesData*, unsigned>> _sharedDragonBonesData;
+
+    static bool _releaseSharedDragonBonesData(std::string_view key);
+
+    DragonBonesData* _parseMappedDragonBonesData(std::string_view fullpath, std::string_view name, float scale);
+    void _writeBinaryCache(std::string_view rawData, const DragonBonesData& data, std::string_view cachePath);
 
 public:
     /**
@@ -69,12 +78,16 @@ public:
 
 protected:
     std::string _prevPath;
+    /**
+     * - Shared data keys of the DragonBonesData instances this factory obtained through loadDragonBonesData.
+     */
+    hlookup::string_map<std::string> _sharedDataKeys;
 
 public:
     /**
      * @inheritDoc
      */
-    CCFactory() : _prevPath()
+    CCFactory() : _prevPath(), _sharedDataKeys()
     {
         if (_dragonBonesInstance == nullptr)
         {
@@ -102,9 +115,24 @@ protected:
                              Armature* armature) const override;
 
 public:
+    /**
+     * - Load and parse a DragonBones data from the local and cache it to the factory.
+     * A binary export (.dbbin) next to a requested .json file is preferred. Otherwise JSON files are converted to
+     * binary once, into the writable path, and later loads use the converted file. Binary files are memory mapped,
+     * and the parsed data is shared with every other factory loading the same file at the same scale.
+     * @param filePath - The file path of DragonBones data.
+     * @param name - Specify a cache name for the instance so that the instance can be obtained through this name. (If
+     * not set, use the instance name instead)
+     * @param scale - Specify a scaling value for all armatures. (Not scaled by default)
+     * @returns The DragonBonesData instance.
+     * @version DragonBones 4.5
+     * @language en_US
+     */
     virtual DragonBonesData* loadDragonBonesData(std::string_view filePath,
                                                  std::string_view name = "",
                                                  float scale           = 1.0f);
+    virtual void removeDragonBonesData(std::string_view name, bool disposeData = true) override;
+    virtual void clear(bool disposeData = true) override;
     /**
      * - Load and parse a texture atlas data and texture from the local and cache them to the factory.
      * @param  filePath - The file path of texture atlas data.
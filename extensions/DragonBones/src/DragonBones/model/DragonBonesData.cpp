@@ -11,9 +11,9 @@ void DragonBonesData::_onClear()
         pair.second->returnToPool();
     }
 
-    if (binary != nullptr)
+    if (binary != nullptr && mappedBinary == nullptr)
     {
-        delete binary;
+        delete[] binary;
     }
 
     if (userData != nullptr)
@@ -30,6 +30,7 @@ void DragonBonesData::_onClear()
     armatureNames.clear();
     armatures.clear();
     binary          = nullptr;
+    mappedBinary    = nullptr;
     intArray        = nullptr;
     floatArray      = nullptr;
     frameIntArray   = nullptr;
@@ -23,6 +23,7 @@
 #ifndef DRAGONBONES_DRAGONBONES_DATA_H
 #define DRAGONBONES_DRAGONBONES_DATA_H
 
+#include <memory>
 #include "../core/BaseObject.h"
 #include "ArmatureData.h"
 
@@ -112,6 +113,11 @@ public:
      * @internal
      */
     const char* binary;
+    /**
+     * - Keeps a memory mapped binary alive, binary points into it and is not deleted when set.
+     * @internal
+     */
+    std::shared_ptr<const void> mappedBinary;
     /**
      * @internal
      */
@@ -1,4 +1,6 @@
 ﻿#include "JSONDataParser.h"
+#include "rapidjson/stringbuffer.h"
+#include "rapidjson/writer.h"
 
 DRAGONBONES_NAMESPACE_BEGIN
 
@@ -2045,4 +2047,258 @@ bool JSONDataParser::parseTextureAtlasData(const char* rawData, TextureAtlasData
     return true;
 }
 
+void JSONDataParser::_writeBinaryArmature(rapidjson::Value& rawData,
+                                          const ArmatureData& armature,
+                                          rapidjson::Document::AllocatorType& allocator) const
+{
+    // Binary meshes only keep the offset of their vertices in the int array.
+    if (rawData.HasMember(SKIN))
+    {
+        auto& rawSkins = rawData[SKIN];
+        for (std::size_t i = 0, l = rawSkins.Size(); i < l; ++i)
+        {
+            auto& rawSkin = rawSkins[i];
+            auto skinName = _getString(rawSkin, NAME, DEFAULT_NAME);
+            if (skinName.empty())
+            {
+                skinName = DEFAULT_NAME;
+            }
+
+            const auto skin = armature.getSkin(skinName);
+            if (skin == nullptr || !rawSkin.HasMember(SLOT))
+            {
+                continue;
+            }
+
+            auto& rawSlots = rawSkin[SLOT];
+            for (std::size_t j = 0, lJ = rawSlots.Size(); j < lJ; ++j)
+            {
+                auto& rawSlot       = rawSlots[j];
+                const auto displays = skin->getDisplays(_getString(rawSlot, NAME, ""));
+                if (displays == nullptr || !rawSlot.HasMember(DISPLAY))
+                {
+                    continue;
+                }
+
+                auto& rawDisplays = rawSlot[DISPLAY];
+                for (std::size_t k = 0, lK = std::min((std::size_t)rawDisplays.Size(), displays->size()); k < lK; ++k)
+                {
+                    auto& rawDisplay   = rawDisplays[k];
+                    const auto display = (*displays)[k];
+                    if (display == nullptr || display->type != DisplayType::Mesh || rawDisplay.HasMember(SHARE))
+                    {
+                        continue;
+                    }
+
+                    rawDisplay.RemoveMember(OFFSET);
+                    rawDisplay.AddMember(rapidjson::StringRef(OFFSET),
+                                         static_cast<MeshDisplayData*>(display)->vertices.offset, allocator);
+                }
+            }
+        }
+    }
+
+    if (rawData.HasMember(ANIMATION))
+    {
+        auto& rawAnimations = rawData[ANIMATION];
+        for (std::size_t i = 0, l = rawAnimations.Size(); i < l; ++i)
+        {
+            auto& rawAnimation = rawAnimations[i];
+            auto animationName = _getString(rawAnimation, NAME, DEFAULT_NAME);
+            if (animationName.empty())
+            {
+                animationName = DEFAULT_NAME;
+            }
+
+            const auto animation = armature.getAnimation(animationName);
+            if (animation != nullptr)
+            {
+                _writeBinaryAnimation(rawAnimation, *animation, allocator);
+            }
+        }
+    }
+
+    // Frame actions are added to the armature while animations are parsed, binary frames index all of them.
+    rapidjson::Value rawActions(rapidjson::kArrayType);
+    for (const auto action : armature.actions)
+    {
+        rapidjson::Value rawAction(rapidjson::kObjectType);
+        rawAction.AddMember(rapidjson::StringRef(TYPE), (int)action->type, allocator);
+        rawAction.AddMember(rapidjson::StringRef(NAME), rapidjson::Value(action->name.c_str(), allocator), allocator);
+        if (action->bone != nullptr)
+        {
+            rawAction.AddMember(rapidjson::StringRef(BONE), rapidjson::Value(action->bone->name.c_str(), allocator),
+                                allocator);
+        }
+
+        if (action->slot != nullptr)
+        {
+            rawAction.AddMember(rapidjson::StringRef(SLOT), rapidjson::Value(action->slot->name.c_str(), allocator),
+                                allocator);
+        }
+
+        if (action->data != nullptr)
+        {
+            rapidjson::Value rawInts(rapidjson::kArrayType);
+            for (const auto value : action->data->ints)
+            {
+                rawInts.PushBack(value, allocator);
+            }
+
+            rapidjson::Value rawFloats(rapidjson::kArrayType);
+            for (const auto value : action->data->floats)
+            {
+                rawFloats.PushBack(value, allocator);
+            }
+
+            rapidjson::Value rawStrings(rapidjson::kArrayType);
+            for (const auto& value : action->data->strings)
+            {
+                rawStrings.PushBack(rapidjson::Value(value.c_str(), allocator), allocator);
+            }
+
+            rawAction.AddMember(rapidjson::StringRef(INTS), rawInts, allocator);
+            rawAction.AddMember(rapidjson::StringRef(FLOATS), rawFloats, allocator);
+            rawAction.AddMember(rapidjson::StringRef(STRINGS), rawStrings, allocator);
+        }
+
+        rawActions.PushBack(rawAction, allocator);
+    }
+
+    rawData.RemoveMember(ACTIONS);
+    rawData.AddMember(rapidjson::StringRef(ACTIONS), rawActions, allocator);
+}
+
+void JSONDataParser::_writeBinaryAnimation(rapidjson::Value& rawData,
+                                           const AnimationData& animation,
+                                           rapidjson::Document::AllocatorType& allocator) const
+{
+    const auto writeTimelines = [&allocator](const hlookup::string_map<std::vector<TimelineData*>>& timelines) {
+        rapidjson::Value rawTimelines(rapidjson::kObjectType);
+        for (const auto& pair : timelines)
+        {
+            rapidjson::Value rawOffsets(rapidjson::kArrayType);
+            for (const auto timeline : pair.second)
+            {
+                rawOffsets.PushBack((int)timeline->type, allocator);
+                rawOffsets.PushBack(timeline->offset, allocator);
+            }
+
+            rawTimelines.AddMember(rapidjson::Value(pair.first.c_str(), allocator), rawOffsets, allocator);
+        }
+
+        return rawTimelines;
+    };
+
+    // Same keys as BinaryDataParser::_parseAnimation() reads, the frames live in the arrays.
+    rapidjson::Value rawAnimation(rapidjson::kObjectType);
+    rawAnimation.AddMember(rapidjson::StringRef(NAME), rapidjson::Value(animation.name.c_str(), allocator), allocator);
+    rawAnimation.AddMember(rapidjson::StringRef(DURATION), animation.frameCount, allocator);
+    rawAnimation.AddMember(rapidjson::StringRef(PLAY_TIMES), animation.playTimes, allocator);
+    rawAnimation.AddMember(rapidjson::StringRef(FADE_IN_TIME), animation.fadeInTime, allocator);
+    rawAnimation.AddMember(rapidjson::StringRef(SCALE), animation.scale, allocator);
+
+    rapidjson::Value rawOffsets(rapidjson::kArrayType);
+    rawOffsets.PushBack(animation.frameIntOffset, allocator);
+    rawOffsets.PushBack(animation.frameFloatOffset, allocator);
+    rawOffsets.PushBack(animation.frameOffset, allocator);
+    rawAnimation.AddMember(rapidjson::StringRef(OFFSET), rawOffsets, allocator);
+
+    if (animation.actionTimeline != nullptr)
+    {
+        rawAnimation.AddMember(rapidjson::StringRef(ACTION), animation.actionTimeline->offset, allocator);
+    }
+
+    if (animation.zOrderTimeline != nullptr)
+    {
+        rawAnimation.AddMember(rapidjson::StringRef(Z_ORDER), animation.zOrderTimeline->offset, allocator);
+    }
+
+    rawAnimation.AddMember(rapidjson::StringRef(BONE), writeTimelines(animation.boneTimelines), allocator);
+    rawAnimation.AddMember(rapidjson::StringRef(SLOT), writeTimelines(animation.slotTimelines), allocator);
+    rawAnimation.AddMember(rapidjson::StringRef(CONSTRAINT), writeTimelines(animation.constraintTimelines), allocator);
+
+    rawData = rawAnimation;
+}
+
+bool JSONDataParser::writeBinaryData(const char* rawData, const DragonBonesData& data, std::string& binary) const
+{
+    DRAGONBONES_ASSERT(rawData != nullptr, "");
+
+    // The arrays of the last parse are still here, make sure they are the ones of data.
+    const auto l1 = _intArray.size() * 2;
+    const auto l2 = _floatArray.size() * 4;
+    const auto l3 = _frameIntArray.size() * 2;
+    const auto l4 = _frameFloatArray.size() * 4;
+    const auto l5 = _frameArray.size() * 2;
+    const auto l6 = _timelineArray.size() * 2;
+    if (data.binary == nullptr || data.mappedBinary != nullptr || (const char*)data.floatArray != data.binary + l1 ||
+        (const char*)data.frameIntArray != data.binary + l1 + l2 ||
+        (const char*)data.frameFloatArray != data.binary + l1 + l2 + l3 ||
+        (const char*)data.frameArray != data.binary + l1 + l2 + l3 + l4 ||
+        (const char*)data.timelineArray != data.binary + l1 + l2 + l3 + l4 + l5)
+    {
+        return false;
+    }
+
+    rapidjson::Document document;
+    document.Parse(rawData);
+    if (document.HasParseError() || !document.HasMember(ARMATURE))
+    {
+        return false;
+    }
+
+    auto& allocator    = document.GetAllocator();
+    auto& rawArmatures = document[ARMATURE];
+    if (rawArmatures.Size() != data.armatureNames.size())
+    {
+        return false;
+    }
+
+    for (std::size_t i = 0, l = rawArmatures.Size(); i < l; ++i)
+    {
+        const auto armature = data.getArmature(data.armatureNames[i]);
+        if (armature == nullptr)
+        {
+            return false;
+        }
+
+        _writeBinaryArmature(rawArmatures[i], *armature, allocator);
+    }
+
+    // Byte offsets of the arrays after the header, see BinaryDataParser::_parseArray().
+    rapidjson::Value rawOffsets(rapidjson::kArrayType);
+    const std::size_t lengths[] = {l1, l2, l3, l4, l5, l6};
+    std::size_t arrayOffset     = 0;
+    for (const auto length : lengths)
+    {
+        rawOffsets.PushBack((unsigned)arrayOffset, allocator);
+        rawOffsets.PushBack((unsigned)length, allocator);
+        arrayOffset += length;
+    }
+
+    document.RemoveMember(OFFSET);
+    document.AddMember(rapidjson::StringRef(OFFSET), rawOffsets, allocator);
+
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    document.Accept(writer);
+
+    // Pad the header so the float arrays stay 4 bytes aligned.
+    std::string header(buffer.GetString(), buffer.GetSize());
+    header.resize((header.size() + 8 + 4 + 3) / 4 * 4 - 8 - 4, ' ');
+
+    const uint32_t version      = 0;
+    const uint32_t headerLength = (uint32_t)header.size();
+    binary.clear();
+    binary.reserve(8 + 4 + header.size() + arrayOffset);
+    binary.append("DBDT", 4);
+    binary.append((const char*)&version, 4);
+    binary.append((const char*)&headerLength, 4);
+    binary.append(header);
+    binary.append(data.binary, arrayOffset);
+
+    return true;
+}
+
 DRAGONBONES_NAMESPACE_END
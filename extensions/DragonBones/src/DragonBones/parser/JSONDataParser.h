@@ -224,6 +224,12 @@ private:
                            BoneData* bone,
                            SlotData* slot);
     unsigned _parseCacheActionFrame(ActionFrame& frame);
+    void _writeBinaryArmature(rapidjson::Value& rawData,
+                              const ArmatureData& armature,
+                              rapidjson::Document::AllocatorType& allocator) const;
+    void _writeBinaryAnimation(rapidjson::Value& rawData,
+                               const AnimationData& animation,
+                               rapidjson::Document::AllocatorType& allocator) const;
 
 protected:
     virtual ArmatureData* _parseArmature(const rapidjson::Value& rawData, float scale);
@@ -279,6 +285,17 @@ public:
     virtual bool parseTextureAtlasData(const char* rawData,
                                        TextureAtlasData& textureAtlasData,
                                        float scale = 1.0f) override;
+    /**
+     * - Write the binary (DBDT) form of JSON data, which BinaryDataParser loads without building the arrays again.
+     * Must be called right after parseDragonBonesData() returned data for the same raw data, the arrays it built are
+     * reused.
+     * @param rawData - The JSON data.
+     * @param data - The data parsed from rawData.
+     * @param binary - Receives the binary data.
+     * @returns Whether the binary data was written.
+     * @language en_US
+     */
+    bool writeBinaryData(const char* rawData, const DragonBonesData& data, std::string& binary) const;
 };
 
 DRAGONBONES_NAMESPACE_END
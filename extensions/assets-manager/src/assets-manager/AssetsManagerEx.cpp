@@ -26,8 +26,14 @@
 #include "EventListenerAssetsManagerEx.h"
 #include "base/UTF8.h"
 #include "base/Director.h"
+#include "base/Utils.h"
+#include "base/ZipUtils.h"
+#include "yasio/string_view.hpp"
 
 #include <stdio.h>
+#include <atomic>
+#include <unordered_set>
+#include <zlib.h>
 
 #ifdef MINIZIP_FROM_SYSTEM
 #    include <minizip/unzip.h>
@@ -46,10 +52,19 @@ NS_AX_EXT_BEGIN
 #define BUFFER_SIZE                8192
 #define MAX_FILENAME               512
 
+#define DECOMPRESS_MAX_WORKERS     4
+
 #define DEFAULT_CONNECTION_TIMEOUT 45
 
 #define SAVE_POINT_INTERVAL        0.1
 
+#define PATCH_SUFFIX               ".patch"
+#define TEMP_SUFFIX                ".tmp"
+#define PATCH_MAGIC                "AXDP"
+#define PATCH_VERSION              1
+#define PATCH_OP_COPY              0
+#define PATCH_OP_INSERT            1
+
 const std::string AssetsManagerEx::VERSION_ID  = "@version";
 const std::string AssetsManagerEx::MANIFEST_ID = "@manifest";
 
@@ -165,8 +180,75 @@ int AssetManagerEx_error_file_func(voidpf opaque, voidpf stream)
 }
 // End of Overrides
 
+// Patches, rebuilds and downloads in progress leave these behind when interrupted
+static bool AssetManagerEx_isTransientFile(std::string_view path)
+{
+    return cxx20::ends_with(path, PATCH_SUFFIX) || cxx20::ends_with(path, TEMP_SUFFIX) ||
+           cxx20::ends_with(path, TEMP_SUFFIX ".digest") || cxx20::ends_with(path, TEMP_SUFFIX ".segments");
+}
+
 // Implementation of AssetsManagerEx
 
+bool AssetsManagerEx::applyPatch(const Data& base, const Data& patchData, Data& output, uint64_t maxSize)
+{
+    const uint8_t* patch = patchData.getBytes();
+    size_t patchSize     = static_cast<size_t>(patchData.getSize());
+    yasio::byte_buffer inflated;
+    if (ZipUtils::isGZipBuffer(patch, patchSize))
+    {
+        inflated  = ZipUtils::decompressGZ(patch, patchSize);
+        patch     = inflated.data();
+        patchSize = inflated.size();
+    }
+
+    size_t pos     = 0;
+    auto readPatch = [&](void* dst, size_t len) {
+        if (patchSize - pos < len)
+            return false;
+        memcpy(dst, patch + pos, len);
+        pos += len;
+        return true;
+    };
+
+    char magic[4];
+    uint32_t version    = 0;
+    uint64_t targetSize = 0, baseSize = 0;
+    if (!readPatch(magic, sizeof(magic)) || memcmp(magic, PATCH_MAGIC, sizeof(magic)) != 0 ||
+        !readPatch(&version, sizeof(version)) || version != PATCH_VERSION ||
+        !readPatch(&targetSize, sizeof(targetSize)) || targetSize > maxSize ||
+        !readPatch(&baseSize, sizeof(baseSize)) || baseSize != static_cast<uint64_t>(base.getSize()))
+        return false;
+
+    auto out        = output.resize(static_cast<ssize_t>(targetSize));
+    uint64_t filled = 0;
+    while (filled < targetSize)
+    {
+        uint8_t op      = 0;
+        uint32_t length = 0;
+        if (!readPatch(&op, sizeof(op)))
+            return false;
+
+        if (op == PATCH_OP_COPY)
+        {
+            uint64_t offset = 0;
+            if (!readPatch(&offset, sizeof(offset)) || !readPatch(&length, sizeof(length)) || offset > baseSize ||
+                length > baseSize - offset || length > targetSize - filled)
+                return false;
+            memcpy(out + filled, base.getBytes() + offset, length);
+        }
+        else if (op == PATCH_OP_INSERT)
+        {
+            if (!readPatch(&length, sizeof(length)) || length > targetSize - filled || !readPatch(out + filled, length))
+                return false;
+        }
+        else
+            return false;
+
+        filled += length;
+    }
+    return true;
+}
+
 AssetsManagerEx::AssetsManagerEx(std::string_view manifestUrl, std::string_view storagePath) : _manifestUrl(manifestUrl)
 {
     // Init variables
@@ -175,7 +257,8 @@ AssetsManagerEx::AssetsManagerEx(std::string_view manifestUrl, std::string_view
     _eventName          = EventListenerAssetsManagerEx::LISTENER_ID + pointer;
     _fileUtils          = FileUtils::getInstance();
 
-    network::DownloaderHints hints = {static_cast<uint32_t>(_maxConcurrentTask), DEFAULT_CONNECTION_TIMEOUT, ".tmp"};
+    network::DownloaderHints hints = {static_cast<uint32_t>(_maxConcurrentTask), DEFAULT_CONNECTION_TIMEOUT,
+                                      TEMP_SUFFIX};
     _downloader                    = std::shared_ptr<network::Downloader>(new network::Downloader(hints));
     _downloader->onTaskError = std::bind(&AssetsManagerEx::onError, this, std::placeholders::_1, std::placeholders::_2,
                                          std::placeholders::_3, std::placeholders::_4);
@@ -216,6 +299,10 @@ AssetsManagerEx* AssetsManagerEx::create(std::string_view manifestUrl, std::stri
 void AssetsManagerEx::initManifests(std::string_view manifestUrl)
 {
     _inited = true;
+    // A verified update was interrupted while being moved into the storage, finish it before loading the manifest
+    if (_fileUtils->isFileExist(_tempStoragePath + MANIFEST_FILENAME))
+        swapInTempStorage();
+
     // Init and load local manifest
     _localManifest = new Manifest();
     loadLocalManifest(manifestUrl);
@@ -423,16 +510,25 @@ bool AssetsManagerEx::decompress(std::string_view zip)
         return false;
     }
 
-    // Buffer to hold data read from the zip file
-    char readBuffer[BUFFER_SIZE];
-    // Loop to extract all files.
+    // Walk the central directory once: create every directory and remember where each file entry is, the entries
+    // are then extracted concurrently
+    struct ZipEntry
+    {
+        std::string fullPath;
+        unz64_file_pos filePos;
+        uint64_t size;
+        uint32_t crc;
+    };
+    std::vector<ZipEntry> entries;
+    entries.reserve(global_info.number_entry);
+
     uLong i;
     for (i = 0; i < global_info.number_entry; ++i)
     {
         // Get info about current file.
-        unz_file_info fileInfo;
+        unz_file_info64 fileInfo;
         char fileName[MAX_FILENAME];
-        if (unzGetCurrentFileInfo(zipfile, &fileInfo, fileName, MAX_FILENAME, NULL, 0, NULL, 0) != UNZ_OK)
+        if (unzGetCurrentFileInfo64(zipfile, &fileInfo, fileName, MAX_FILENAME, NULL, 0, NULL, 0) != UNZ_OK)
         {
             AXLOGD("AssetsManagerEx : can not read compressed file info\n");
             unzClose(zipfile);
@@ -469,65 +565,116 @@ bool AssetsManagerEx::decompress(std::string_view zip)
                     return false;
                 }
             }
-            // Entry is a file, so extract it.
-            // Open current file.
-            if (unzOpenCurrentFile(zipfile) != UNZ_OK)
+
+            ZipEntry entry;
+            entry.fullPath = std::move(fullPath);
+            entry.size     = fileInfo.uncompressed_size;
+            entry.crc      = fileInfo.crc;
+            if (unzGetFilePos64(zipfile, &entry.filePos) != UNZ_OK)
             {
-                AXLOGD("AssetsManagerEx : can not extract file {}\n", fileName);
+                AXLOGD("AssetsManagerEx : can not locate file {} in the zip\n", entry.fullPath);
                 unzClose(zipfile);
                 return false;
             }
+            entries.emplace_back(std::move(entry));
+        }
 
-            // Create a file to store current file.
-            auto fsOut = FileUtils::getInstance()->openFileStream(fullPath, IFileStream::Mode::WRITE);
-            if (!fsOut)
+        // Goto next entry listed in the zip file.
+        if ((i + 1) < global_info.number_entry)
+        {
+            if (unzGoToNextFile(zipfile) != UNZ_OK)
             {
-                AXLOGD("AssetsManagerEx : can not create decompress destination file {} (errno: {})\n", fullPath,
-                      errno);
-                unzCloseCurrentFile(zipfile);
+                AXLOGD("AssetsManagerEx : can not read next file for decompressing\n");
                 unzClose(zipfile);
                 return false;
             }
+        }
+    }
+
+    unzClose(zipfile);
+
+    // Largest first so one big entry doesn't start last and hold up the others
+    std::sort(entries.begin(), entries.end(), [](const ZipEntry& a, const ZipEntry& b) { return a.size > b.size; });
+
+    std::atomic<size_t> nextEntry{0};
+    std::atomic<bool> failed{false};
+
+    // Each worker reads through its own zip handle with one fixed buffer, memory stays bounded whatever the entry
+    // sizes. The crc is checked while writing, no second pass over the extracted files.
+    auto extractProc = [&, zip = std::string{zip}]() {
+        // started after the other workers took every entry
+        if (nextEntry >= entries.size() || failed)
+            return;
+
+        zlib_filefunc_def_s workerOverrides;
+        fillZipFunctionOverrides(workerOverrides);
+        AssetManagerExZipFileInfo workerZipInfo;
+        workerZipInfo.zipFileName = zip;
+        workerOverrides.opaque    = &workerZipInfo;
+
+        unzFile workerZip = unzOpen2(zip.c_str(), &workerOverrides);
+        if (!workerZip)
+        {
+            AXLOGD("AssetsManagerEx : can not open downloaded zip file {}\n", zip);
+            failed = true;
+            return;
+        }
+
+        char readBuffer[BUFFER_SIZE];
+        for (size_t index = nextEntry++; index < entries.size() && !failed; index = nextEntry++)
+        {
+            auto& entry = entries[index];
+            if (unzGoToFilePos64(workerZip, &entry.filePos) != UNZ_OK || unzOpenCurrentFile(workerZip) != UNZ_OK)
+            {
+                AXLOGD("AssetsManagerEx : can not extract file {}\n", entry.fullPath);
+                failed = true;
+                break;
+            }
+
+            // Create a file to store current file.
+            auto fsOut = FileUtils::getInstance()->openFileStream(entry.fullPath, IFileStream::Mode::WRITE);
+            if (!fsOut)
+            {
+                AXLOGD("AssetsManagerEx : can not create decompress destination file {} (errno: {})\n",
+                       entry.fullPath, errno);
+                unzCloseCurrentFile(workerZip);
+                failed = true;
+                break;
+            }
 
             // Write current file content to destinate file.
-            int error = UNZ_OK;
+            uLong crc        = crc32(0L, Z_NULL, 0);
+            uint64_t written = 0;
+            int error        = UNZ_OK;
             do
             {
-                error = unzReadCurrentFile(zipfile, readBuffer, BUFFER_SIZE);
-                if (error < 0)
-                {
-                    AXLOGD("AssetsManagerEx : can not read zip file {}, error code is {}\n", fileName, error);
-                    fsOut.reset();
-                    unzCloseCurrentFile(zipfile);
-                    unzClose(zipfile);
-                    return false;
-                }
-
+                error = unzReadCurrentFile(workerZip, readBuffer, BUFFER_SIZE);
                 if (error > 0)
                 {
-                    fsOut->write(readBuffer, error);
+                    crc = crc32(crc, reinterpret_cast<const Bytef*>(readBuffer), error);
+                    written += error;
+                    if (fsOut->write(readBuffer, error) != error)
+                        error = UNZ_ERRNO;
                 }
-            } while (error > 0);
+            } while (error > 0 && !failed);
 
             fsOut.reset();
-        }
+            unzCloseCurrentFile(workerZip);
 
-        unzCloseCurrentFile(zipfile);
-
-        // Goto next entry listed in the zip file.
-        if ((i + 1) < global_info.number_entry)
-        {
-            if (unzGoToNextFile(zipfile) != UNZ_OK)
+            if (error < 0 || (!failed && (written != entry.size || crc != entry.crc)))
             {
-                AXLOGD("AssetsManagerEx : can not read next file for decompressing\n");
-                unzClose(zipfile);
-                return false;
+                AXLOGD("AssetsManagerEx : can not read zip file {}, error code is {}\n", entry.fullPath, error);
+                failed = true;
             }
         }
-    }
 
-    unzClose(zipfile);
-    return true;
+        unzClose(workerZip);
+    };
+
+    const size_t workerCount = std::min<size_t>(DECOMPRESS_MAX_WORKERS, entries.size());
+    Director::getInstance()->getJobSystem()->parallelFor(workerCount, [&](size_t) { extractProc(); });
+
+    return !failed;
 }
 
 void AssetsManagerEx::decompressDownloadedZip(std::string_view customId, std::string_view storagePath)
@@ -573,6 +720,171 @@ void AssetsManagerEx::decompressDownloadedZip(std::string_view customId, std::st
         [decompressFinished, asyncData]() { decompressFinished(asyncData); });
 }
 
+void AssetsManagerEx::planDownloadUnit(DownloadUnit& unit,
+                                       const Manifest::AssetDiff& diff,
+                                       const hlookup::string_map<std::string>& installedByMd5,
+                                       hlookup::string_map<std::string>& downloadingByMd5)
+{
+    auto& asset = diff.asset;
+    if (asset.md5.empty() || asset.compressed)
+        return;
+
+    // Same content already installed, maybe moved or shared between assets
+    auto installedIt = installedByMd5.find(asset.md5);
+    if (installedIt != installedByMd5.end())
+    {
+        auto fullPath = _fileUtils->fullPathForFilename(installedIt->second);
+        if (!fullPath.empty())
+        {
+            unit.srcUrl.clear();
+            unit.basePath = std::move(fullPath);
+            unit.size     = 0;
+            return;
+        }
+    }
+
+    // Same content downloaded by another asset of this update
+    auto downloadingIt = downloadingByMd5.find(asset.md5);
+    if (downloadingIt != downloadingByMd5.end())
+    {
+        unit.srcUrl.clear();
+        unit.basePath = _downloadUnits[downloadingIt->second].storagePath;
+        unit.size     = 0;
+        _contentAliases[downloadingIt->second].emplace_back(unit.customId);
+        return;
+    }
+    downloadingByMd5.emplace(asset.md5, unit.customId);
+
+    if (diff.type != Manifest::DiffType::MODIFIED || asset.patches.empty() || asset.size <= 0)
+        return;
+
+    auto localIt = _localManifest->getAssets().find(unit.customId);
+    if (localIt == _localManifest->getAssets().end() || localIt->second.md5.empty())
+        return;
+
+    auto patchIt = std::find_if(asset.patches.begin(), asset.patches.end(),
+                                [&](const ManifestAssetPatch& patch) { return patch.baseMd5 == localIt->second.md5; });
+    if (patchIt == asset.patches.end())
+        return;
+
+    auto basePath = _fileUtils->fullPathForFilename(localIt->second.path);
+    if (!basePath.empty())
+    {
+        unit.srcUrl = _remoteManifest->getPackageUrl();
+        unit.srcUrl += patchIt->path;
+        unit.basePath = std::move(basePath);
+        unit.size     = patchIt->size;
+    }
+}
+
+void AssetsManagerEx::rebuildAsset(const DownloadUnit& unit, std::string_view patchPath)
+{
+    struct AsyncData
+    {
+        std::string customId;
+        std::string basePath;
+        std::string patchPath;
+        std::string outPath;
+        std::string md5;
+        uint64_t size;
+        bool succeed;
+    };
+
+    AsyncData* asyncData = new AsyncData;
+    asyncData->customId  = unit.customId;
+    asyncData->basePath  = unit.basePath;
+    asyncData->patchPath = patchPath;
+    asyncData->outPath   = unit.storagePath;
+    asyncData->succeed   = false;
+
+    auto& assets = _remoteManifest->getAssets();
+    auto assetIt = assets.find(unit.customId);
+    asyncData->size = 0;
+    if (assetIt != assets.end())
+    {
+        asyncData->md5  = assetIt->second.md5;
+        asyncData->size = static_cast<uint64_t>(assetIt->second.size);
+    }
+
+    // Kept alive until the rebuilt asset is handed back on the main thread
+    this->retain();
+    Director::getInstance()->getJobSystem()->enqueue(
+        [fileUtils = _fileUtils, asyncData]() {
+        Data output;
+        if (asyncData->patchPath.empty())
+            output = fileUtils->getDataFromFile(asyncData->basePath);
+        else
+        {
+            Data base  = fileUtils->getDataFromFile(asyncData->basePath);
+            Data patch = fileUtils->getDataFromFile(asyncData->patchPath);
+            if (!applyPatch(base, patch, output, asyncData->size))
+                output.clear();
+            fileUtils->removeFile(asyncData->patchPath);
+        }
+
+        // Written aside then renamed over the asset, the temp file is never swapped in, see swapInTempStorage
+        if (!output.isNull() && cxx20::ic::iequals(utils::getDataMD5Hash(output), asyncData->md5))
+        {
+            std::string tempPath = asyncData->outPath + TEMP_SUFFIX;
+            asyncData->succeed   = fileUtils->writeDataToFile(output, tempPath) &&
+                                 fileUtils->renameFile(tempPath, asyncData->outPath);
+            if (!asyncData->succeed)
+                fileUtils->removeFile(tempPath);
+        }
+    },
+        [this, asyncData]() {
+        bool ok = asyncData->succeed;
+        if (ok && _verifyCallback != nullptr)
+        {
+            auto& assets = _remoteManifest->getAssets();
+            auto assetIt = assets.find(asyncData->customId);
+            if (assetIt != assets.end())
+                ok = _verifyCallback(asyncData->outPath, assetIt->second);
+        }
+
+        if (ok)
+            fileSuccess(asyncData->customId, asyncData->outPath);
+        else
+            fallbackToFullDownload(asyncData->customId);
+        delete asyncData;
+        this->release();
+    });
+}
+
+void AssetsManagerEx::fallbackToFullDownload(std::string_view customId)
+{
+    auto unitIt  = _downloadUnits.find(customId);
+    auto& assets = _remoteManifest->getAssets();
+    auto assetIt = assets.find(customId);
+    if (unitIt == _downloadUnits.end() || assetIt == assets.end() || unitIt->second.basePath.empty())
+    {
+        fileError(customId, "Unable to rebuild asset from local content");
+        return;
+    }
+
+    AXLOGD("AssetsManagerEx : can not rebuild {} locally, downloading it in full\n", customId);
+    DownloadUnit& unit = unitIt->second;
+    unit.basePath.clear();
+    unit.srcUrl = _remoteManifest->getPackageUrl();
+    unit.srcUrl += assetIt->second.path;
+
+    _queue.emplace_back(unit.customId);
+    _currConcurrentTask = MAX(0, _currConcurrentTask - 1);
+    queueDowload();
+}
+
+void AssetsManagerEx::releaseContentAliases(std::string_view customId)
+{
+    auto aliasIt = _contentAliases.find(customId);
+    if (aliasIt == _contentAliases.end())
+        return;
+
+    // On failure the copies fail too and fall back to downloading their own content
+    for (auto&& alias : aliasIt->second)
+        _queue.emplace_back(alias);
+    _contentAliases.erase(aliasIt);
+}
+
 void AssetsManagerEx::dispatchUpdateEvent(EventAssetsManagerEx::EventCode code,
                                           std::string_view assetId /* = ""*/,
                                           std::string_view message /* = ""*/,
@@ -798,6 +1110,17 @@ void AssetsManagerEx::startUpdate()
             std::string_view packageUrl = _remoteManifest->getPackageUrl();
             // Save current download manifest information for resuming
             _tempManifest->saveToFile(_tempManifestPath);
+
+            // Installed content by md5, identical files are copied instead of downloaded
+            hlookup::string_map<std::string> installedByMd5;
+            for (auto&& asset : _localManifest->getAssets())
+            {
+                if (!asset.second.md5.empty() && !asset.second.compressed)
+                    installedByMd5.emplace(asset.second.md5, asset.second.path);
+            }
+            hlookup::string_map<std::string> downloadingByMd5;
+            _contentAliases.clear();
+
             // Preprocessing local files in previous version and creating download folders
             for (auto it = diff_map.begin(); it != diff_map.end(); ++it)
             {
@@ -811,6 +1134,7 @@ void AssetsManagerEx::startUpdate()
                     unit.srcUrl += path;
                     unit.storagePath = _tempStoragePath + path;
                     unit.size        = diff.asset.size;
+                    planDownloadUnit(unit, diff, installedByMd5, downloadingByMd5);
                     _downloadUnits.emplace(unit.customId, unit);
                     _tempManifest->setAssetDownloadState(it->first, Manifest::DownloadState::UNSTARTED);
                 }
@@ -832,35 +1156,7 @@ void AssetsManagerEx::updateSucceed()
     std::string fileName     = MANIFEST_FILENAME;
     _fileUtils->renameFile(_tempStoragePath, tempFileName, fileName);
     // 2. merge temporary storage path to storage path so that temporary version turns to cached version
-    if (_fileUtils->isDirectoryExist(_tempStoragePath))
-    {
-        // Merging all files in temp storage path to storage path
-        std::vector<std::string> files;
-        _fileUtils->listFilesRecursively(_tempStoragePath, &files);
-        int baseOffset = (int)_tempStoragePath.length();
-        std::string relativePath, dstPath;
-        for (std::vector<std::string>::iterator it = files.begin(); it != files.end(); ++it)
-        {
-            relativePath.assign((*it).substr(baseOffset));
-            dstPath.assign(_storagePath + relativePath);
-            // Create directory
-            if (relativePath.back() == '/')
-            {
-                _fileUtils->createDirectories(dstPath);
-            }
-            // Copy file
-            else
-            {
-                if (_fileUtils->isFileExist(dstPath))
-                {
-                    _fileUtils->removeFile(dstPath);
-                }
-                _fileUtils->renameFile(*it, dstPath);
-            }
-        }
-        // Remove temp storage path
-        _fileUtils->removeDirectory(_tempStoragePath);
-    }
+    swapInTempStorage();
     // 3. swap the localManifest
     AX_SAFE_RELEASE(_localManifest);
     _localManifest = _remoteManifest;
@@ -874,6 +1170,39 @@ void AssetsManagerEx::updateSucceed()
     dispatchUpdateEvent(EventAssetsManagerEx::EventCode::UPDATE_FINISHED);
 }
 
+void AssetsManagerEx::swapInTempStorage()
+{
+    if (!_fileUtils->isDirectoryExist(_tempStoragePath))
+        return;
+
+    // Merging all files in temp storage path to storage path. renameFile replaces the destination, though not
+    // atomically on Windows (delete then move): an interrupted swap can lose an asset, the manifest goes last so
+    // the old version stays in charge and the next update fetches it again. Leftovers of interrupted downloads
+    // and rebuilds are never swapped in.
+    std::vector<std::string> files;
+    _fileUtils->listFilesRecursively(_tempStoragePath, &files);
+    int baseOffset = (int)_tempStoragePath.length();
+    std::string relativePath, dstPath;
+    for (std::vector<std::string>::iterator it = files.begin(); it != files.end(); ++it)
+    {
+        relativePath.assign((*it).substr(baseOffset));
+        dstPath.assign(_storagePath + relativePath);
+        // Create directory
+        if (relativePath.back() == '/')
+        {
+            _fileUtils->createDirectories(dstPath);
+        }
+        // The manifest commits the new version, it goes last
+        else if (relativePath != MANIFEST_FILENAME && !AssetManagerEx_isTransientFile(relativePath))
+        {
+            _fileUtils->renameFile(*it, dstPath);
+        }
+    }
+    _fileUtils->renameFile(_tempStoragePath + MANIFEST_FILENAME, _storagePath + MANIFEST_FILENAME);
+    // Remove temp storage path
+    _fileUtils->removeDirectory(_tempStoragePath);
+}
+
 void AssetsManagerEx::checkUpdate()
 {
     if (_updateEntry != UpdateEntry::NONE)
@@ -1013,6 +1342,7 @@ void AssetsManagerEx::updateAssets(const DownloadUnits& assets)
         _totalWaitToDownload = _totalToDownload = (int)assets.size();
         _nextSavePoint                          = 0;
         _totalEnabled                           = false;
+        _contentAliases.clear();
         if (_totalToDownload > 0)
         {
             _downloadUnits = assets;
@@ -1054,6 +1384,7 @@ void AssetsManagerEx::fileError(std::string_view identifier,
                         errorCodeInternal);
     _tempManifest->setAssetDownloadState(identifier, Manifest::DownloadState::UNSTARTED);
 
+    releaseContentAliases(identifier);
     _currConcurrentTask = MAX(0, _currConcurrentTask - 1);
     queueDowload();
 }
@@ -1084,6 +1415,7 @@ void AssetsManagerEx::fileSuccess(std::string_view customId, std::string_view st
     // Notify asset updated event
     dispatchUpdateEvent(EventAssetsManagerEx::EventCode::ASSET_UPDATED, customId);
 
+    releaseContentAliases(customId);
     _currConcurrentTask = MAX(0, _currConcurrentTask - 1);
     queueDowload();
 }
@@ -1183,6 +1515,14 @@ void AssetsManagerEx::onSuccess(std::string_view /*srcUrl*/, std::string_view st
     }
     else
     {
+        // A binary patch arrived, the asset itself is rebuilt from it
+        auto unitIt = _downloadUnits.find(customId);
+        if (unitIt != _downloadUnits.end() && !unitIt->second.basePath.empty())
+        {
+            rebuildAsset(unitIt->second, storagePath);
+            return;
+        }
+
         bool ok      = true;
         auto& assets = _remoteManifest->getAssets();
         auto assetIt = assets.find(customId);
@@ -1223,6 +1563,10 @@ void AssetsManagerEx::destroyDownloadedVersion()
 void AssetsManagerEx::batchDownload()
 {
     _queue.clear();
+    std::unordered_set<std::string_view> aliases;
+    for (const auto& iter : _contentAliases)
+        aliases.insert(iter.second.begin(), iter.second.end());
+
     for (const auto& iter : _downloadUnits)
     {
         const DownloadUnit& unit = iter.second;
@@ -1231,8 +1575,15 @@ void AssetsManagerEx::batchDownload()
             _totalSize += unit.size;
             _sizeCollected++;
         }
+        // Local copies download nothing
+        else if (unit.srcUrl.empty())
+        {
+            _sizeCollected++;
+        }
 
-        _queue.emplace_back(iter.first);
+        // Waits for the asset with the same content, queued once that one is done
+        if (aliases.find(iter.first) == aliases.end())
+            _queue.emplace_back(iter.first);
     }
     // All collected, enable total size
     if (_sizeCollected == _totalToDownload)
@@ -1259,7 +1610,12 @@ void AssetsManagerEx::queueDowload()
         _currConcurrentTask++;
         DownloadUnit& unit = _downloadUnits[key];
         _fileUtils->createDirectories(basename(unit.storagePath));
-        _downloader->createDownloadFileTask(unit.srcUrl, unit.storagePath, unit.customId);
+        if (unit.srcUrl.empty())
+            rebuildAsset(unit, "");
+        else if (!unit.basePath.empty())
+            _downloader->createDownloadFileTask(unit.srcUrl, unit.storagePath + PATCH_SUFFIX, unit.customId);
+        else
+            _downloader->createDownloadFileTask(unit.srcUrl, unit.storagePath, unit.customId);
 
         _tempManifest->setAssetDownloadState(key, Manifest::DownloadState::DOWNLOADING);
     }
@@ -136,6 +136,15 @@ public:
         _verifyCallback = callback;
     };
 
+    /** @brief Rebuilds a file from its base and a binary patch, see ManifestAssetPatch for the format.
+     * @param base      Content of the older version the patch applies to
+     * @param patch     The patch, optionally gzip compressed
+     * @param output    Receives the rebuilt file
+     * @param maxSize   Patches producing a larger file are rejected
+     * @return false when the patch is malformed or doesn't apply to base
+     */
+    static bool applyPatch(const Data& base, const Data& patch, Data& output, uint64_t maxSize);
+
     AssetsManagerEx(std::string_view manifestUrl, std::string_view storagePath);
 
     virtual ~AssetsManagerEx();
@@ -170,6 +179,31 @@ protected:
     bool decompress(std::string_view filename);
     void decompressDownloadedZip(std::string_view customId, std::string_view storagePath);
 
+    /** @brief Plans how an added or modified asset is obtained: copied from an installed file with the same md5,
+     * copied from another asset of this update with the same md5 once that one is done, patched from the installed
+     * version when the manifest offers a patch for it, or downloaded in full.
+     */
+    void planDownloadUnit(DownloadUnit& unit,
+                          const Manifest::AssetDiff& diff,
+                          const hlookup::string_map<std::string>& installedByMd5,
+                          hlookup::string_map<std::string>& downloadingByMd5);
+
+    /** @brief Rebuilds an asset on a worker thread from unit.basePath, patched with patchPath when given, checks it
+     * against the manifest md5 and moves it in place. Falls back to a full download when any of it fails.
+     */
+    void rebuildAsset(const DownloadUnit& unit, std::string_view patchPath);
+
+    void fallbackToFullDownload(std::string_view customId);
+
+    /** @brief Queues the assets waiting for the content of customId.
+     */
+    void releaseContentAliases(std::string_view customId);
+
+    /** @brief Moves every file of the temporary storage into the storage, the manifest last so an interrupted swap
+     * is finished on the next launch.
+     */
+    void swapInTempStorage();
+
     /** @brief Update a list of assets under the current AssetsManagerEx context
      */
     void updateAssets(const DownloadUnits& assets);
@@ -297,6 +331,9 @@ private:
     //! Download queue
     std::vector<std::string> _queue;
 
+    //! Assets copied from the content of another asset of this update once it's done, by the asset they wait for
+    hlookup::string_map<std::vector<std::string>> _contentAliases;
+
     //! Max concurrent task count for downloading
     int _maxConcurrentTask = 32;
 
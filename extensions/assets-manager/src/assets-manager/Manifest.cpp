@@ -47,6 +47,7 @@
 #define KEY_SIZE "size"
 #define KEY_COMPRESSED_FILE "compressedFile"
 #define KEY_DOWNLOAD_STATE "downloadState"
+#define KEY_PATCHES "patches"
 
 NS_AX_EXT_BEGIN
 
@@ -451,6 +452,25 @@ Manifest::Asset Manifest::parseAsset(std::string_view path, const rapidjson::Val
     else
         asset.downloadState = DownloadState::UNMARKED;
 
+    // "patches": { "<md5 of an older version>": { "path": "...", "size": 1024 }, ... }
+    if (json.HasMember(KEY_PATCHES) && json[KEY_PATCHES].IsObject())
+    {
+        const rapidjson::Value& patches = json[KEY_PATCHES];
+        for (rapidjson::Value::ConstMemberIterator itr = patches.MemberBegin(); itr != patches.MemberEnd(); ++itr)
+        {
+            if (!itr->value.IsObject() || !itr->value.HasMember(KEY_PATH) || !itr->value[KEY_PATH].IsString())
+                continue;
+
+            ManifestAssetPatch patch;
+            patch.baseMd5 = itr->name.GetString();
+            patch.path    = itr->value[KEY_PATH].GetString();
+            patch.size    = 0;
+            if (itr->value.HasMember(KEY_SIZE) && itr->value[KEY_SIZE].IsInt())
+                patch.size = itr->value[KEY_SIZE].GetInt();
+            asset.patches.emplace_back(std::move(patch));
+        }
+    }
+
     return asset;
 }
 
@@ -47,6 +47,26 @@ struct DownloadUnit
     std::string storagePath;
     std::string customId;
     float size;
+    //! Local file the asset is rebuilt from: the base of a binary patch downloaded from srcUrl, or a file with
+    //! identical content to copy when srcUrl is empty
+    std::string basePath;
+};
+
+/** A binary patch turning an older version of an asset into the current one.
+ *
+ * The patch file holds, in little endian, the magic "AXDP", a uint32 format version (1), the uint64 sizes of the
+ * resulting file and of the base file, then instructions until the result is complete: a uint8 0 followed by a
+ * uint64 base offset and a uint32 length copies bytes from the base, a uint8 1 followed by a uint32 length inserts
+ * that many literal bytes. The whole patch may be gzip compressed.
+ * The size of the asset bounds the rebuilt file, patches of an asset without a size are not used.
+ */
+struct ManifestAssetPatch
+{
+    //! md5 of the installed version the patch applies to
+    std::string baseMd5;
+    //! Path of the patch file relative to the package url
+    std::string path;
+    float size;
 };
 
 struct ManifestAsset
@@ -56,6 +76,8 @@ struct ManifestAsset
     bool compressed;
     float size;
     int downloadState;
+    //! Patches from older versions of this asset [Optional]
+    std::vector<ManifestAssetPatch> patches;
 };
 
 typedef hlookup::string_map<DownloadUnit> DownloadUnits;
@@ -906,48 +906,7 @@ Node* CSLoader::createNode(const Data& data, const ccNodeLoadCallback& callback)
         AX_BREAK_IF(data.isNull() || data.getSize() <= 0);
         auto csparsebinary = GetCSParseBinary(data.getBytes());
         AX_BREAK_IF(nullptr == csparsebinary);
-        auto csBuildId = csparsebinary->version();
-        if (csBuildId)
-        {
-            int readerVersion = 0, writterVersion = 0;
-            // parse writter version
-            int revisionIndex = 0;
-            fast_split(csBuildId->c_str(), '.', [&](const char* start, const char* end) {
-                auto endv  = const_cast<char*>(end);
-                char charS = *endv;
-                switch (++revisionIndex)
-                {
-                case 3:
-                    *endv          = '\0';
-                    writterVersion = atoi(start);
-                    *endv          = charS;
-                    break;
-                }
-            });
-
-            // parse reader version
-            revisionIndex = 0;
-            fast_split(&loader->_csBuildID.front(), '.', [&](char* start, char* end) {
-                auto endv  = const_cast<char*>(end);
-                char charS = *endv;
-                switch (++revisionIndex)
-                {
-                case 3:
-                    *endv         = '\0';
-                    readerVersion = atoi(start);
-                    *endv         = charS;
-                    break;
-                }
-            });
-#    if _AX_DEBUG > 0
-            std::string prompt = fmt::format(
-                    "{}{}{}{}{}{}{}{}{}{}", "The reader build id of your Cocos exported file(", csBuildId->c_str(),
-                    ") and the reader build id in your axmol(", loader->_csBuildID.c_str(),
-                    ") are not match.\n", "Please get the correct reader(build id ", csBuildId->c_str(), ")from ",
-                    "https://github.com/axmolengine/axmol", " and replace it in your axmol");
-            AXASSERT(readerVersion >= writterVersion, prompt.c_str());
-#endif
-        }
+        loader->checkBuildVersion(csparsebinary->version());
 
         // decode plist
         auto textures   = csparsebinary->textures();
@@ -1026,7 +985,27 @@ Node* CSLoader::nodeWithFlatBuffersFile(std::string_view fileName, const ccNodeL
 
     auto csparsebinary = GetCSParseBinary(buf.getBytes());
 
-    auto csBuildId = csparsebinary->version();
+    checkBuildVersion(csparsebinary->version());
+
+    // decode plist
+    auto textures   = csparsebinary->textures();
+    int textureSize = textures->size();
+    for (int i = 0; i < textureSize; ++i)
+    {
+        std::string_view plist = textures->Get(i)->c_str();
+        if (!SpriteFrameCache::getInstance()->isSpriteFramesWithFileLoaded(plist))
+        {
+            SpriteFrameCache::getInstance()->addSpriteFramesWithFile(plist);
+        }
+    }
+
+    Node* node = nodeWithFlatBuffers(csparsebinary->nodeTree(), callback);
+
+    return node;
+}
+
+void CSLoader::checkBuildVersion(const flatbuffers::String* csBuildId)
+{
     if (csBuildId)
     {
         int readerVersion = 0, writterVersion = 0;
@@ -1061,7 +1040,7 @@ Node* CSLoader::nodeWithFlatBuffersFile(std::string_view fileName, const ccNodeL
         });
 #    if _AX_DEBUG > 0
         auto prompt = fmt::format(
-                "%s%s%s%s%s%s%s%s%s%s", "The reader build id of your Cocos exported file(", csBuildId->c_str(),
+                "{}{}{}{}{}{}{}{}{}{}", "The reader build id of your Cocos exported file(", csBuildId->c_str(),
                 ") and the reader build id in your axmol(", _csBuildID, ") are not match.\n",
                 "Please get the correct reader(build id ", csBuildId->c_str(), ")from ",
                 "https://github.com/axmolengine/axmol", " and replace it in your axmol");
@@ -1073,25 +1052,8 @@ Node* CSLoader::nodeWithFlatBuffersFile(std::string_view fileName, const ccNodeL
                 fmt::format("error: The csloader version not match, require version is:{}, but {} provided!",
                                     csBuildId->c_str(), _csBuildID);
             throw std::logic_error(exceptionMsg.c_str());
-            return nullptr;
-        }
-    }
-
-    // decode plist
-    auto textures   = csparsebinary->textures();
-    int textureSize = textures->size();
-    for (int i = 0; i < textureSize; ++i)
-    {
-        std::string_view plist = textures->Get(i)->c_str();
-        if (!SpriteFrameCache::getInstance()->isSpriteFramesWithFileLoaded(plist))
-        {
-            SpriteFrameCache::getInstance()->addSpriteFramesWithFile(plist);
         }
     }
-
-    Node* node = nodeWithFlatBuffers(csparsebinary->nodeTree(), callback);
-
-    return node;
 }
 
 Node* CSLoader::nodeWithFlatBuffers(const flatbuffers::NodeTree* nodetree)
@@ -1104,76 +1066,122 @@ Node* CSLoader::nodeWithFlatBuffers(const flatbuffers::NodeTree* nodetree, const
     if (nodetree == nullptr)
         return nullptr;
 
-    {
-        Node* node = nullptr;
+    Node* node = nullptr;
 
-        std::string classname = nodetree->classname()->c_str();
+    std::string_view classname = nodetree->classname()->c_str();
+    if (classname == "ProjectNode")
+    {
+        node = createProjectNode(nodetree, callback, false);
+    }
+    else if (classname == "SimpleAudio")
+    {
+        node = createAudioNode(nodetree);
+    }
+    else
+    {
+        std::string customClassName;
+        auto reader = getNodeReader(nodetree, customClassName);
+        node        = createNodeWithReader(nodetree, reader, customClassName);
+    }
 
-        auto options = nodetree->options();
+    // If node is invalid, there is no necessity to process children of node.
+    if (!node)
+    {
+        return nullptr;
+    }
 
-        if (classname == "ProjectNode")
+    auto children = nodetree->children();
+    int size      = children->size();
+    for (int i = 0; i < size; ++i)
+    {
+        auto subNodeTree = children->Get(i);
+        Node* child      = nodeWithFlatBuffers(subNodeTree, callback);
+        if (child)
         {
-            auto reader             = ProjectNodeReader::getInstance();
-            auto projectNodeOptions = (ProjectNodeOptions*)options->data();
-            std::string filePath    = projectNodeOptions->fileName()->c_str();
+            addChildWithFlatBuffers(node, child);
 
-            cocostudio::timeline::ActionTimeline* action = nullptr;
-            if (!filePath.empty() && FileUtils::getInstance()->isFileExist(filePath))
+            if (callback)
             {
-                Data buf = FileUtils::getInstance()->getDataFromFile(filePath);
-                node     = createNode(buf, callback);
-                action   = createTimeline(buf, filePath);
-            }
-            else
-            {
-                node = Node::create();
-            }
-            reader->setPropsWithFlatBuffers(node, (const flatbuffers::Table*)options->data());
-            if (action)
-            {
-                action->setTimeSpeed(projectNodeOptions->innerActionSpeed());
-                node->runAction(action);
-                action->gotoFrameAndPause(0);
+                callback(child);
             }
         }
-        else if (classname == "SimpleAudio")
-        {
-            node                 = Node::create();
-            auto reader          = ComAudioReader::getInstance();
-            Component* component = reader->createComAudioWithFlatBuffers((const flatbuffers::Table*)options->data());
-            if (component)
-            {
-                component->setName(PlayableFrame::PLAYABLE_EXTENTION);
-                node->addComponent(component);
-                reader->setPropsWithFlatBuffers(node, (const flatbuffers::Table*)options->data());
-            }
-        }
-        else
-        {
-            std::string customClassName = nodetree->customClassName()->c_str();
-            if (customClassName != "")
-            {
-                classname = customClassName;
-            }
-            std::string readername{getGUIClassName(classname)};
-            readername.append("Reader");
-
-            NodeReaderProtocol* reader =
-                dynamic_cast<NodeReaderProtocol*>(ObjectFactory::getInstance()->createObject(readername));
-            if (reader == nullptr)
-                reader = dynamic_cast<NodeReaderProtocol*>(
-                    ObjectFactory::getInstance()->createObject("CustomRootNodeReader"));
-            if (reader != nullptr)
-            {
-                if (!customClassName.empty())
-                    reader->setCurrentCustomClassName(customClassName.c_str());
+    }
 
-                node = reader->createNodeWithFlatBuffers((const flatbuffers::Table*)options->data());
-            }
-            else
-            {
-                auto exceptionMsg = fmt::format(
-                    R"(error: Missing custom reader class name:{}, please config at your project fiile xxx.xsxproj like follow:
+    return node;
+}
+
+Node* CSLoader::createProjectNode(const flatbuffers::NodeTree* nodetree,
+                                  const ccNodeLoadCallback& callback,
+                                  bool usePrototype)
+{
+    Node* node              = nullptr;
+    auto options            = nodetree->options();
+    auto reader             = ProjectNodeReader::getInstance();
+    auto projectNodeOptions = (ProjectNodeOptions*)options->data();
+    std::string filePath    = projectNodeOptions->fileName()->c_str();
+
+    cocostudio::timeline::ActionTimeline* action = nullptr;
+    if (usePrototype && !filePath.empty() && getExtentionName(filePath) == "csb")
+    {
+        // nested files are instantiated from their own prototype, the timeline comes from ActionTimelineCache
+        node = createNodeFromPrototype(filePath, callback);
+        if (node)
+            action = createTimeline(filePath);
+    }
+    else if (!filePath.empty() && FileUtils::getInstance()->isFileExist(filePath))
+    {
+        Data buf = FileUtils::getInstance()->getDataFromFile(filePath);
+        node     = createNode(buf, callback);
+        action   = createTimeline(buf, filePath);
+    }
+    if (!node)
+    {
+        node = Node::create();
+    }
+    reader->setPropsWithFlatBuffers(node, (const flatbuffers::Table*)options->data());
+    if (action)
+    {
+        action->setTimeSpeed(projectNodeOptions->innerActionSpeed());
+        node->runAction(action);
+        action->gotoFrameAndPause(0);
+    }
+    return node;
+}
+
+Node* CSLoader::createAudioNode(const flatbuffers::NodeTree* nodetree)
+{
+    auto options         = nodetree->options();
+    auto node            = Node::create();
+    auto reader          = ComAudioReader::getInstance();
+    Component* component = reader->createComAudioWithFlatBuffers((const flatbuffers::Table*)options->data());
+    if (component)
+    {
+        component->setName(PlayableFrame::PLAYABLE_EXTENTION);
+        node->addComponent(component);
+        reader->setPropsWithFlatBuffers(node, (const flatbuffers::Table*)options->data());
+    }
+    return node;
+}
+
+NodeReaderProtocol* CSLoader::getNodeReader(const flatbuffers::NodeTree* nodetree, std::string& customClassName)
+{
+    std::string classname = nodetree->classname()->c_str();
+    customClassName       = nodetree->customClassName()->c_str();
+    if (customClassName != "")
+    {
+        classname = customClassName;
+    }
+    std::string readername{getGUIClassName(classname)};
+    readername.append("Reader");
+
+    NodeReaderProtocol* reader =
+        dynamic_cast<NodeReaderProtocol*>(ObjectFactory::getInstance()->createObject(readername));
+    if (reader == nullptr)
+        reader = dynamic_cast<NodeReaderProtocol*>(ObjectFactory::getInstance()->createObject("CustomRootNodeReader"));
+    if (reader == nullptr)
+    {
+        auto exceptionMsg = fmt::format(
+            R"(error: Missing custom reader class name:{}, please config at your project fiile xxx.xsxproj like follow:
     <Project>
       <publish-opts>
          <custom-readers>
@@ -1182,81 +1190,213 @@ Node* CSLoader::nodeWithFlatBuffers(const flatbuffers::NodeTree* nodetree, const
       </publish-opts>
     </Project>
 )",
-                    readername, readername);
-                throw std::logic_error(exceptionMsg.c_str());
-            }
+            readername, readername);
+        throw std::logic_error(exceptionMsg.c_str());
+    }
+    return reader;
+}
 
-            Widget* widget = dynamic_cast<Widget*>(node);
-            if (widget)
-            {
-                auto callbackName = widget->getCallbackName();
-                auto callbackType = widget->getCallbackType();
+Node* CSLoader::createNodeWithReader(const flatbuffers::NodeTree* nodetree,
+                                     NodeReaderProtocol* reader,
+                                     std::string_view customClassName)
+{
+    if (!customClassName.empty())
+        reader->setCurrentCustomClassName(customClassName.data());
 
-                bindCallback(callbackName, callbackType, widget, _rootNode);
-            }
+    Node* node = reader->createNodeWithFlatBuffers((const flatbuffers::Table*)nodetree->options()->data());
 
-            /* To reconstruct nest node as WidgetCallBackHandlerProtocol. */
-            auto callbackHandler = dynamic_cast<WidgetCallBackHandlerProtocol*>(node);
-            if (callbackHandler)
-            {
-                _callbackHandlers.pushBack(node);
-                _rootNode = _callbackHandlers.back();
-            }
-            /**/
-            //        _loadingNodeParentHierarchy.emplace_back(node);
-        }
+    Widget* widget = dynamic_cast<Widget*>(node);
+    if (widget)
+    {
+        auto callbackName = widget->getCallbackName();
+        auto callbackType = widget->getCallbackType();
 
-        // If node is invalid, there is no necessity to process children of node.
-        if (!node)
+        bindCallback(callbackName, callbackType, widget, _rootNode);
+    }
+
+    /* To reconstruct nest node as WidgetCallBackHandlerProtocol. */
+    auto callbackHandler = dynamic_cast<WidgetCallBackHandlerProtocol*>(node);
+    if (callbackHandler)
+    {
+        _callbackHandlers.pushBack(node);
+        _rootNode = _callbackHandlers.back();
+    }
+    return node;
+}
+
+void CSLoader::addChildWithFlatBuffers(Node* node, Node* child)
+{
+    if (auto pageView = dynamic_cast<PageView*>(node))
+    {
+        Layout* layout = dynamic_cast<Layout*>(child);
+        if (layout)
         {
-            return nullptr;
+            pageView->addPage(layout);
         }
-
-        auto children = nodetree->children();
-        int size      = children->size();
-        for (int i = 0; i < size; ++i)
+    }
+    else if (auto listView = dynamic_cast<ListView*>(node))
+    {
+        Widget* widget = dynamic_cast<Widget*>(child);
+        if (widget)
         {
-            auto subNodeTree = children->Get(i);
-            Node* child      = nodeWithFlatBuffers(subNodeTree, callback);
-            if (child)
-            {
-                if (auto pageView = dynamic_cast<PageView*>(node))
-                {
-                    Layout* layout = dynamic_cast<Layout*>(child);
-                    if (layout)
-                    {
-                        pageView->addPage(layout);
-                    }
-                }
-                else if (auto listView = dynamic_cast<ListView*>(node))
-                {
-                    Widget* widget = dynamic_cast<Widget*>(child);
-                    if (widget)
-                    {
-                        listView->pushBackCustomItem(widget);
-                    }
-                }
-                else if (auto radioButtonGroup = dynamic_cast<RadioButtonGroup*>(node))
-                {
-                    radioButtonGroup->addRadioButton(dynamic_cast<RadioButton*>(child));
-                    radioButtonGroup->addChild(child);
-                }
-                else
-                {
-                    node->addChild(child);
-                }
+            listView->pushBackCustomItem(widget);
+        }
+    }
+    else if (auto radioButtonGroup = dynamic_cast<RadioButtonGroup*>(node))
+    {
+        radioButtonGroup->addRadioButton(dynamic_cast<RadioButton*>(child));
+        radioButtonGroup->addChild(child);
+    }
+    else
+    {
+        node->addChild(child);
+    }
+}
 
-                if (callback)
-                {
-                    callback(child);
-                }
-            }
+Node* CSLoader::createNodeFromPrototype(std::string_view filename, const ccNodeLoadCallback& callback)
+{
+    CSLoader* loader = CSLoader::getInstance();
+    auto prototype   = loader->getPrototype(filename);
+    if (!prototype)
+        return nullptr;
+
+    Node* node = loader->instantiatePrototype(*prototype, callback);
+
+    loader->reconstructNestNode(node);
+
+    return node;
+}
+
+void CSLoader::removePrototype(std::string_view filename)
+{
+    _prototypes.erase(FileUtils::getInstance()->fullPathForFilename(filename));
+}
+
+void CSLoader::removeAllPrototypes()
+{
+    _prototypes.clear();
+}
+
+std::shared_ptr<CSLoader::NodePrototype> CSLoader::getPrototype(std::string_view filename)
+{
+    std::string fullPath = FileUtils::getInstance()->fullPathForFilename(filename);
+
+    auto it = _prototypes.find(fullPath);
+    if (it != _prototypes.end())
+        return it->second;
+
+    auto prototype  = std::make_shared<NodePrototype>();
+    prototype->data = FileUtils::getInstance()->getDataFromFile(fullPath);
+    if (prototype->data.isNull())
+    {
+        AXLOGD("CSLoader::getPrototype - failed read file: {}", filename);
+        return nullptr;
+    }
+
+    auto csparsebinary = GetCSParseBinary(prototype->data.getBytes());
+    checkBuildVersion(csparsebinary->version());
+
+    auto textures = csparsebinary->textures();
+    for (unsigned int i = 0; i < textures->size(); ++i)
+        prototype->textures.emplace_back(textures->Get(i)->c_str());
+
+    flattenPrototype(*prototype, csparsebinary->nodeTree());
+
+    _prototypes.emplace(std::move(fullPath), prototype);
+    return prototype;
+}
+
+void CSLoader::flattenPrototype(NodePrototype& prototype, const flatbuffers::NodeTree* nodetree)
+{
+    if (nodetree == nullptr)
+        return;
+
+    auto index = prototype.instructions.size();
+    prototype.instructions.emplace_back();
+
+    auto& instruction    = prototype.instructions.back();
+    instruction.nodeTree = nodetree;
+
+    std::string_view classname = nodetree->classname()->c_str();
+    if (classname == "ProjectNode")
+        instruction.type = NodePrototype::Type::PROJECT_NODE;
+    else if (classname == "SimpleAudio")
+        instruction.type = NodePrototype::Type::AUDIO;
+    else
+        instruction.reader = getNodeReader(nodetree, instruction.customClassName);
+
+    auto children = nodetree->children();
+    int size      = children->size();
+    for (int i = 0; i < size; ++i)
+        flattenPrototype(prototype, children->Get(i));
+
+    prototype.instructions[index].subtreeSize = static_cast<uint32_t>(prototype.instructions.size() - index);
+}
+
+Node* CSLoader::instantiatePrototype(const NodePrototype& prototype, const ccNodeLoadCallback& callback)
+{
+    auto spriteFrameCache = SpriteFrameCache::getInstance();
+    for (auto& plist : prototype.textures)
+    {
+        if (!spriteFrameCache->isSpriteFramesWithFileLoaded(plist))
+            spriteFrameCache->addSpriteFramesWithFile(plist);
+    }
+
+    // the instructions are in pre-order, a node is attached to its parent once its whole subtree is built,
+    // which matches the order of nodeWithFlatBuffers
+    struct Pending
+    {
+        Node* node;
+        uint32_t end;
+    };
+    std::vector<Pending> parents;
+    Node* root  = nullptr;
+    auto finish = [&]() {
+        auto done = parents.back();
+        parents.pop_back();
+        if (parents.empty())
+        {
+            root = done.node;
+            return;
         }
+        addChildWithFlatBuffers(parents.back().node, done.node);
+        if (callback)
+            callback(done.node);
+    };
+
+    const auto count = static_cast<uint32_t>(prototype.instructions.size());
+    for (uint32_t i = 0; i < count;)
+    {
+        while (!parents.empty() && i >= parents.back().end)
+            finish();
 
-        //    _loadingNodeParentHierarchy.pop_back();
+        auto& instruction = prototype.instructions[i];
+        Node* node        = nullptr;
+        switch (instruction.type)
+        {
+        case NodePrototype::Type::PROJECT_NODE:
+            node = createProjectNode(instruction.nodeTree, callback, true);
+            break;
+        case NodePrototype::Type::AUDIO:
+            node = createAudioNode(instruction.nodeTree);
+            break;
+        default:
+            node = createNodeWithReader(instruction.nodeTree, instruction.reader, instruction.customClassName);
+        }
 
-        return node;
+        if (!node)
+        {
+            // skip the subtree, same as nodeWithFlatBuffers
+            i += instruction.subtreeSize;
+            continue;
+        }
+        parents.push_back(Pending{node, i + instruction.subtreeSize});
+        ++i;
     }
+    while (!parents.empty())
+        finish();
+
+    return root;
 }
 
 bool CSLoader::bindCallback(std::string_view callbackName,
@@ -52,6 +52,7 @@ struct ComAudioOptions;
 namespace cocostudio
 {
 class ComAudio;
+class NodeReaderProtocol;
 }
 
 namespace cocostudio
@@ -85,6 +86,16 @@ public:
     static ax::Node* createNodeWithVisibleSize(std::string_view filename);
     static ax::Node* createNodeWithVisibleSize(std::string_view filename, const ccNodeLoadCallback& callback);
 
+    /**
+     * Create a node from the cached prototype of a .csb file. The first call reads the file, checks its version
+     * and flattens the node tree with the readers resolved, later calls only replay that list, which suits nodes
+     * created many times such as list cells. Nested project nodes are created from their own prototypes.
+     */
+    static ax::Node* createNodeFromPrototype(std::string_view filename, const ccNodeLoadCallback& callback = nullptr);
+
+    void removePrototype(std::string_view filename);
+    void removeAllPrototypes();
+
     static cocostudio::timeline::ActionTimeline* createTimeline(std::string_view filename);
     static cocostudio::timeline::ActionTimeline* createTimeline(const Data& data, std::string_view filename);
 
@@ -123,6 +134,44 @@ protected:
     ax::Node* nodeWithFlatBuffersFile(std::string_view fileName, const ccNodeLoadCallback& callback);
     ax::Node* nodeWithFlatBuffers(const flatbuffers::NodeTree* nodetree, const ccNodeLoadCallback& callback);
 
+    struct NodePrototype
+    {
+        enum class Type : uint8_t
+        {
+            READER,
+            PROJECT_NODE,
+            AUDIO,
+        };
+        struct Instruction
+        {
+            const flatbuffers::NodeTree* nodeTree  = nullptr;
+            cocostudio::NodeReaderProtocol* reader = nullptr;
+            std::string customClassName;
+            uint32_t subtreeSize = 1;  // this node and all of its descendants
+            Type type            = Type::READER;
+        };
+
+        Data data;  // the .csb content, nodeTree pointers point into it
+        std::vector<std::string> textures;
+        std::vector<Instruction> instructions;  // the node tree in pre-order
+    };
+
+    void checkBuildVersion(const flatbuffers::String* csBuildId);
+
+    ax::Node* createProjectNode(const flatbuffers::NodeTree* nodetree,
+                                const ccNodeLoadCallback& callback,
+                                bool usePrototype);
+    ax::Node* createAudioNode(const flatbuffers::NodeTree* nodetree);
+    cocostudio::NodeReaderProtocol* getNodeReader(const flatbuffers::NodeTree* nodetree, std::string& customClassName);
+    ax::Node* createNodeWithReader(const flatbuffers::NodeTree* nodetree,
+                                   cocostudio::NodeReaderProtocol* reader,
+                                   std::string_view customClassName);
+    void addChildWithFlatBuffers(ax::Node* node, ax::Node* child);
+
+    std::shared_ptr<NodePrototype> getPrototype(std::string_view filename);
+    void flattenPrototype(NodePrototype& prototype, const flatbuffers::NodeTree* nodetree);
+    ax::Node* instantiatePrototype(const NodePrototype& prototype, const ccNodeLoadCallback& callback);
+
     ax::Node* loadNode(const rapidjson::Value& json);
 
     void locateNodeWithMulresPosition(ax::Node* node, const rapidjson::Value& json);
@@ -172,6 +221,8 @@ protected:
     ax::Vector<ax::Node*> _callbackHandlers;
 
     std::string _csBuildID;
+
+    std::unordered_map<std::string, std::shared_ptr<NodePrototype>> _prototypes;
 };
 
 }
@@ -149,7 +149,8 @@ void SkeletonNode::updateVertices()
             _squareVertices[i] += _anchorPointInPoints;
         }
 
-        _transformUpdated = _transformDirty = _inverseDirty = _contentSizeDirty = true;
+        _contentSizeDirty = true;
+        markTransformDirty();
     }
 }
 
@@ -159,7 +160,8 @@ void SkeletonNode::updateColor()
     {
         _vertexData[i].color = _rackColor;
     }
-    _transformUpdated = _transformDirty = _inverseDirty = _contentSizeDirty = true;
+    _contentSizeDirty = true;
+    markTransformDirty();
 }
 
 void SkeletonNode::visit(ax::Renderer* renderer, const ax::Mat4& parentTransform, uint32_t parentFlags)
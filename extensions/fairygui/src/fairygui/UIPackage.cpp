@@ -89,12 +89,8 @@ UIPackage* UIPackage::getByName(const string& name)
         return nullptr;
 }
 
-UIPackage* UIPackage::addPackage(const string& assetPath)
+void UIPackage::createEmptyTexture()
 {
-    auto it = _packageInstById.find(assetPath);
-    if (it != _packageInstById.end())
-        return it->second;
-
     if (_emptyTexture == nullptr)
     {
         Image* emptyImage = new Image();
@@ -103,6 +99,25 @@ UIPackage* UIPackage::addPackage(const string& assetPath)
         _emptyTexture->initWithImage(emptyImage);
         delete emptyImage;
     }
+}
+
+UIPackage* UIPackage::registerPackage(UIPackage* pkg)
+{
+    _packageInstById[pkg->getId()] = pkg;
+    _packageInstByName[pkg->getName()] = pkg;
+    _packageInstById[pkg->_assetPath] = pkg;
+    _packageList.push_back(pkg);
+
+    return pkg;
+}
+
+UIPackage* UIPackage::addPackage(const string& assetPath)
+{
+    auto it = _packageInstById.find(assetPath);
+    if (it != _packageInstById.end())
+        return it->second;
+
+    createEmptyTexture();
 
     Data data;
 
@@ -123,13 +138,137 @@ UIPackage* UIPackage::addPackage(const string& assetPath)
         delete pkg;
         return nullptr;
     }
+    pkg->resolveSharedState();
 
-    _packageInstById[pkg->getId()] = pkg;
-    _packageInstByName[pkg->getName()] = pkg;
-    _packageInstById[assetPath] = pkg;
-    _packageList.push_back(pkg);
+    return registerPackage(pkg);
+}
 
-    return pkg;
+void UIPackage::addPackageAsync(const string& assetPath,
+                                const std::function<void(UIPackage*)>& callback,
+                                const std::function<void(float)>& progressCallback)
+{
+    auto it = _packageInstById.find(assetPath);
+    if (it != _packageInstById.end())
+    {
+        if (progressCallback)
+            progressCallback(1);
+        if (callback)
+            callback(it->second);
+        return;
+    }
+
+    createEmptyTexture();
+
+    // the descriptor is read and parsed off the main thread, nothing in loadPackage touches the renderer or the
+    // static state resolveSharedState reads
+    auto loaded = std::make_shared<UIPackage*>(nullptr);
+    Director::getInstance()->getJobSystem()->enqueue(
+        [assetPath, loaded]() {
+            Data data;
+            if (FileUtils::getInstance()->getContents(assetPath + ".fui", &data) != FileUtils::Status::OK)
+            {
+                AXLOGE("FairyGUI: cannot load package from '{}'", assetPath);
+                return;
+            }
+
+            ssize_t size;
+            char* p = (char*)data.takeBuffer(&size);
+            ByteBuffer buffer(p, 0, (int)size, true);
+
+            UIPackage* pkg = new UIPackage();
+            pkg->_assetPath = assetPath;
+            if (pkg->loadPackage(&buffer))
+                *loaded = pkg;
+            else
+                delete pkg;
+        },
+        [assetPath, loaded, callback, progressCallback]() {
+            UIPackage* pkg = *loaded;
+            if (pkg == nullptr)
+            {
+                if (callback)
+                    callback(nullptr);
+                return;
+            }
+
+            // added by addPackage while this one was being parsed
+            auto it = _packageInstById.find(assetPath);
+            if (it != _packageInstById.end())
+            {
+                delete pkg;
+                pkg = it->second;
+            }
+            else
+            {
+                pkg->resolveSharedState();
+                registerPackage(pkg);
+            }
+
+            pkg->prefetchAtlases(progressCallback, [pkg, callback]() {
+                if (callback)
+                    callback(pkg);
+            });
+        });
+}
+
+void UIPackage::prefetchAtlases(const std::function<void(float)>& progressCallback,
+                                const std::function<void()>& callback)
+{
+    std::vector<PackageItem*> atlases;
+    for (auto& pi : _items)
+    {
+        // atlases with a separated alpha texture are left to loadAtlas
+        if (pi->type == PackageItemType::ATLAS && pi->texture == nullptr)
+        {
+            string ext = FileUtils::getPathExtension(pi->file);
+            size_t pos = pi->file.find_last_of('.');
+            string alphaFilePath = (pos != -1 ? pi->file.substr(0, pos) : pi->file) + "!a" + ext;
+            if (!ToolSet::isFileExist(alphaFilePath))
+                atlases.push_back(pi);
+        }
+    }
+
+    // parsing the descriptor counts as one step
+    const float steps = (float)atlases.size() + 1;
+    if (progressCallback)
+        progressCallback(1 / steps);
+    if (atlases.empty())
+    {
+        callback();
+        return;
+    }
+
+    // the package and its items must survive a removePackage until every texture has arrived
+    retain();
+    auto textureCache = Director::getInstance()->getTextureCache();
+    auto remaining    = std::make_shared<size_t>(atlases.size());
+    for (auto& pi : atlases)
+    {
+        pi->retain();
+        const bool cached = textureCache->getTextureForKey(pi->file) != nullptr;
+        auto onLoaded = [this, pi, cached, remaining, steps, progressCallback, callback](Texture2D* tex) {
+            // a texture requested meanwhile by getItemAsset wins, failed loads are reported by loadAtlas on demand
+            if (tex && pi->texture == nullptr)
+            {
+                pi->texture = tex;
+                tex->retain();
+            }
+            // the item owns its atlas like one from loadAtlas, removePackage must free the GPU memory
+            if (tex && !cached)
+                Director::getInstance()->getTextureCache()->removeTexture(tex);
+            pi->release();
+
+            --*remaining;
+            if (progressCallback)
+                progressCallback(1 - *remaining / steps);
+            if (*remaining == 0)
+            {
+                callback();
+                release();
+            }
+        };
+        textureCache->addImageAsync(pi->file, onLoaded);
+    }
 }
 
 void UIPackage::removePackage(const string& packageIdOrName)
@@ -372,8 +511,6 @@ bool UIPackage::loadPackage(ByteBuffer* buffer)
         if (cnt > 0)
         {
             buffer->readSArray(_branches, cnt);
-            if (_branch.size() > 0)
-                _branchIndex = ToolSet::findInStringArray(_branches, _branch);
         }
 
         branchIncluded = cnt > 0;
@@ -448,8 +585,6 @@ bool UIPackage::loadPackage(ByteBuffer* buffer)
             else
                 pi->objectType = ObjectType::COMPONENT;
             pi->rawData = buffer->readBuffer();
-
-            UIObjectFactory::resolvePackageItemExtension(pi);
             break;
         }
 
@@ -600,6 +735,18 @@ void* UIPackage::getItemAsset(PackageItem* item)
     }
 }
 
+void UIPackage::resolveSharedState()
+{
+    if (!_branches.empty() && !_branch.empty())
+        _branchIndex = ToolSet::findInStringArray(_branches, _branch);
+
+    for (auto& pi : _items)
+    {
+        if (pi->type == PackageItemType::COMPONENT)
+            UIObjectFactory::resolvePackageItemExtension(pi);
+    }
+}
+
 void UIPackage::loadAtlas(PackageItem* item)
 {
     Image* image = new Image();
@@ -20,6 +20,11 @@ public:
     static UIPackage* getById(const std::string& id);
     static UIPackage* getByName(const std::string& name);
     static UIPackage* addPackage(const std::string& descFilePath);
+    // parses the package on a worker thread and loads its atlases with TextureCache::addImageAsync,
+    // progress goes from 0 to 1 and callback receives nullptr on failure, both are invoked on the main thread
+    static void addPackageAsync(const std::string& descFilePath,
+                                const std::function<void(UIPackage*)>& callback,
+                                const std::function<void(float)>& progressCallback = nullptr);
     static void removePackage(const std::string& packageIdOrName);
     static void removeAllPackages();
     static GObject* createObject(const std::string& pkgName, const std::string& resName);
@@ -47,7 +52,11 @@ public:
     static const std::string URL_PREFIX;
 
 private:
+    static void createEmptyTexture();
+    static UIPackage* registerPackage(UIPackage* pkg);
     bool loadPackage(ByteBuffer* buffer);
+    void resolveSharedState();
+    void prefetchAtlases(const std::function<void(float)>& progressCallback, const std::function<void()>& callback);
     void loadAtlas(PackageItem* item);
     AtlasSprite* getSprite(const std::string& spriteId);
     ax::SpriteFrame* createSpriteTexture(AtlasSprite* sprite);
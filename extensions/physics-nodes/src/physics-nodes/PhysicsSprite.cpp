@@ -463,6 +463,7 @@ void PhysicsSprite::afterUpdate(EventCustom* /*event*/)
     _transformDirty   = false;
     _transformUpdated = true;
     setDirtyRecursively(true);
+    _director->markSceneChanged();
 }
 
 NS_AX_EXT_END
@@ -347,6 +347,7 @@ void PhysicsSpriteBox2D::afterUpdate(EventCustom* /*event*/)
     _transformDirty   = false;
     _transformUpdated = true;
     setDirtyRecursively(true);
+    _director->markSceneChanged();
 }
 
 NS_AX_EXT_END
\ No newline at end of file
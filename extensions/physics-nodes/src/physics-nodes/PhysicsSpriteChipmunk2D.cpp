@@ -324,6 +324,7 @@ void PhysicsSpriteChipmunk2D::afterUpdate(EventCustom* /*event*/)
     _transformDirty   = false;
     _transformUpdated = true;
     setDirtyRecursively(true);
+    _director->markSceneChanged();
 }
 
 NS_AX_EXT_END
\ No newline at end of file
@@ -343,6 +343,54 @@ bool luaval_to_std_string_view(lua_State* L, int lo, cxx17::string_view* outValu
     return ok;
 }
 
+// Reads one number field of a value table without calling into Lua: the array slot first (when slot > 0), that's
+// how vec2_to_luaval and the cc.vec2 family store values, then the key by raw lookup. Only tables with a metatable
+// that still miss the field fall back to lua_gettable, so __index based tables keep working.
+static bool luaval_field_to_number(lua_State* L, int lo, int slot, std::string_view key, lua_Number* outValue)
+{
+    if (lo < 0 && lo > LUA_REGISTRYINDEX)
+        lo = lua_gettop(L) + lo + 1;
+
+    if (slot > 0)
+    {
+        lua_rawgeti(L, lo, slot);
+        if (lua_type(L, -1) == LUA_TNUMBER)
+        {
+            *outValue = lua_tonumber(L, -1);
+            lua_pop(L, 1);
+            return true;
+        }
+        lua_pop(L, 1);
+    }
+
+    lua_pushlstring(L, key.data(), key.length()); /* L: paramStack key */
+    lua_rawget(L, lo);                            /* L: paramStack paramStack[lo][key] */
+    if (lua_isnil(L, -1) && lua_getmetatable(L, lo))
+    {
+        lua_pop(L, 2);
+        lua_pushlstring(L, key.data(), key.length());
+        lua_gettable(L, lo);
+    }
+
+    const bool found = !lua_isnil(L, -1);
+    if (found)
+        *outValue = lua_tonumber(L, -1);
+    lua_pop(L, 1);
+    return found;
+}
+
+static inline float luaval_field_to_float(lua_State* L, int lo, int slot, std::string_view key, float def = 0.0f)
+{
+    lua_Number value = 0;
+    return luaval_field_to_number(L, lo, slot, key, &value) ? static_cast<float>(value) : def;
+}
+
+static inline uint8_t luaval_field_to_uint8(lua_State* L, int lo, std::string_view key, uint8_t def = 0)
+{
+    lua_Number value = 0;
+    return luaval_field_to_number(L, lo, 0, key, &value) ? static_cast<uint8_t>(value) : def;
+}
+
 bool luaval_to_vec2(lua_State* L, int lo, ax::Vec2* outValue, const char* funcName)
 {
     if (nullptr == L || nullptr == outValue)
@@ -365,29 +413,16 @@ bool luaval_to_vec2(lua_State* L, int lo, ax::Vec2* outValue, const char* funcNa
 
     if (ok)
     {
-        lua_pushstring(L, "x");
-        lua_gettable(L, lo);
-        if (lua_isnil(L, -1))
-        {
-            lua_pop(L, 1);
-            lua_pushstring(L, "width");
-            lua_gettable(L, lo);
-        }
-
-        outValue->x = lua_isnil(L, -1) ? 0.0f : (float)lua_tonumber(L, -1);
-        lua_pop(L, 1);
-
-        lua_pushstring(L, "y");
-        lua_gettable(L, lo);
-        if (lua_isnil(L, -1))
-        {
-            lua_pop(L, 1);
-            lua_pushstring(L, "height");
-            lua_gettable(L, lo);
-        }
+        lua_Number value = 0;
+        if (luaval_field_to_number(L, lo, 1, "x"sv, &value) || luaval_field_to_number(L, lo, 0, "width"sv, &value))
+            outValue->x = (float)value;
+        else
+            outValue->x = 0.0f;
 
-        outValue->y = lua_isnil(L, -1) ? 0.0f : (float)lua_tonumber(L, -1);
-        lua_pop(L, 1);
+        if (luaval_field_to_number(L, lo, 2, "y"sv, &value) || luaval_field_to_number(L, lo, 0, "height"sv, &value))
+            outValue->y = (float)value;
+        else
+            outValue->y = 0.0f;
     }
     return ok;
 }
@@ -410,20 +445,9 @@ bool luaval_to_vec3(lua_State* L, int lo, ax::Vec3* outValue, const char* funcNa
 
     if (ok)
     {
-        lua_pushstring(L, "x");
-        lua_gettable(L, lo);
-        outValue->x = lua_isnil(L, -1) ? 0.0f : (float)lua_tonumber(L, -1);
-        lua_pop(L, 1);
-
-        lua_pushstring(L, "y");
-        lua_gettable(L, lo);
-        outValue->y = lua_isnil(L, -1) ? 0.0f : (float)lua_tonumber(L, -1);
-        lua_pop(L, 1);
-
-        lua_pushstring(L, "z");
-        lua_gettable(L, lo);
-        outValue->z = lua_isnil(L, -1) ? 0.0f : (float)lua_tonumber(L, -1);
-        lua_pop(L, 1);
+        outValue->x = luaval_field_to_float(L, lo, 1, "x"sv);
+        outValue->y = luaval_field_to_float(L, lo, 2, "y"sv);
+        outValue->z = luaval_field_to_float(L, lo, 3, "z"sv);
     }
     return ok;
 }
@@ -446,25 +470,10 @@ bool luaval_to_vec4(lua_State* L, int lo, ax::Vec4* outValue, const char* funcNa
 
     if (ok)
     {
-        lua_pushstring(L, "x");
-        lua_gettable(L, lo);
-        outValue->x = lua_isnil(L, -1) ? 0.0f : (float)lua_tonumber(L, -1);
-        lua_pop(L, 1);
-
-        lua_pushstring(L, "y");
-        lua_gettable(L, lo);
-        outValue->y = lua_isnil(L, -1) ? 0.0f : (float)lua_tonumber(L, -1);
-        lua_pop(L, 1);
-
-        lua_pushstring(L, "z");
-        lua_gettable(L, lo);
-        outValue->z = lua_isnil(L, -1) ? 0.0f : (float)lua_tonumber(L, -1);
-        lua_pop(L, 1);
-
-        lua_pushstring(L, "w");
-        lua_gettable(L, lo);
-        outValue->w = lua_isnil(L, -1) ? 0.0f : (float)lua_tonumber(L, -1);
-        lua_pop(L, 1);
+        outValue->x = luaval_field_to_float(L, lo, 1, "x"sv);
+        outValue->y = luaval_field_to_float(L, lo, 2, "y"sv);
+        outValue->z = luaval_field_to_float(L, lo, 3, "z"sv);
+        outValue->w = luaval_field_to_float(L, lo, 4, "w"sv);
     }
     return ok;
 }
@@ -610,15 +619,9 @@ bool luaval_to_size(lua_State* L, int lo, Size* outValue, const char* funcName)
 
     if (ok)
     {
-        lua_pushstring(L, "width"); /* L: paramStack key */
-        lua_gettable(L, lo);        /* L: paramStack paramStack[lo][key] */
-        outValue->width = lua_isnil(L, -1) ? 0.0f : (float)lua_tonumber(L, -1);
-        lua_pop(L, 1); /* L: paramStack*/
-
-        lua_pushstring(L, "height");
-        lua_gettable(L, lo);
-        outValue->height = lua_isnil(L, -1) ? 0.0f : (float)lua_tonumber(L, -1);
-        lua_pop(L, 1);
+        // cc.size builds a vec2, width and height are its array slots
+        outValue->width  = luaval_field_to_float(L, lo, 1, "width"sv);
+        outValue->height = luaval_field_to_float(L, lo, 2, "height"sv);
     }
 
     return ok;
@@ -642,25 +645,10 @@ bool luaval_to_rect(lua_State* L, int lo, Rect* outValue, const char* funcName)
 
     if (ok)
     {
-        lua_pushstring(L, "x");
-        lua_gettable(L, lo);
-        outValue->origin.x = lua_isnil(L, -1) ? 0.0f : (float)lua_tonumber(L, -1);
-        lua_pop(L, 1);
-
-        lua_pushstring(L, "y");
-        lua_gettable(L, lo);
-        outValue->origin.y = lua_isnil(L, -1) ? 0.0f : (float)lua_tonumber(L, -1);
-        lua_pop(L, 1);
-
-        lua_pushstring(L, "width");
-        lua_gettable(L, lo);
-        outValue->size.width = lua_isnil(L, -1) ? 0.0f : (float)lua_tonumber(L, -1);
-        lua_pop(L, 1);
-
-        lua_pushstring(L, "height");
-        lua_gettable(L, lo);
-        outValue->size.height = lua_isnil(L, -1) ? 0.0f : (float)lua_tonumber(L, -1);
-        lua_pop(L, 1);
+        outValue->origin.x    = luaval_field_to_float(L, lo, 0, "x"sv);
+        outValue->origin.y    = luaval_field_to_float(L, lo, 0, "y"sv);
+        outValue->size.width  = luaval_field_to_float(L, lo, 0, "width"sv);
+        outValue->size.height = luaval_field_to_float(L, lo, 0, "height"sv);
     }
 
     return ok;
@@ -684,25 +672,10 @@ bool luaval_to_color4b(lua_State* L, int lo, Color4B* outValue, const char* func
 
     if (ok)
     {
-        lua_pushstring(L, "r");
-        lua_gettable(L, lo);
-        outValue->r = lua_isnil(L, -1) ? 0 : static_cast<uint8_t>(lua_tonumber(L, -1));
-        lua_pop(L, 1);
-
-        lua_pushstring(L, "g");
-        lua_gettable(L, lo);
-        outValue->g = lua_isnil(L, -1) ? 0 : static_cast<uint8_t>(lua_tonumber(L, -1));
-        lua_pop(L, 1);
-
-        lua_pushstring(L, "b");
-        lua_gettable(L, lo);
-        outValue->b = lua_isnil(L, -1) ? 0 : static_cast<uint8_t>(lua_tonumber(L, -1));
-        lua_pop(L, 1);
-
-        lua_pushstring(L, "a");
-        lua_gettable(L, lo);
-        outValue->a = lua_isnil(L, -1) ? 255 : static_cast<uint8_t>(lua_tonumber(L, -1));
-        lua_pop(L, 1);
+        outValue->r = luaval_field_to_uint8(L, lo, "r"sv);
+        outValue->g = luaval_field_to_uint8(L, lo, "g"sv);
+        outValue->b = luaval_field_to_uint8(L, lo, "b"sv);
+        outValue->a = luaval_field_to_uint8(L, lo, "a"sv, 255);
     }
 
     return ok;
@@ -726,25 +699,10 @@ bool luaval_to_color4f(lua_State* L, int lo, Color4F* outValue, const char* func
 
     if (ok)
     {
-        lua_pushstring(L, "r");
-        lua_gettable(L, lo);
-        outValue->r = lua_isnil(L, -1) ? 0.0f : (float)lua_tonumber(L, -1);
-        lua_pop(L, 1);
-
-        lua_pushstring(L, "g");
-        lua_gettable(L, lo);
-        outValue->g = lua_isnil(L, -1) ? 0.0f : (float)lua_tonumber(L, -1);
-        lua_pop(L, 1);
-
-        lua_pushstring(L, "b");
-        lua_gettable(L, lo);
-        outValue->b = lua_isnil(L, -1) ? 0.0f : (float)lua_tonumber(L, -1);
-        lua_pop(L, 1);
-
-        lua_pushstring(L, "a");
-        lua_gettable(L, lo);
-        outValue->a = lua_isnil(L, -1) ? 0.0f : (float)lua_tonumber(L, -1);
-        lua_pop(L, 1);
+        outValue->r = luaval_field_to_float(L, lo, 0, "r"sv);
+        outValue->g = luaval_field_to_float(L, lo, 0, "g"sv);
+        outValue->b = luaval_field_to_float(L, lo, 0, "b"sv);
+        outValue->a = luaval_field_to_float(L, lo, 0, "a"sv);
     }
 
     return ok;
@@ -768,20 +726,9 @@ bool luaval_to_color3b(lua_State* L, int lo, Color3B* outValue, const char* func
 
     if (ok)
     {
-        lua_pushstring(L, "r");
-        lua_gettable(L, lo);
-        outValue->r = lua_isnil(L, -1) ? 0 : static_cast<uint8_t>(lua_tonumber(L, -1));
-        lua_pop(L, 1);
-
-        lua_pushstring(L, "g");
-        lua_gettable(L, lo);
-        outValue->g = lua_isnil(L, -1) ? 0 : static_cast<uint8_t>(lua_tonumber(L, -1));
-        lua_pop(L, 1);
-
-        lua_pushstring(L, "b");
-        lua_gettable(L, lo);
-        outValue->b = lua_isnil(L, -1) ? 0 : static_cast<uint8_t>(lua_tonumber(L, -1));
-        lua_pop(L, 1);
+        outValue->r = luaval_field_to_uint8(L, lo, "r"sv);
+        outValue->g = luaval_field_to_uint8(L, lo, "g"sv);
+        outValue->b = luaval_field_to_uint8(L, lo, "b"sv);
     }
 
     return ok;
@@ -2339,11 +2286,11 @@ void size_to_luaval(lua_State* L, const Size& sz)
 {
     if (NULL == L)
         return;
-    lua_newtable(L);                          /* L: table */
-    lua_pushstring(L, "width");               /* L: table key */
+    lua_createtable(L, 0, 2);                 /* L: table, hash part sized once */
+    lua_pushlstring(L, "width", 5);           /* L: table key */
     lua_pushnumber(L, (lua_Number)sz.width);  /* L: table key value*/
     lua_rawset(L, -3);                        /* table[key] = value, L: table */
-    lua_pushstring(L, "height");              /* L: table key */
+    lua_pushlstring(L, "height", 6);          /* L: table key */
     lua_pushnumber(L, (lua_Number)sz.height); /* L: table key value*/
     lua_rawset(L, -3);                        /* table[key] = value, L: table */
 }
@@ -2352,17 +2299,17 @@ void rect_to_luaval(lua_State* L, const Rect& rt)
 {
     if (NULL == L)
         return;
-    lua_newtable(L);                               /* L: table */
-    lua_pushstring(L, "x");                        /* L: table key */
+    lua_createtable(L, 0, 4);                      /* L: table, hash part sized once */
+    lua_pushlstring(L, "x", 1);                    /* L: table key */
     lua_pushnumber(L, (lua_Number)rt.origin.x);    /* L: table key value*/
     lua_rawset(L, -3);                             /* table[key] = value, L: table */
-    lua_pushstring(L, "y");                        /* L: table key */
+    lua_pushlstring(L, "y", 1);                    /* L: table key */
     lua_pushnumber(L, (lua_Number)rt.origin.y);    /* L: table key value*/
     lua_rawset(L, -3);                             /* table[key] = value, L: table */
-    lua_pushstring(L, "width");                    /* L: table key */
+    lua_pushlstring(L, "width", 5);                /* L: table key */
     lua_pushnumber(L, (lua_Number)rt.size.width);  /* L: table key value*/
     lua_rawset(L, -3);                             /* table[key] = value, L: table */
-    lua_pushstring(L, "height");                   /* L: table key */
+    lua_pushlstring(L, "height", 6);               /* L: table key */
     lua_pushnumber(L, (lua_Number)rt.size.height); /* L: table key value*/
     lua_rawset(L, -3);                             /* table[key] = value, L: table */
 }
@@ -2371,17 +2318,17 @@ void color4b_to_luaval(lua_State* L, const Color4B& color)
 {
     if (NULL == L)
         return;
-    lua_newtable(L);                     /* L: table */
-    lua_pushstring(L, "r");              /* L: table key */
+    lua_createtable(L, 0, 4);           /* L: table, hash part sized once */
+    lua_pushlstring(L, "r", 1);         /* L: table key */
     lua_pushnumber(L, (lua_Number)color.r); /* L: table key value*/
     lua_rawset(L, -3);                   /* table[key] = value, L: table */
-    lua_pushstring(L, "g");              /* L: table key */
+    lua_pushlstring(L, "g", 1);         /* L: table key */
     lua_pushnumber(L, (lua_Number)color.g); /* L: table key value*/
     lua_rawset(L, -3);                   /* table[key] = value, L: table */
-    lua_pushstring(L, "b");              /* L: table key */
+    lua_pushlstring(L, "b", 1);         /* L: table key */
     lua_pushnumber(L, (lua_Number)color.b); /* L: table key value*/
     lua_rawset(L, -3);                   /* table[key] = value, L: table */
-    lua_pushstring(L, "a");              /* L: table key */
+    lua_pushlstring(L, "a", 1);         /* L: table key */
     lua_pushnumber(L, (lua_Number)color.a); /* L: table key value*/
     lua_rawset(L, -3);                   /* table[key] = value, L: table */
 }
@@ -2390,17 +2337,17 @@ void color4f_to_luaval(lua_State* L, const Color4F& color)
 {
     if (NULL == L)
         return;
-    lua_newtable(L);                     /* L: table */
-    lua_pushstring(L, "r");              /* L: table key */
+    lua_createtable(L, 0, 4);           /* L: table, hash part sized once */
+    lua_pushlstring(L, "r", 1);         /* L: table key */
     lua_pushnumber(L, (lua_Number)color.r); /* L: table key value*/
     lua_rawset(L, -3);                   /* table[key] = value, L: table */
-    lua_pushstring(L, "g");              /* L: table key */
+    lua_pushlstring(L, "g", 1);         /* L: table key */
     lua_pushnumber(L, (lua_Number)color.g); /* L: table key value*/
     lua_rawset(L, -3);                   /* table[key] = value, L: table */
-    lua_pushstring(L, "b");              /* L: table key */
+    lua_pushlstring(L, "b", 1);         /* L: table key */
     lua_pushnumber(L, (lua_Number)color.b); /* L: table key value*/
     lua_rawset(L, -3);                   /* table[key] = value, L: table */
-    lua_pushstring(L, "a");              /* L: table key */
+    lua_pushlstring(L, "a", 1);         /* L: table key */
     lua_pushnumber(L, (lua_Number)color.a); /* L: table key value*/
     lua_rawset(L, -3);                   /* table[key] = value, L: table */
 }
@@ -2414,14 +2361,14 @@ void color3b_to_luaval(lua_State* L, const Color3B& color)
 {
     if (NULL == L)
         return;
-    lua_newtable(L);                     /* L: table */
-    lua_pushstring(L, "r");              /* L: table key */
+    lua_createtable(L, 0, 3);           /* L: table, hash part sized once */
+    lua_pushlstring(L, "r", 1);         /* L: table key */
     lua_pushnumber(L, (lua_Number)color.r); /* L: table key value*/
     lua_rawset(L, -3);                   /* table[key] = value, L: table */
-    lua_pushstring(L, "g");              /* L: table key */
+    lua_pushlstring(L, "g", 1);         /* L: table key */
     lua_pushnumber(L, (lua_Number)color.g); /* L: table key value*/
     lua_rawset(L, -3);                   /* table[key] = value, L: table */
-    lua_pushstring(L, "b");              /* L: table key */
+    lua_pushlstring(L, "b", 1);         /* L: table key */
     lua_pushnumber(L, (lua_Number)color.b); /* L: table key value*/
     lua_rawset(L, -3);                   /* table[key] = value, L: table */
 }
@@ -54,6 +54,8 @@ extern "C" {
 #include "lua-bindings/auto/axlua_backend_auto.hpp"
 #include "base/ZipUtils.h"
 #include "platform/FileUtils.h"
+#include "mio/mio.hpp"
+#include <algorithm>
 
 namespace
 {
@@ -312,6 +314,19 @@ int LuaStack::executeScriptFile(const char* filename)
 {
     AXASSERT(filename, "CCLuaStack::executeScriptFile() - invalid filename");
 
+    if (!_chunkPacks.empty())
+    {
+        switch (loadChunkFromPacks(filename))
+        {
+        case PackedChunkResult::Loaded:
+            return executeFunction(0);
+        case PackedChunkResult::Failed:
+            return 0;  // don't run a stale copy from the file system
+        default:
+            break;
+        }
+    }
+
     std::string filePath{filename};
     Data data = FileUtils::getInstance()->getDataFromFile(filePath);
     int rn    = 0;
@@ -743,6 +758,281 @@ int LuaStack::luaLoadChunksFromZIP(lua_State* L)
     return 1;
 }
 
+/*
+ * Lua chunk pack layout, all integers are little endian uint32:
+ *   header  : magic "AXLP", version, entry count
+ *   entries : count x { name offset, name size, chunk offset, chunk size }, sorted by name
+ *   names and chunks, offsets are relative to the start of the pack
+ */
+namespace
+{
+const char LUA_PACK_MAGIC[4]    = {'A', 'X', 'L', 'P'};
+const uint32_t LUA_PACK_VERSION = 1;
+
+struct LuaPackEntry
+{
+    uint32_t nameOffset;
+    uint32_t nameSize;
+    uint32_t chunkOffset;
+    uint32_t chunkSize;
+};
+
+const size_t LUA_PACK_HEADER_SIZE = sizeof(LUA_PACK_MAGIC) + sizeof(uint32_t) * 2;
+
+uint32_t readPackU32(const char* p)
+{
+    uint32_t value;
+    memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+void writePackU32(std::string& out, uint32_t value)
+{
+    out.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+// "src/app/main.lua" -> "src.app.main"
+std::string toModuleName(std::string_view path)
+{
+    auto pos = path.find_last_of('.');
+    if (pos != std::string_view::npos && path.find_first_of("/\\", pos) == std::string_view::npos)
+    {
+        auto ext = path.substr(pos);
+        if (ext == ".lua" || ext == ".luac")
+            path = path.substr(0, pos);
+    }
+    std::string name{path};
+    std::replace(name.begin(), name.end(), '/', '.');
+    std::replace(name.begin(), name.end(), '\\', '.');
+    return name;
+}
+
+int writeDumpedChunk(lua_State*, const void* p, size_t sz, void* ud)
+{
+    static_cast<std::string*>(ud)->append(static_cast<const char*>(p), sz);
+    return 0;
+}
+}  // namespace
+
+struct LuaStack::ChunkPack
+{
+    mio::mmap_source mapping;
+    Data data;  // used when the pack can't be mapped, i.e. inside an archive
+    const char* bytes = nullptr;
+    size_t size       = 0;
+    uint32_t count    = 0;
+
+    bool init(std::string_view fullPath)
+    {
+        auto fileStream = FileUtils::getInstance()->openFileStream(fullPath, IFileStream::Mode::READ);
+        if (fileStream && fileStream->nativeHandle() != (osfhnd_t)-1 && fileStream->size() > 0)
+        {
+            std::error_code error;
+            mapping.map(fileStream->nativeHandle(), 0, mio::map_entire_file, error);
+            if (!error && mapping.is_mapped())
+            {
+                bytes = mapping.data();
+                size  = mapping.size();
+            }
+        }
+        if (!bytes)
+        {
+            data  = FileUtils::getInstance()->getDataFromFile(fullPath);
+            bytes = reinterpret_cast<const char*>(data.getBytes());
+            size  = static_cast<size_t>(data.getSize());
+        }
+
+        if (size < LUA_PACK_HEADER_SIZE || memcmp(bytes, LUA_PACK_MAGIC, sizeof(LUA_PACK_MAGIC)) != 0 ||
+            readPackU32(bytes + 4) != LUA_PACK_VERSION)
+            return false;
+        count = readPackU32(bytes + 8);
+        if ((size - LUA_PACK_HEADER_SIZE) / sizeof(LuaPackEntry) < count)
+            return false;
+
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            auto entry = entryAt(i);
+            if (entry.nameOffset > size || entry.nameSize > size - entry.nameOffset || entry.chunkOffset > size ||
+                entry.chunkSize > size - entry.chunkOffset)
+                return false;
+        }
+        return true;
+    }
+
+    LuaPackEntry entryAt(uint32_t index) const
+    {
+        LuaPackEntry entry;
+        memcpy(&entry, bytes + LUA_PACK_HEADER_SIZE + index * sizeof(LuaPackEntry), sizeof(entry));
+        return entry;
+    }
+
+    std::string_view nameAt(uint32_t index) const
+    {
+        auto entry = entryAt(index);
+        return std::string_view{bytes + entry.nameOffset, entry.nameSize};
+    }
+
+    // binary search over the sorted index, returns count if not found
+    uint32_t find(std::string_view name) const
+    {
+        uint32_t first = 0, last = count;
+        while (first < last)
+        {
+            auto mid = first + (last - first) / 2;
+            if (nameAt(mid) < name)
+                first = mid + 1;
+            else
+                last = mid;
+        }
+        return (first < count && nameAt(first) == name) ? first : count;
+    }
+};
+
+int LuaStack::loadChunksFromPack(const char* packFilePath)
+{
+    auto fullPath = FileUtils::getInstance()->fullPathForFilename(packFilePath);
+    auto pack     = std::make_shared<ChunkPack>();
+    if (fullPath.empty() || !pack->init(fullPath))
+    {
+        AXLOGD("loadChunksFromPack() - not found or invalid pack file: {}", packFilePath);
+        return 0;
+    }
+
+    lua_getglobal(_state, "package");
+    lua_getfield(_state, -1, "preload"); /* L: package preload */
+    for (uint32_t i = 0; i < pack->count; ++i)
+    {
+        auto name = pack->nameAt(i);
+        lua_pushlstring(_state, name.data(), name.size());
+        lua_pushlightuserdata(_state, this);
+        lua_pushlightuserdata(_state, pack.get());
+        lua_pushinteger(_state, static_cast<lua_Integer>(i));
+        lua_pushcclosure(_state, &LuaStack::luaPackLoader, 3); /* L: package preload name loader */
+        lua_rawset(_state, -3);
+    }
+    lua_pop(_state, 2);
+
+    AXLOGD("loadChunksFromPack() - registered chunks count: {}", pack->count);
+    _chunkPacks.emplace_back(std::move(pack));
+    return 1;
+}
+
+bool LuaStack::loadPackedChunk(ChunkPack* pack, uint32_t index)
+{
+    auto entry = pack->entryAt(index);
+    std::string chunkName{pack->nameAt(index)};
+    return luaLoadBuffer(_state, pack->bytes + entry.chunkOffset, static_cast<int>(entry.chunkSize),
+                         chunkName.c_str()) == 0;
+}
+
+LuaStack::PackedChunkResult LuaStack::loadChunkFromPacks(std::string_view moduleName)
+{
+    // only exact names match, "src.app.main" and "app.main" may be different modules
+    auto name = toModuleName(moduleName);
+
+    // later packs override earlier ones, same as package.preload
+    for (auto it = _chunkPacks.rbegin(); it != _chunkPacks.rend(); ++it)
+    {
+        auto index = (*it)->find(name);
+        if (index < (*it)->count)
+        {
+            if (loadPackedChunk(it->get(), index))
+                return PackedChunkResult::Loaded;
+
+            AXLOGW("[LUA ERROR] failed to load packed chunk {}: {}", name, lua_tostring(_state, -1));
+            lua_pop(_state, 1);
+            return PackedChunkResult::Failed;
+        }
+    }
+    return PackedChunkResult::NotFound;
+}
+
+int LuaStack::luaPackLoader(lua_State* L)
+{
+    auto stack = static_cast<LuaStack*>(lua_touserdata(L, lua_upvalueindex(1)));
+    auto pack  = static_cast<ChunkPack*>(lua_touserdata(L, lua_upvalueindex(2)));
+    auto index = static_cast<uint32_t>(lua_tointeger(L, lua_upvalueindex(3)));
+
+    int nargs = lua_gettop(L);
+    if (!stack->loadPackedChunk(pack, index))
+        return lua_error(L);  // error message is on the top
+
+    // run the chunk with the arguments require passed to the loader
+    lua_insert(L, 1);
+    lua_call(L, nargs, LUA_MULTRET);
+    return lua_gettop(L);
+}
+
+bool LuaStack::writeChunkPack(std::string_view sourceDir, std::string_view packFilePath, bool stripDebugInfo)
+{
+    using namespace cxx17;  // for string_view literal
+
+    auto fileUtils = FileUtils::getInstance();
+    auto rootPath  = fileUtils->fullPathForDirectory(sourceDir);
+    std::vector<std::string> files;
+    fileUtils->listFilesRecursively(rootPath, &files);
+
+    std::vector<std::pair<std::string, std::string>> chunks;
+    for (auto& file : files)
+    {
+        std::string_view relativePath{file};
+        if (relativePath.size() <= rootPath.size() || relativePath.back() == '/')
+            continue;
+        relativePath.remove_prefix(rootPath.size());
+        const bool isBytecode = cxx20::ends_with(relativePath, ".luac"_sv);
+        if (!isBytecode && !cxx20::ends_with(relativePath, ".lua"_sv))
+            continue;
+
+        Data data = fileUtils->getDataFromFile(file);
+        std::string chunk;
+        if (isBytecode)
+            chunk.assign(reinterpret_cast<const char*>(data.getBytes()), static_cast<size_t>(data.getSize()));
+        else
+        {
+            std::string chunkName = "@" + file;
+            if (luaLoadBuffer(_state, reinterpret_cast<const char*>(data.getBytes()), static_cast<int>(data.getSize()),
+                              chunkName.c_str()) != 0)
+            {
+                AXLOGW("writeChunkPack() - failed to compile {}: {}", file, lua_tostring(_state, -1));
+                lua_pop(_state, 1);
+                return false;
+            }
+#if LUA_VERSION_NUM >= 503
+            lua_dump(_state, writeDumpedChunk, &chunk, stripDebugInfo ? 1 : 0);
+#else
+            AX_UNUSED_PARAM(stripDebugInfo);
+            lua_dump(_state, writeDumpedChunk, &chunk);
+#endif
+            lua_pop(_state, 1);
+        }
+        chunks.emplace_back(toModuleName(relativePath), std::move(chunk));
+    }
+    std::sort(chunks.begin(), chunks.end(), [](auto& lhs, auto& rhs) { return lhs.first < rhs.first; });
+
+    std::string pack{LUA_PACK_MAGIC, sizeof(LUA_PACK_MAGIC)};
+    writePackU32(pack, LUA_PACK_VERSION);
+    writePackU32(pack, static_cast<uint32_t>(chunks.size()));
+
+    auto offset = LUA_PACK_HEADER_SIZE + chunks.size() * sizeof(LuaPackEntry);
+    for (auto& chunk : chunks)
+    {
+        writePackU32(pack, static_cast<uint32_t>(offset));
+        writePackU32(pack, static_cast<uint32_t>(chunk.first.size()));
+        offset += chunk.first.size();
+        writePackU32(pack, static_cast<uint32_t>(offset));
+        writePackU32(pack, static_cast<uint32_t>(chunk.second.size()));
+        offset += chunk.second.size();
+    }
+    for (auto& chunk : chunks)
+    {
+        pack += chunk.first;
+        pack += chunk.second;
+    }
+
+    AXLOGD("writeChunkPack() - packed {} chunks into {}", chunks.size(), packFilePath);
+    return fileUtils->writeStringToFile(pack, packFilePath);
+}
+
 namespace
 {
 
@@ -319,14 +319,54 @@ public:
      */
     int luaLoadChunksFromZIP(lua_State* L);
 
+    /**
+     * Register the chunks of a pack file written by writeChunkPack as package.preload loaders.
+     * The pack is mapped and only its index is read here, each chunk is loaded on its first require.
+     * executeScriptFile also looks up the exact module name of the file in the loaded packs before reading
+     * from the file system, a packed chunk that fails to load is reported and not replaced by the file.
+     *
+     * @param packFilePath file path to the pack file.
+     * @return 1 if load successfully otherwise 0.
+     */
+    int loadChunksFromPack(const char* packFilePath);
+
+    /**
+     * Precompile all .lua files under a directory with the current lua_State and write them into a pack file,
+     * .luac files are stored as they are. Module names are the relative paths without extension, separated by '.'.
+     * The bytecode is only valid for the same Lua VM and architecture, so build the pack with the shipping runtime.
+     *
+     * @param sourceDir directory of the Lua sources.
+     * @param packFilePath full path of the pack file to write.
+     * @param stripDebugInfo strip debug information from the bytecode, ignored by LuaJIT.
+     * @return true if the pack is written.
+     */
+    bool writeChunkPack(std::string_view sourceDir, std::string_view packFilePath, bool stripDebugInfo = true);
+
 protected:
+    struct ChunkPack;
+
     LuaStack() : _state(nullptr), _callFromLua(0) {}
 
     bool init();
     bool initWithLuaState(lua_State* L);
 
+    enum class PackedChunkResult
+    {
+        NotFound,
+        Loaded,
+        Failed
+    };
+
+    // push the packed chunk of a module onto the stack if the result is Loaded,
+    // a chunk that fails to load is logged and nothing is left on the stack
+    PackedChunkResult loadChunkFromPacks(std::string_view moduleName);
+    bool loadPackedChunk(ChunkPack* pack, uint32_t index);
+
+    static int luaPackLoader(lua_State* L);
+
     lua_State* _state;
     int _callFromLua;
+    std::vector<std::shared_ptr<ChunkPack>> _chunkPacks;
 };
 
 }
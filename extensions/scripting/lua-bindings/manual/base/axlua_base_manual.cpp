@@ -2258,6 +2258,85 @@ tolua_lerror:
 #endif
 }
 
+// ax.Node.setPositions(nodes, coords): coords holds x1, y1, x2, y2, ... for the nodes in order, one call moves them
+// all without building a table per position
+static int axlua_Node_setPositions(lua_State* tolua_S)
+{
+#if _AX_DEBUG >= 1
+    tolua_Error tolua_err;
+    if (!tolua_istable(tolua_S, 1, 0, &tolua_err) || !tolua_istable(tolua_S, 2, 0, &tolua_err))
+    {
+        tolua_error(tolua_S, "#ferror in function 'axlua_Node_setPositions'.", &tolua_err);
+        return 0;
+    }
+#endif
+
+    const int count = static_cast<int>(lua_objlen(tolua_S, 1));
+    for (int i = 1; i <= count; ++i)
+    {
+        lua_rawgeti(tolua_S, 1, i);          /* L: nodes coords node */
+        lua_rawgeti(tolua_S, 2, 2 * i - 1);  /* L: nodes coords node x */
+        lua_rawgeti(tolua_S, 2, 2 * i);      /* L: nodes coords node x y */
+        ax::Node* node = nullptr;
+        if (!luaval_to_object<ax::Node>(tolua_S, lua_gettop(tolua_S) - 2, "ax.Node", &node, "axlua_Node_setPositions"))
+        {
+            tolua_error(tolua_S, "invalid arguments in function 'axlua_Node_setPositions', nodes must hold ax.Node",
+                        nullptr);
+            return 0;
+        }
+        if (node)
+            node->setPosition(static_cast<float>(lua_tonumber(tolua_S, -2)),
+                              static_cast<float>(lua_tonumber(tolua_S, -1)));
+        lua_pop(tolua_S, 3);
+    }
+    return 0;
+}
+
+// ax.Node.getPositions(nodes [, coords]): fills coords with x1, y1, x2, y2, ... and returns it, passing the same
+// table every frame reuses it
+static int axlua_Node_getPositions(lua_State* tolua_S)
+{
+#if _AX_DEBUG >= 1
+    tolua_Error tolua_err;
+    if (!tolua_istable(tolua_S, 1, 0, &tolua_err) || !tolua_istable(tolua_S, 2, 1, &tolua_err))
+    {
+        tolua_error(tolua_S, "#ferror in function 'axlua_Node_getPositions'.", &tolua_err);
+        return 0;
+    }
+#endif
+
+    const int count = static_cast<int>(lua_objlen(tolua_S, 1));
+    if (!lua_istable(tolua_S, 2))
+    {
+        lua_settop(tolua_S, 1);
+        lua_createtable(tolua_S, count * 2, 0);
+    }
+    else
+        lua_settop(tolua_S, 2);
+
+    for (int i = 1; i <= count; ++i)
+    {
+        lua_rawgeti(tolua_S, 1, i);
+        ax::Node* node = nullptr;
+        if (!luaval_to_object<ax::Node>(tolua_S, lua_gettop(tolua_S), "ax.Node", &node, "axlua_Node_getPositions"))
+        {
+            tolua_error(tolua_S, "invalid arguments in function 'axlua_Node_getPositions', nodes must hold ax.Node",
+                        nullptr);
+            return 0;
+        }
+        lua_pop(tolua_S, 1);
+
+        float x = 0, y = 0;
+        if (node)
+            node->getPosition(&x, &y);
+        lua_pushnumber(tolua_S, (lua_Number)x);
+        lua_rawseti(tolua_S, 2, 2 * i - 1);
+        lua_pushnumber(tolua_S, (lua_Number)y);
+        lua_rawseti(tolua_S, 2, 2 * i);
+    }
+    return 1;
+}
+
 static int axlua_Node_enumerateChildren(lua_State* tolua_S)
 {
     int argc            = 0;
@@ -4044,6 +4123,12 @@ static void extendNode(lua_State* tolua_S)
         lua_pushstring(tolua_S, "getPosition");
         lua_pushcfunction(tolua_S, tolua_cocos2d_Node_getPosition);
         lua_rawset(tolua_S, -3);
+        lua_pushstring(tolua_S, "setPositions");
+        lua_pushcfunction(tolua_S, axlua_Node_setPositions);
+        lua_rawset(tolua_S, -3);
+        lua_pushstring(tolua_S, "getPositions");
+        lua_pushcfunction(tolua_S, axlua_Node_getPositions);
+        lua_rawset(tolua_S, -3);
         lua_pushstring(tolua_S, "setContentSize");
         lua_pushcfunction(tolua_S, tolua_cocos2d_Node_setContentSize);
         lua_rawset(tolua_S, -3);
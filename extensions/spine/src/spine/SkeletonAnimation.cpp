@@ -28,6 +28,8 @@
  *****************************************************************************/
 
 #include <algorithm>
+#include <list>
+#include <unordered_map>
 #include <spine/Extension.h>
 #include <spine/SkeletonAnimation.h>
 #include <spine/spine-axmol.h>
@@ -70,6 +72,136 @@ namespace spine {
 		return (_TrackEntryListeners *) entry->getRendererObject();
 	}
 
+	namespace {
+		struct BakedFrameKey {
+			const SkeletonData *data;
+			const Skin *skin;
+			const Animation *animation;
+			int frame;
+			int startSlotIndex;
+			int endSlotIndex;
+			float x, y, scaleX, scaleY;
+			size_t attachmentsHash;
+
+			bool operator==(const BakedFrameKey &other) const {
+				return data == other.data && skin == other.skin && animation == other.animation && frame == other.frame &&
+					   startSlotIndex == other.startSlotIndex && endSlotIndex == other.endSlotIndex && x == other.x &&
+					   y == other.y && scaleX == other.scaleX && scaleY == other.scaleY && attachmentsHash == other.attachmentsHash;
+			}
+		};
+
+		struct BakedFrameKeyHash {
+			size_t operator()(const BakedFrameKey &key) const {
+				size_t seed = std::hash<const void *>()(key.animation);
+				auto combine = [&seed](size_t value) { seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2); };
+				combine(std::hash<const void *>()(key.data));
+				combine(std::hash<const void *>()(key.skin));
+				combine(std::hash<int>()(key.frame));
+				combine(std::hash<int>()(key.startSlotIndex));
+				combine(std::hash<int>()(key.endSlotIndex));
+				combine(std::hash<float>()(key.x));
+				combine(std::hash<float>()(key.y));
+				combine(std::hash<float>()(key.scaleX));
+				combine(std::hash<float>()(key.scaleY));
+				combine(key.attachmentsHash);
+				return seed;
+			}
+		};
+
+		/* What each slot in draw order shows: the attachment (null when hidden) and its sequence index. */
+		typedef std::vector<std::pair<const Attachment *, int>> SlotAttachments;
+
+		struct BakedFrame {
+			BakedFrameKey key;
+			SlotAttachments attachments;
+			std::vector<float> coords;
+
+			size_t getByteSize() const {
+				return sizeof(BakedFrame) + attachments.capacity() * sizeof(SlotAttachments::value_type) + coords.capacity() * sizeof(float);
+			}
+		};
+
+		// Below this many skeletons per worker, handing work to the job system costs more than it saves.
+		const size_t kMinParallelBatch = 4;
+
+		// Baked frames, the most recently used first. Frames sharing a key are told apart by their slot attachments.
+		std::list<BakedFrame> s_bakedFrameList;
+		std::unordered_multimap<BakedFrameKey, std::list<BakedFrame>::iterator, BakedFrameKeyHash> s_bakedFrames;
+		size_t s_bakedFrameBytes = 0;
+		size_t s_bakedFrameByteLimit = 16 * 1024 * 1024;
+		SlotAttachments s_slotAttachments;
+		axmol::Vector<SkeletonAnimation *> s_pendingUpdates;
+
+		void eraseBakedFrame(std::list<BakedFrame>::iterator frame) {
+			auto range = s_bakedFrames.equal_range(frame->key);
+			for (auto it = range.first; it != range.second; ++it) {
+				if (it->second == frame) {
+					s_bakedFrames.erase(it);
+					break;
+				}
+			}
+			s_bakedFrameBytes -= frame->getByteSize();
+			s_bakedFrameList.erase(frame);
+		}
+
+		void trimBakedFrames() {
+			while (s_bakedFrameBytes > s_bakedFrameByteLimit && !s_bakedFrameList.empty())
+				eraseBakedFrame(std::prev(s_bakedFrameList.end()));
+		}
+
+		std::list<BakedFrame>::iterator findBakedFrame(const BakedFrameKey &key, const SlotAttachments &attachments) {
+			auto range = s_bakedFrames.equal_range(key);
+			for (auto it = range.first; it != range.second; ++it) {
+				if (it->second->attachments == attachments) return it->second;
+			}
+			return s_bakedFrameList.end();
+		}
+
+		/* Slots can show other attachments than the animation keys, e.g. after setAttachment(), and hidden slots aren't
+		 * part of the baked vertices, so the frame also depends on what each slot shows. */
+		size_t collectSlotAttachments(Skeleton &skeleton, SlotAttachments &attachments) {
+			size_t seed = 0;
+			attachments.clear();
+			Vector<Slot *> &drawOrder = skeleton.getDrawOrder();
+			for (size_t i = 0; i < drawOrder.size(); ++i) {
+				Slot *slot = drawOrder[i];
+				const Attachment *attachment = slot->getColor().a > 0 ? slot->getAttachment() : nullptr;
+				attachments.emplace_back(attachment, slot->getSequenceIndex());
+				seed ^= std::hash<const void *>()(attachment) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+				seed ^= std::hash<int>()(slot->getSequenceIndex()) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+			}
+			return seed;
+		}
+
+		/* A pose is only a function of the frame time when a single looping track plays at full alpha without mixing. */
+		bool makeBakedFrameKey(Skeleton &skeleton, AnimationState &state, float fps, int startSlotIndex, int endSlotIndex, BakedFrameKey &key, SlotAttachments &attachments) {
+			TrackEntry *current = nullptr;
+			Vector<TrackEntry *> &tracks = state.getTracks();
+			for (size_t i = 0; i < tracks.size(); ++i) {
+				if (!tracks[i]) continue;
+				if (current) return false;
+				current = tracks[i];
+			}
+			if (!current || !current->getLoop() || current->getMixingFrom() || current->getAlpha() < 1) return false;
+
+			Animation *animation = current->getAnimation();
+			if (animation->getDuration() <= 0) return false;
+
+			key.data = skeleton.getData();
+			key.skin = skeleton.getSkin();
+			key.animation = animation;
+			key.frame = static_cast<int>(current->getAnimationTime() * fps);
+			key.startSlotIndex = startSlotIndex;
+			key.endSlotIndex = endSlotIndex;
+			key.x = skeleton.getX();
+			key.y = skeleton.getY();
+			key.scaleX = skeleton.getScaleX();
+			key.scaleY = skeleton.getScaleY();
+			key.attachmentsHash = collectSlotAttachments(skeleton, attachments);
+			return true;
+		}
+	}// namespace
+
 	//
 
 	SkeletonAnimation *SkeletonAnimation::createWithData(SkeletonData *skeletonData, bool ownsSkeletonData) {
@@ -138,8 +270,26 @@ namespace spine {
 		if (_preUpdateListener) _preUpdateListener(this);
 		_state->update(deltaTime);
 		_state->apply(*_skeleton);
+
+		// The post update listener may read or modify bones, so it always gets a freshly solved skeleton.
+		if (!_postUpdateListener) {
+			if (replayBakedFrame()) return;
+			if (_parallelUpdate) {
+				if (!_pendingWorldTransform) {
+					_pendingWorldTransform = true;
+					s_pendingUpdates.pushBack(this);
+				}
+				return;
+			}
+		}
+
 		_skeleton->updateWorldTransform();
-		if (_postUpdateListener) _postUpdateListener(this);
+		if (_postUpdateListener) {
+			_postUpdateListener(this);
+		} else if (_bakedFrameFps > 0) {
+			prepareWorldVertices();
+			storeBakedFrame();
+		}
 	}
 
 	void SkeletonAnimation::draw(axmol::Renderer *renderer, const axmol::Mat4 &transform, uint32_t transformFlags) {
@@ -147,9 +297,106 @@ namespace spine {
 			_firstDraw = false;
 			update(0);
 		}
+		if (_pendingWorldTransform) finishParallelUpdates();
 		super::draw(renderer, transform, transformFlags);
 	}
 
+	void SkeletonAnimation::finishParallelUpdates() {
+		if (s_pendingUpdates.empty()) return;
+
+		axmol::Vector<SkeletonAnimation *> skeletons(std::move(s_pendingUpdates));
+		s_pendingUpdates.clear();
+
+		// Bones only touch their own skeleton, so they are solved on the workers together with the main thread.
+		Director::getInstance()->getJobSystem()->parallelFor(skeletons.size(), [&skeletons](size_t i) {
+			SkeletonAnimation *node = skeletons.at(i);
+			node->_skeleton->updateWorldTransform();
+			if (!node->hasSequenceAttachments()) node->prepareWorldVertices();
+		}, kMinParallelBatch);
+
+		for (SkeletonAnimation *node : skeletons) {
+			node->_pendingWorldTransform = false;
+			// Sequence attachments are shared with other skeletons, their vertices are computed here instead.
+			if (!node->_hasPreparedCoords) node->prepareWorldVertices();
+			if (node->_bakedFrameFps > 0) node->storeBakedFrame();
+		}
+	}
+
+	void SkeletonAnimation::onExit() {
+		// Don't keep a skeleton that left the scene waiting for the next skeleton to draw.
+		if (_pendingWorldTransform) {
+			_pendingWorldTransform = false;
+			_skeleton->updateWorldTransform();
+			s_pendingUpdates.eraseObject(this);
+		}
+		super::onExit();
+	}
+
+	void SkeletonAnimation::setParallelUpdateEnabled(bool enabled) {
+		_parallelUpdate = enabled;
+	}
+
+	bool SkeletonAnimation::isParallelUpdateEnabled() const {
+		return _parallelUpdate;
+	}
+
+	bool SkeletonAnimation::replayBakedFrame() {
+		if (_bakedFrameFps <= 0) return false;
+		BakedFrameKey key;
+		if (!makeBakedFrameKey(*_skeleton, *_state, _bakedFrameFps, _startSlotIndex, _endSlotIndex, key, s_slotAttachments)) return false;
+		auto frame = findBakedFrame(key, s_slotAttachments);
+		if (frame == s_bakedFrameList.end()) return false;
+		s_bakedFrameList.splice(s_bakedFrameList.begin(), s_bakedFrameList, frame);
+		_preparedCoords = frame->coords;
+		_hasPreparedCoords = true;
+		return true;
+	}
+
+	void SkeletonAnimation::storeBakedFrame() {
+		BakedFrameKey key;
+		if (!_hasPreparedCoords || !makeBakedFrameKey(*_skeleton, *_state, _bakedFrameFps, _startSlotIndex, _endSlotIndex, key, s_slotAttachments)) return;
+		if (findBakedFrame(key, s_slotAttachments) != s_bakedFrameList.end()) return;
+
+		s_bakedFrameList.push_front(BakedFrame{key, s_slotAttachments, _preparedCoords});
+		s_bakedFrames.emplace(key, s_bakedFrameList.begin());
+		s_bakedFrameBytes += s_bakedFrameList.front().getByteSize();
+		trimBakedFrames();
+	}
+
+	void SkeletonAnimation::setBakedFrameCacheEnabled(bool enabled, float fps) {
+		_bakedFrameFps = enabled ? std::max(fps, 1.0f) : 0;
+	}
+
+	bool SkeletonAnimation::isBakedFrameCacheEnabled() const {
+		return _bakedFrameFps > 0;
+	}
+
+	void SkeletonAnimation::setBakedFrameCacheLimit(size_t bytes) {
+		s_bakedFrameByteLimit = bytes;
+		trimBakedFrames();
+	}
+
+	size_t SkeletonAnimation::getBakedFrameCacheLimit() {
+		return s_bakedFrameByteLimit;
+	}
+
+	size_t SkeletonAnimation::getBakedFrameCacheSize() {
+		return s_bakedFrameBytes;
+	}
+
+	void SkeletonAnimation::purgeBakedFrameCache() {
+		s_bakedFrames.clear();
+		s_bakedFrameList.clear();
+		s_bakedFrameBytes = 0;
+	}
+
+	void SkeletonAnimation::purgeBakedFrameCache(const SkeletonData *skeletonData) {
+		for (auto it = s_bakedFrameList.begin(); it != s_bakedFrameList.end();) {
+			auto frame = it++;
+			if (frame->key.data == skeletonData) eraseBakedFrame(frame);
+		}
+	}
+
 	void SkeletonAnimation::setAnimationStateData(AnimationStateData *stateData) {
 		AXASSERT(stateData, "stateData cannot be null.");
 
@@ -102,9 +102,32 @@ namespace spine {
 		AnimationState *getState() const;
 		void setUpdateOnlyIfVisible(bool status);
 
+		/* Defers bone world transforms and world vertices of this skeleton to JobSystem workers. All pending skeletons are
+		 * solved together right before the first of them is drawn, so bone world transforms read in between are stale
+		 * unless finishParallelUpdates() is called first. Ignored while a post update world transforms listener is set. */
+		void setParallelUpdateEnabled(bool enabled);
+		bool isParallelUpdateEnabled() const;
+		/* Solves all skeletons whose update was deferred to workers, blocking until they are done. */
+		static void finishParallelUpdates();
+
+		/* Replays world vertices baked per frame, sampled at fps, while a single looping animation plays without mixing.
+		 * Replayed frames skip bone solving, so bone world transforms are not updated for them. Frames are shared by all
+		 * skeletons with the same skeleton data, skin, animation, skeleton transform and slot attachments. */
+		void setBakedFrameCacheEnabled(bool enabled, float fps = 30);
+		bool isBakedFrameCacheEnabled() const;
+		/* Bounds the memory used by baked frames, 16 MB by default. The least recently replayed frames are dropped first. */
+		static void setBakedFrameCacheLimit(size_t bytes);
+		static size_t getBakedFrameCacheLimit();
+		static size_t getBakedFrameCacheSize();
+		static void purgeBakedFrameCache();
+		/* Drops the frames baked from skeletonData. Renderers owning their skeleton data do it when they are destroyed,
+		 * otherwise it must be called before deleting skeleton data that was baked. */
+		static void purgeBakedFrameCache(const SkeletonData *skeletonData);
+
 		SkeletonAnimation();
 		virtual ~SkeletonAnimation();
 		virtual void initialize() override;
+		void onExit() override;
 
 	protected:
 		AnimationState *_state;
@@ -122,7 +145,14 @@ namespace spine {
 		UpdateWorldTransformsListener _preUpdateListener;
 		UpdateWorldTransformsListener _postUpdateListener;
 
+		bool _parallelUpdate = false;
+		bool _pendingWorldTransform = false;
+		float _bakedFrameFps = 0;
+
 	private:
+		bool replayBakedFrame();
+		void storeBakedFrame();
+
 		typedef SkeletonRenderer super;
 	};
 
@@ -29,6 +29,7 @@
 
 #include <algorithm>
 #include <spine/Extension.h>
+#include <spine/Sequence.h>
 #include <spine/spine-axmol.h>
 
 using namespace ax;
@@ -43,6 +44,8 @@ namespace spine {
 		void interleaveCoordinates(float *dst, const float *src, int vertexCount, int dstStride);
 		BlendFunc makeBlendFunc(BlendMode blendMode, bool premultipliedAlpha);
 		void transformWorldVertices(float *dstCoord, int coordCount, Skeleton &skeleton, int startSlotIndex, int endSlotIndex);
+		bool hasSequences(Skeleton &skeleton, int startSlotIndex, int endSlotIndex);
+		void applySequences(Skeleton &skeleton, int startSlotIndex, int endSlotIndex);
 		bool cullRectangle(Renderer *renderer, const Mat4 &transform, const axmol::Rect &rect);
 		Color4B ColorToColor4B(const Color &color);
 		bool slotIsOutRange(Slot &slot, int startSlotIndex, int endSlotIndex);
@@ -131,7 +134,11 @@ namespace spine {
 	}
 
 	SkeletonRenderer::~SkeletonRenderer() {
-		if (_ownsSkeletonData) delete _skeleton->getData();
+		if (_ownsSkeletonData) {
+			// Baked frames are keyed on the data's address, which a later skeleton may get again.
+			SkeletonAnimation::purgeBakedFrameCache(_skeleton->getData());
+			delete _skeleton->getData();
+		}
 		if (_ownsSkeleton) delete _skeleton;
 		if (_ownsAtlas && _atlas) delete _atlas;
 		if (_attachmentLoader) delete _attachmentLoader;
@@ -219,6 +226,20 @@ namespace spine {
 
 	void SkeletonRenderer::update(float deltaTime) {
 		Node::update(deltaTime);
+		_hasPreparedCoords = false;
+	}
+
+	void SkeletonRenderer::prepareWorldVertices() {
+		const int coordCount = computeTotalCoordCount(*_skeleton, _startSlotIndex, _endSlotIndex);
+		_preparedCoords.resize(coordCount);
+		if (coordCount > 0) {
+			transformWorldVertices(_preparedCoords.data(), coordCount, *_skeleton, _startSlotIndex, _endSlotIndex);
+		}
+		_hasPreparedCoords = true;
+	}
+
+	bool SkeletonRenderer::hasSequenceAttachments() const {
+		return hasSequences(*_skeleton, _startSlotIndex, _endSlotIndex);
 	}
 
 	void SkeletonRenderer::draw(Renderer *renderer, const Mat4 &transform, uint32_t transformFlags) {
@@ -233,14 +254,20 @@ namespace spine {
 		}
 		assert(coordCount % 2 == 0);
 
-		VLA(float, worldCoords, coordCount);
-		transformWorldVertices(worldCoords, coordCount, *_skeleton, _startSlotIndex, _endSlotIndex);
+		// Reuse the vertices computed ahead of draw (worker update or baked frame) when the visible slots still match.
+		if (!_hasPreparedCoords || _preparedCoords.size() != static_cast<size_t>(coordCount)) {
+			_preparedCoords.resize(coordCount);
+			transformWorldVertices(_preparedCoords.data(), coordCount, *_skeleton, _startSlotIndex, _endSlotIndex);
+		} else {
+			// Another skeleton may have set the shared sequence attachments to its own frame since then.
+			applySequences(*_skeleton, _startSlotIndex, _endSlotIndex);
+		}
+		const float *worldCoords = _preparedCoords.data();
 
 #if AX_USE_CULLING
 		const axmol::Rect bb = computeBoundingRect(worldCoords, coordCount / 2);
 
 		if (cullRectangle(renderer, transform, bb)) {
-			VLA_FREE(worldCoords);
 			return;
 		}
 #endif
@@ -514,8 +541,6 @@ namespace spine {
 		if (_debugBoundingRect || _debugSlots || _debugBones || _debugMeshes) {
 			drawDebug(renderer, transform, transformFlags);
 		}
-
-		VLA_FREE(worldCoords);
 	}
 
 
@@ -622,6 +647,8 @@ namespace spine {
 	axmol::Rect SkeletonRenderer::getBoundingBox() const {
 		const int coordCount = computeTotalCoordCount(*_skeleton, _startSlotIndex, _endSlotIndex);
 		if (coordCount == 0) return {0, 0, 0, 0};
+		if (_hasPreparedCoords && _preparedCoords.size() == static_cast<size_t>(coordCount))
+			return computeBoundingRect(_preparedCoords.data(), coordCount / 2);
 		VLA(float, worldCoords, coordCount);
 		transformWorldVertices(worldCoords, coordCount, *_skeleton, _startSlotIndex, _endSlotIndex);
 		const axmol::Rect bb = computeBoundingRect(worldCoords, coordCount / 2);
@@ -633,16 +660,20 @@ namespace spine {
 
 	void SkeletonRenderer::updateWorldTransform() {
 		_skeleton->updateWorldTransform();
+		_hasPreparedCoords = false;
 	}
 
 	void SkeletonRenderer::setToSetupPose() {
 		_skeleton->setToSetupPose();
+		_hasPreparedCoords = false;
 	}
 	void SkeletonRenderer::setBonesToSetupPose() {
 		_skeleton->setBonesToSetupPose();
+		_hasPreparedCoords = false;
 	}
 	void SkeletonRenderer::setSlotsToSetupPose() {
 		_skeleton->setSlotsToSetupPose();
+		_hasPreparedCoords = false;
 	}
 
 	Bone *SkeletonRenderer::findBone(const std::string &boneName) const {
@@ -655,9 +686,11 @@ namespace spine {
 
 	void SkeletonRenderer::setSkin(const std::string &skinName) {
 		_skeleton->setSkin(skinName.empty() ? 0 : skinName.c_str());
+		_hasPreparedCoords = false;
 	}
 	void SkeletonRenderer::setSkin(const char *skinName) {
 		_skeleton->setSkin(skinName);
+		_hasPreparedCoords = false;
 	}
 
 	Attachment *SkeletonRenderer::getAttachment(const std::string &slotName, const std::string &attachmentName) const {
@@ -666,11 +699,13 @@ namespace spine {
 	bool SkeletonRenderer::setAttachment(const std::string &slotName, const std::string &attachmentName) {
 		bool result = _skeleton->getAttachment(slotName.c_str(), attachmentName.empty() ? 0 : attachmentName.c_str()) ? true : false;
 		_skeleton->setAttachment(slotName.c_str(), attachmentName.empty() ? 0 : attachmentName.c_str());
+		_hasPreparedCoords = false;
 		return result;
 	}
 	bool SkeletonRenderer::setAttachment(const std::string &slotName, const char *attachmentName) {
 		bool result = _skeleton->getAttachment(slotName.c_str(), attachmentName) ? true : false;
 		_skeleton->setAttachment(slotName.c_str(), attachmentName);
+		_hasPreparedCoords = false;
 		return result;
 	}
 
@@ -686,6 +721,7 @@ namespace spine {
 	void SkeletonRenderer::setSlotsRange(int startSlotIndex, int endSlotIndex) {
 		_startSlotIndex = startSlotIndex == -1 ? 0 : startSlotIndex;
 		_endSlotIndex = endSlotIndex == -1 ? std::numeric_limits<int>::max() : endSlotIndex;
+		_hasPreparedCoords = false;
 	}
 
 	Skeleton *SkeletonRenderer::getSkeleton() const {
@@ -849,6 +885,39 @@ namespace spine {
 			assert(dstPtr == dstEnd);
 		}
 
+		bool hasSequences(Skeleton &skeleton, int startSlotIndex, int endSlotIndex) {
+			for (size_t i = 0; i < skeleton.getSlots().size(); ++i) {
+				Slot &slot = *skeleton.getSlots()[i];
+				if (nothingToDraw(slot, startSlotIndex, endSlotIndex)) {
+					continue;
+				}
+				Attachment *const attachment = slot.getAttachment();
+				if (attachment->getRTTI().isExactly(RegionAttachment::rtti)) {
+					if (static_cast<RegionAttachment *>(attachment)->getSequence()) return true;
+				} else if (attachment->getRTTI().isExactly(MeshAttachment::rtti)) {
+					if (static_cast<MeshAttachment *>(attachment)->getSequence()) return true;
+				}
+			}
+			return false;
+		}
+
+		void applySequences(Skeleton &skeleton, int startSlotIndex, int endSlotIndex) {
+			for (size_t i = 0; i < skeleton.getSlots().size(); ++i) {
+				Slot &slot = *skeleton.getSlots()[i];
+				if (nothingToDraw(slot, startSlotIndex, endSlotIndex)) {
+					continue;
+				}
+				Attachment *const attachment = slot.getAttachment();
+				Sequence *sequence = nullptr;
+				if (attachment->getRTTI().isExactly(RegionAttachment::rtti)) {
+					sequence = static_cast<RegionAttachment *>(attachment)->getSequence();
+				} else if (attachment->getRTTI().isExactly(MeshAttachment::rtti)) {
+					sequence = static_cast<MeshAttachment *>(attachment)->getSequence();
+				}
+				if (sequence) sequence->apply(&slot, attachment);
+			}
+		}
+
 		void interleaveCoordinates(float *dst, const float *src, int count, int dstStride) {
 			if (dstStride == 2) {
 				memcpy(dst, src, sizeof(float) * count * 2);
@@ -103,6 +103,14 @@ namespace spine {
 		/* Sets the range of slots that should be rendered. Use -1, -1 to clear the range */
 		void setSlotsRange(int startSlotIndex, int endSlotIndex);
 
+		/* Computes the world vertices consumed by the next draw from the current bone world transforms. The result stays
+		 * valid until the next update or pose change. It may run on a worker thread while nothing else accesses the skeleton,
+		 * unless hasSequenceAttachments() is true: sequence attachments are shared by all skeletons of the same data and
+		 * computing their vertices sets the shared region to this skeleton's frame. */
+		void prepareWorldVertices();
+		/* Whether a visible slot shows a region or mesh attachment with a sequence. */
+		bool hasSequenceAttachments() const;
+
 		// --- BlendProtocol
 		void setBlendFunc(const axmol::BlendFunc &blendFunc) override;
 		const axmol::BlendFunc &getBlendFunc() const override;
@@ -151,6 +159,9 @@ namespace spine {
 		int _startSlotIndex;
 		int _endSlotIndex;
 		bool _twoColorTint;
+
+		std::vector<float> _preparedCoords;
+		bool _hasPreparedCoords = false;
 	};
 
 }// namespace spine
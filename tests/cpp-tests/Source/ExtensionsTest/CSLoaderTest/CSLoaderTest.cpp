@@ -0,0 +1,121 @@
+/****************************************************************************
+ Copyright (c) 2019-present Axmol Engine contributors (see AUTHORS.md).
+
+ https://axmol.dev/
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ ****************************************************************************/
+
+#include "CSLoaderTest.h"
+#include "cocostudio/ActionTimeline/CSLoader.h"
+#include "cocostudio/FlatBuffersSerialize.h"
+#include <chrono>
+
+using namespace ax;
+
+CSLoaderTests::CSLoaderTests()
+{
+    ADD_TEST_CASE(CSLoaderPrototypePerf);
+}
+
+//------------------------------------------------------------------
+//
+// CSLoaderPrototypePerf
+//
+//------------------------------------------------------------------
+void CSLoaderPrototypePerf::onEnter()
+{
+    TestCase::onEnter();
+
+    auto s = Director::getInstance()->getWinSize();
+
+    constexpr int rows = 10, instances = 500;
+
+    // a list cell like layout: 10 rows of a panel with an icon node and two texts, 41 nodes in total
+    std::string rowsXml;
+    for (int i = 0; i < rows; ++i)
+    {
+        rowsXml += fmt::format(R"(
+<AbstractNodeData Name="row{0}" ctype="PanelObjectData">
+  <Size X="300" Y="30" /><Position X="0" Y="{1}" />
+  <Children>
+    <AbstractNodeData Name="icon" ctype="SingleNodeObjectData">
+      <Size X="24" Y="24" /><Position X="4" Y="3" />
+    </AbstractNodeData>
+    <AbstractNodeData Name="name" ctype="TextObjectData" LabelText="Item {0}" FontSize="16">
+      <Size X="120" Y="20" /><Position X="40" Y="5" />
+    </AbstractNodeData>
+    <AbstractNodeData Name="count" ctype="TextObjectData" LabelText="x{0}" FontSize="16">
+      <Size X="60" Y="20" /><Position X="220" Y="5" />
+    </AbstractNodeData>
+  </Children>
+</AbstractNodeData>)",
+                               i, i * 30);
+    }
+    std::string xml = fmt::format(R"(<GameFile>
+<PropertyGroup Name="PerfCell" Type="Node" Version="3.10.0.0" />
+<Content ctype="GameProjectContent">
+<Content>
+<ObjectData Name="PerfCell" ctype="GameNodeObjectData">
+  <Size X="300" Y="300" />
+  <Children>{}</Children>
+</ObjectData>
+</Content>
+</Content>
+</GameFile>)",
+                                  rowsXml);
+
+    auto csbPath = FileUtils::getInstance()->getWritablePath() + "CSLoaderPrototypePerf.csb";
+    cocostudio::FlatBuffersSerialize::getInstance()->serializeFlatBuffersWithXMLBuffer(xml, csbPath);
+
+    // returns how many instances are created per second
+    auto measure = [&](const std::function<Node*()>& create) {
+        RefPtr<Node> warmup = create();
+        auto start          = std::chrono::steady_clock::now();
+        for (int i = 0; i < instances; ++i)
+        {
+            RefPtr<Node> node = create();
+        }
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        return instances / elapsed.count();
+    };
+
+    std::string result;
+    result += fmt::format("CSLoader::createNode: {:.0f} instances/s\n",
+                          measure([&]() { return CSLoader::createNode(csbPath); }));
+    result += fmt::format("CSLoader::createNodeFromPrototype: {:.0f} instances/s",
+                          measure([&]() { return CSLoader::createNodeFromPrototype(csbPath); }));
+    CSLoader::getInstance()->removePrototype(csbPath);
+
+    AXLOGD("CSLoaderPrototypePerf:\n{}", result);
+
+    auto label = Label::createWithSystemFont(result, "Arial", 16);
+    label->setPosition(s.width / 2, s.height / 2);
+    addChild(label);
+}
+
+std::string CSLoaderPrototypePerf::title() const
+{
+    return "CSLoader prototype performance";
+}
+
+std::string CSLoaderPrototypePerf::subtitle() const
+{
+    return "500 instances of a 41 node .csb, see console for details";
+}
@@ -27,10 +27,16 @@
 #include "AssetsManagerExTest/AssetsManagerExTest.h"
 #include "TableViewTest/TableViewTestScene.h"
 #include "JSONDefaultTest/JSONDefaultTest.h"
+#if defined(AX_ENABLE_EXT_COCOSTUDIO)
+#    include "CSLoaderTest/CSLoaderTest.h"
+#endif
 
 ExtensionsTests::ExtensionsTests()
 {
     addTest("AssetsManagerExTest", []() { return new AssetsManagerExTests; });
     addTest("TableViewTest", []() { return new TableViewTests; });
     addTest("JSONDefaultTest", []() { return new JSONDefaultTests; });
+#if defined(AX_ENABLE_EXT_COCOSTUDIO)
+    addTest("CSLoaderTest", []() { return new CSLoaderTests; });
+#endif
 }
@@ -25,6 +25,8 @@
 
 #include "HttpClientTest.h"
 #include <string>
+#include "base/ZipUtils.h"
+#include "yasio/yasio.hpp"
 
 using namespace ax;
 using namespace ax::network;
@@ -37,6 +39,7 @@ HttpClientTests::HttpClientTests()
 {
     ADD_TEST_CASE(HttpClientTest);
     ADD_TEST_CASE(HttpClientClearRequestsTest);
+    ADD_TEST_CASE(HttpClientKeepAliveTest);
 }
 
 HttpClientTest::HttpClientTest() : _labelStatusCode(nullptr)
@@ -508,3 +511,124 @@ void HttpClientClearRequestsTest::onHttpRequestCompleted(HttpClient* sender, Htt
         // AXLOGW("error buffer: {}", response->getErrorBuffer());
     }
 }
+
+static const int KEEP_ALIVE_TEST_PORT               = 18080;
+static const int KEEP_ALIVE_TEST_REQUESTS           = 20;
+static const std::string_view KEEP_ALIVE_TEST_BODY = "hello from the keep-alive test server";
+
+HttpClientKeepAliveTest::HttpClientKeepAliveTest()
+{
+    auto winSize = Director::getInstance()->getWinSize();
+
+    _labelStats = Label::createWithTTF("waiting...", "fonts/arial.ttf", 18);
+    _labelStats->setPosition(winSize.width / 2, winSize.height / 2);
+    addChild(_labelStats);
+}
+
+HttpClientKeepAliveTest::~HttpClientKeepAliveTest()
+{
+    HttpClient::getInstance()->setGzipEnabled(_gzipEnabled);
+    if (_server)
+    {
+        _server->stop();
+        delete _server;
+    }
+}
+
+void HttpClientKeepAliveTest::onEnter()
+{
+    TestCase::onEnter();
+
+    startServer();
+
+    auto httpClient = HttpClient::getInstance();
+    _gzipEnabled    = httpClient->isGzipEnabled();
+    httpClient->setGzipEnabled(true);
+    httpClient->resetConnectionStats();
+
+    sendNextRequest();
+}
+
+void HttpClientKeepAliveTest::startServer()
+{
+    using namespace yasio;
+
+    // a minimal HTTP/1.1 server answering every request on the same connection
+    _server = new io_service(io_hostent{"127.0.0.1", static_cast<u_short>(KEEP_ALIVE_TEST_PORT)});
+    _server->set_option(YOPT_S_FORWARD_PACKET, 1);
+    _server->start([this](event_ptr&& event) {
+        auto transport = event->transport();
+        switch (event->kind())
+        {
+        case YEK_ON_OPEN:
+            if (event->status() == 0 && transport)
+                ++_serverConnections;
+            break;
+        case YEK_ON_PACKET:
+        {
+            auto& buffer = _serverBuffers[transport];
+            auto&& pkt   = event->packet_view();
+            buffer.append(pkt.data(), pkt.size());
+
+            size_t headerEnd;
+            while ((headerEnd = buffer.find("\r\n\r\n")) != std::string::npos)
+            {
+                const bool gzip = buffer.substr(0, headerEnd).find("Accept-Encoding: gzip") != std::string::npos;
+                buffer.erase(0, headerEnd + 4);
+
+                std::string body{KEEP_ALIVE_TEST_BODY};
+                if (gzip)
+                {
+                    auto compressed = ZipUtils::compressGZ(body.data(), body.size());
+                    body.assign(reinterpret_cast<const char*>(compressed.data()), compressed.size());
+                }
+
+                auto reply = fmt::format("HTTP/1.1 200 OK\r\nContent-Type: text/plain\r\n{}Content-Length: {}\r\n\r\n",
+                                         gzip ? "Content-Encoding: gzip\r\n" : "", body.size());
+                reply += body;
+                _server->write(transport, reply.data(), reply.size());
+            }
+            break;
+        }
+        case YEK_ON_CLOSE:
+            _serverBuffers.erase(transport);
+            break;
+        }
+    });
+    _server->open(0, YCK_TCP_SERVER);
+}
+
+void HttpClientKeepAliveTest::sendNextRequest()
+{
+    auto request = new HttpRequest();
+    request->setUrl(fmt::format("http://127.0.0.1:{}/ping?id={}", KEEP_ALIVE_TEST_PORT, _sentRequests));
+    request->setRequestType(HttpRequest::Type::GET);
+    request->setResponseCallback(AX_CALLBACK_2(HttpClientKeepAliveTest::onHttpRequestCompleted, this));
+    HttpClient::getInstance()->send(request);
+    request->release();
+
+    ++_sentRequests;
+}
+
+void HttpClientKeepAliveTest::onHttpRequestCompleted(HttpClient* sender, HttpResponse* response)
+{
+    auto data = response->getResponseData();
+    if (response->getResponseCode() != 200 ||
+        std::string_view{data->data(), data->size()} != KEEP_ALIVE_TEST_BODY)
+        ++_failedRequests;
+
+    if (_sentRequests < KEEP_ALIVE_TEST_REQUESTS)
+    {
+        sendNextRequest();
+        return;
+    }
+
+    auto stats  = sender->getConnectionStats();
+    auto result = fmt::format(
+        "{} requests, {} failed\nserver accepted {} connections\nclient opened {}, reused {}\n"
+        "handshake {:.2f} ms on average, {:.2f} ms saved",
+        _sentRequests, _failedRequests, _serverConnections.load(), stats.connectionsOpened, stats.connectionsReused,
+        stats.averageHandshakeMs, stats.handshakeMsSaved);
+    AXLOGI("HttpClientKeepAliveTest: {}", result);
+    _labelStats->setString(result);
+}
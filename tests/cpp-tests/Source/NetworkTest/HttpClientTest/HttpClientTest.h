@@ -26,6 +26,8 @@
 #ifndef __HTTP_CLIENT_H__
 #define __HTTP_CLIENT_H__
 
+#include <atomic>
+#include <map>
 #include "axmol.h"
 #include "extensions/axmol-ext.h"
 #include "network/HttpClient.h"
@@ -82,4 +84,34 @@ private:
     ax::Label* _labelStatusCode;
 };
 
+class HttpClientKeepAliveTest : public TestCase
+{
+public:
+    CREATE_FUNC(HttpClientKeepAliveTest);
+
+    HttpClientKeepAliveTest();
+    virtual ~HttpClientKeepAliveTest();
+
+    virtual void onEnter() override;
+
+    virtual std::string title() const override { return "Http Keep-Alive Test"; }
+    virtual std::string subtitle() const override { return "Sequential gzip requests to a local server"; }
+
+private:
+    void startServer();
+    void sendNextRequest();
+
+    // Http Response Callback
+    void onHttpRequestCompleted(ax::network::HttpClient* sender, ax::network::HttpResponse* response);
+
+    yasio::io_service* _server = nullptr;
+    std::atomic<int> _serverConnections{0};
+    std::map<yasio::transport_handle_t, std::string> _serverBuffers;  // server thread only
+
+    int _sentRequests   = 0;
+    int _failedRequests = 0;
+    bool _gzipEnabled   = false;
+    ax::Label* _labelStats = nullptr;
+};
+
 #endif  //__HTTPREQUESTHTTP_H
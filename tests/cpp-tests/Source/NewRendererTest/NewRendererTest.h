@@ -279,4 +279,13 @@ protected:
     Ticker _contFast              = Ticker(2);
     Ticker _around30fps           = Ticker(60 * 3);
 };
+
+class RendererCommandSortPerf : public MultiSceneTest
+{
+public:
+    CREATE_FUNC(RendererCommandSortPerf);
+    virtual std::string title() const override;
+    virtual std::string subtitle() const override;
+    virtual void onEnter() override;
+};
 #endif  //__NewRendererTest_H_
@@ -26,6 +26,7 @@
 
 #include "NodeTest.h"
 #include <regex>
+#include <chrono>
 #include "../testResource.h"
 
 using namespace ax;
@@ -73,6 +74,8 @@ CocosNodeTests::CocosNodeTests()
     ADD_TEST_CASE(Issue16100Test);
     ADD_TEST_CASE(Issue16735Test);
     ADD_TEST_CASE(NodeWorldSpace);
+    ADD_TEST_CASE(NodeVisitPerf);
+    ADD_TEST_CASE(NodeSpatialIndexTest);
 }
 
 TestCocosNodeDemo::TestCocosNodeDemo(void) {}
@@ -1568,3 +1571,153 @@ std::string NodeWorldSpace::subtitle() const
 {
     return "Child sprite (small one) should always stay at the center of screen\nthe child sprite is a child of the moving parent sprite";
 }
+
+//------------------------------------------------------------------
+//
+// NodeVisitPerf
+//
+//------------------------------------------------------------------
+void NodeVisitPerf::onEnter()
+{
+    TestCocosNodeDemo::onEnter();
+
+    auto s        = Director::getInstance()->getWinSize();
+    auto renderer = Director::getInstance()->getRenderer();
+
+    constexpr int groups = 50, leaves = 1000, rounds = 20;
+
+    // 50 groups of 1000 leaves, 50050 nodes in total. The tree is visited off-screen,
+    // so the numbers only cover transform propagation and the visit itself.
+    auto buildTree = [&](float positionZ) {
+        auto root = Node::create();
+        for (int g = 0; g < groups; ++g)
+        {
+            auto group = Node::create();
+            group->setPosition(g * 10.0f, g * 5.0f);
+            group->setRotation(g * 7.0f);
+            for (int l = 0; l < leaves; ++l)
+            {
+                auto leaf = Node::create();
+                leaf->setPosition3D(Vec3(l * 0.5f, l * 0.25f, positionZ));
+                leaf->setScale(0.5f + (l % 10) * 0.1f);
+                leaf->setAnchorPoint(Vec2::ANCHOR_MIDDLE);
+                leaf->setContentSize(Size(32, 32));
+                group->addChild(leaf);
+            }
+            root->addChild(group);
+        }
+        return root;
+    };
+
+    // returns the average time of one visit over the whole tree in milliseconds, with the
+    // transforms optionally propagated by a parallel prepareTransforms() pass first
+    auto measure = [&](Node* root, size_t parallelThreshold = 0) {
+        auto visitTree = [&]() {
+            if (parallelThreshold != 0)
+                root->prepareTransforms(Mat4::IDENTITY, Node::FLAGS_TRANSFORM_DIRTY, parallelThreshold);
+            root->visit(renderer, Mat4::IDENTITY, Node::FLAGS_TRANSFORM_DIRTY);
+        };
+        visitTree();  // warm up
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < rounds; ++i)
+            visitTree();
+        std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        return elapsed.count() / rounds;
+    };
+
+    RefPtr<Node> tree2D = buildTree(0.0f);
+    RefPtr<Node> tree3D = buildTree(1.0f);
+
+    const bool matrixStackSync = Node::isMatrixStackSyncEnabled();
+    std::string result;
+
+    Node::setMatrixStackSyncEnabled(true);
+    result += fmt::format("3D transforms, matrix stack: {:.2f} ms\n", measure(tree3D));
+    result += fmt::format("2D transforms, matrix stack: {:.2f} ms\n", measure(tree2D));
+    Node::setMatrixStackSyncEnabled(false);
+    result += fmt::format("3D transforms, no matrix stack: {:.2f} ms\n", measure(tree3D));
+    result += fmt::format("2D transforms, no matrix stack: {:.2f} ms\n", measure(tree2D));
+    result += fmt::format("2D transforms, parallel prepare: {:.2f} ms", measure(tree2D, 256));
+    Node::setMatrixStackSyncEnabled(matrixStackSync);
+
+    AXLOGD("NodeVisitPerf:\n{}", result);
+
+    auto label = Label::createWithSystemFont(result, "Arial", 16);
+    label->setPosition(s.width / 2, s.height / 2);
+    addChild(label);
+}
+
+std::string NodeVisitPerf::title() const
+{
+    return "Node visit performance";
+}
+
+std::string NodeVisitPerf::subtitle() const
+{
+    return "50k nodes, see console for details";
+}
+
+//------------------------------------------------------------------
+//
+// NodeSpatialIndexTest
+//
+//------------------------------------------------------------------
+void NodeSpatialIndexTest::onEnter()
+{
+    TestCocosNodeDemo::onEnter();
+
+    auto s = Director::getInstance()->getWinSize();
+
+    // a 200x100 grid of sprites, about 20 screens wide, scrolling back and forth
+    constexpr int columns = 200, rows = 100;
+    constexpr float spacing = 40.0f;
+
+    _world = SpatialIndexNode::create(256.0f);
+    for (int y = 0; y < rows; ++y)
+    {
+        for (int x = 0; x < columns; ++x)
+        {
+            auto sprite = Sprite::create(s_pathGrossini);
+            sprite->setScale(0.25f);
+            sprite->setPosition(x * spacing, y * spacing);
+            _world->addChild(sprite);
+        }
+    }
+    // a few children keep moving, so the index has to follow them
+    for (int i = 0; i < 200; ++i)
+    {
+        auto mover = _world->getChildren().at(i * 97);
+        mover->runAction(RepeatForever::create(
+            Sequence::create(MoveBy::create(2.0f, Vec2(400, 0)), MoveBy::create(2.0f, Vec2(-400, 0)), nullptr)));
+    }
+    addChild(_world);
+
+    const float worldWidth = columns * spacing, worldHeight = rows * spacing;
+    _world->runAction(RepeatForever::create(
+        Sequence::create(MoveTo::create(10.0f, Vec2(s.width - worldWidth, s.height - worldHeight)),
+                         MoveTo::create(10.0f, Vec2::ZERO), nullptr)));
+
+    _statsLabel = Label::createWithSystemFont("", "Arial", 16);
+    _statsLabel->setPosition(s.width / 2, 60);
+    addChild(_statsLabel, 1);
+
+    scheduleUpdate();
+}
+
+void NodeSpatialIndexTest::update(float dt)
+{
+    auto& stats = _world->getCullingStats();
+    _statsLabel->setString(fmt::format("children: {}, cells queried: {}, tested: {}, culled: {}, reindexed: {}",
+                                       stats.totalChildren, stats.cellsQueried, stats.tested, stats.culled,
+                                       stats.reindexed));
+}
+
+std::string NodeSpatialIndexTest::title() const
+{
+    return "SpatialIndexNode";
+}
+
+std::string NodeSpatialIndexTest::subtitle() const
+{
+    return "20000 sprites, only the ones near the screen are visited";
+}
@@ -369,4 +369,29 @@ public:
     virtual void onExit() override;
 };
 
+class NodeVisitPerf : public TestCocosNodeDemo
+{
+public:
+    CREATE_FUNC(NodeVisitPerf);
+    virtual std::string title() const override;
+    virtual std::string subtitle() const override;
+
+    virtual void onEnter() override;
+};
+
+class NodeSpatialIndexTest : public TestCocosNodeDemo
+{
+public:
+    CREATE_FUNC(NodeSpatialIndexTest);
+    virtual std::string title() const override;
+    virtual std::string subtitle() const override;
+
+    virtual void onEnter() override;
+    virtual void update(float dt) override;
+
+protected:
+    ax::SpatialIndexNode* _world = nullptr;
+    ax::Label* _statsLabel       = nullptr;
+};
+
 #endif
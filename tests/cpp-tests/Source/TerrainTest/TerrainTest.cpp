@@ -31,6 +31,7 @@ TerrainTests::TerrainTests()
     ADD_TEST_CASE(TerrainSimple);
     ADD_TEST_CASE(TerrainWalkThru);
     ADD_TEST_CASE(TerrainWithLightMap);
+    ADD_TEST_CASE(TerrainPaging);
 }
 
 Vec3 camera_offset(0, 45, 60);
@@ -100,6 +101,75 @@ void TerrainSimple::onTouchesMoved(const std::vector<ax::Touch*>& touches, ax::E
     _camera->setPosition3D(cameraPos);
 }
 
+TerrainPaging::TerrainPaging()
+{
+    Size visibleSize = Director::getInstance()->getVisibleSize();
+
+    // use custom camera
+    _camera = Camera::createPerspective(60, visibleSize.width / visibleSize.height, 0.1f, 800);
+    _camera->setCameraFlag(CameraFlag::USER1);
+    _camera->setPosition3D(Vec3(-1, 1.6f, 4));
+    addChild(_camera);
+
+    Terrain::DetailMap r("TerrainTest/dirt.jpg"), g("TerrainTest/Grass2.jpg"), b("TerrainTest/road.jpg"),
+        a("TerrainTest/GreenSkin.jpg");
+
+    Terrain::TerrainData data("TerrainTest/heightmap16.jpg", "TerrainTest/alphamap.png", r, g, b, a);
+    data._pagingDistance = 6.4f;
+
+    _terrain = Terrain::create(data, Terrain::CrackFixedType::SKIRT);
+    _terrain->setLODDistance(3.2f, 6.4f, 9.6f);
+    _terrain->setMaxDetailMapAmount(4);
+    addChild(_terrain);
+    _terrain->setCameraMask(2);
+
+    _stats = Label::createWithTTF("", "fonts/arial.ttf", 14);
+    _stats->setPosition(visibleSize.width / 2, 40);
+    addChild(_stats);
+
+    auto listener            = EventListenerTouchAllAtOnce::create();
+    listener->onTouchesMoved = AX_CALLBACK_2(TerrainPaging::onTouchesMoved, this);
+    _eventDispatcher->addEventListenerWithSceneGraphPriority(listener, this);
+    scheduleUpdate();
+}
+
+std::string TerrainPaging::title() const
+{
+    return "Terrain paging";
+}
+
+std::string TerrainPaging::subtitle() const
+{
+    return "Drag to walkThru, chunks are built around the camera";
+}
+
+void TerrainPaging::update(float dt)
+{
+    _stats->setString(fmt::format("loaded chunks: {}", _terrain->getLoadedChunkCount()));
+}
+
+void TerrainPaging::onTouchesMoved(const std::vector<ax::Touch*>& touches, ax::Event* event)
+{
+    float delta           = Director::getInstance()->getDeltaTime();
+    auto touch            = touches[0];
+    auto location         = touch->getLocation();
+    auto PreviousLocation = touch->getPreviousLocation();
+    Point newPos          = PreviousLocation - location;
+
+    Vec3 cameraDir;
+    Vec3 cameraRightDir;
+    _camera->getNodeToWorldTransform().getForwardVector(&cameraDir);
+    cameraDir.normalize();
+    cameraDir.y = 0;
+    _camera->getNodeToWorldTransform().getRightVector(&cameraRightDir);
+    cameraRightDir.normalize();
+    cameraRightDir.y = 0;
+    Vec3 cameraPos   = _camera->getPosition3D();
+    cameraPos += cameraDir * newPos.y * 0.5 * delta;
+    cameraPos += cameraRightDir * newPos.x * 0.5 * delta;
+    _camera->setPosition3D(cameraPos);
+}
+
 std::string TerrainWalkThru::title() const
 {
     return "Player walk around in terrain";
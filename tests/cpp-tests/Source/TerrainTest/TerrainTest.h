@@ -53,6 +53,22 @@ protected:
     ax::Camera* _camera;
 };
 
+class TerrainPaging : public TerrainTestDemo
+{
+public:
+    CREATE_FUNC(TerrainPaging);
+    TerrainPaging();
+    virtual std::string title() const override;
+    virtual std::string subtitle() const override;
+    virtual void update(float dt) override;
+    void onTouchesMoved(const std::vector<ax::Touch*>& touches, ax::Event* event);
+
+protected:
+    ax::Terrain* _terrain;
+    ax::Camera* _camera;
+    ax::Label* _stats;
+};
+
 #    define PLAYER_STATE_LEFT 0
 #    define PLAYER_STATE_RIGHT 1
 #    define PLAYER_STATE_IDLE 2
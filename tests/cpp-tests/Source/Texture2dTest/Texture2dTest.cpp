@@ -28,6 +28,10 @@
 // local import
 #include "Texture2dTest.h"
 #include "../testResource.h"
+#include "renderer/backend/PixelFormatUtils.h"
+
+#include <chrono>
+#include <random>
 
 using namespace ax;
 
@@ -112,6 +116,7 @@ Texture2DTests::Texture2DTests()
     ADD_TEST_CASE(TextureConvertRGBA8888);
     ADD_TEST_CASE(TextureConvertL8);
     ADD_TEST_CASE(TextureConvertLA8);
+    ADD_TEST_CASE(TextureConvertPerf);
 };
 
 //------------------------------------------------------------------
@@ -2492,3 +2497,68 @@ std::string TextureConvertLA8::subtitle() const
 {
     return "RGBA8888,RGB888,RGB565,R8,RG8,RGBA4444,RGB5A1";
 }
+
+// TextureConvertPerf
+void TextureConvertPerf::onEnter()
+{
+    TextureDemo::onEnter();
+
+    auto s = Director::getInstance()->getWinSize();
+
+    constexpr int width = 1024, height = 1024, rounds = 10;
+    std::vector<unsigned char> rgba(width * height * 4);
+    std::mt19937 rng(7);
+    for (auto& c : rgba)
+        c = static_cast<unsigned char>(rng());
+
+    // returns the throughput over the source pixels in MB/s
+    auto measure = [&](const std::function<void()>& run) {
+        run();  // warm up
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < rounds; ++i)
+            run();
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        return (double)rgba.size() * rounds / (1024.0 * 1024.0) / elapsed.count();
+    };
+    auto convert = [&](backend::PixelFormat from, backend::PixelFormat to) {
+        return [&, from, to]() {
+            unsigned char* out = nullptr;
+            size_t outLen      = 0;
+            backend::PixelFormatUtils::convertDataToFormat(rgba.data(), rgba.size(), from, to, &out, &outLen);
+            free(out);
+        };
+    };
+
+    std::vector<unsigned char> scratch(rgba.size());
+    std::string result;
+    result += fmt::format("RGBA8 -> RGB565: {:.0f} MB/s\n",
+                          measure(convert(backend::PixelFormat::RGBA8, backend::PixelFormat::RGB565)));
+    result += fmt::format("RGBA8 -> RGBA4: {:.0f} MB/s\n",
+                          measure(convert(backend::PixelFormat::RGBA8, backend::PixelFormat::RGBA4)));
+    result += fmt::format("BGRA8 -> RGBA8: {:.0f} MB/s\n",
+                          measure(convert(backend::PixelFormat::BGRA8, backend::PixelFormat::RGBA8)));
+    result += fmt::format("premultiply RGBA8: {:.0f} MB/s\n", measure([&]() {
+                              memcpy(scratch.data(), rgba.data(), rgba.size());
+                              backend::PixelFormatUtils::premultiplyAlphaRGBA8(scratch.data(), width * height);
+                          }));
+    result += fmt::format("premultiply RG8: {:.0f} MB/s", measure([&]() {
+                              memcpy(scratch.data(), rgba.data(), rgba.size());
+                              backend::PixelFormatUtils::premultiplyAlphaRG8(scratch.data(), width * height * 2);
+                          }));
+
+    AXLOGD("TextureConvertPerf:\n{}", result);
+
+    auto label = Label::createWithSystemFont(result, "Arial", 16);
+    label->setPosition(s.width / 2, s.height / 2);
+    addChild(label);
+}
+
+std::string TextureConvertPerf::title() const
+{
+    return "Pixel format conversion throughput";
+}
+
+std::string TextureConvertPerf::subtitle() const
+{
+    return "1024x1024 source, see console for details";
+}
@@ -681,4 +681,14 @@ public:
     virtual std::string subtitle() const override;
 };
 
+// conversion and premultiply throughput
+class TextureConvertPerf : public TextureDemo
+{
+public:
+    CREATE_FUNC(TextureConvertPerf);
+    virtual void onEnter() override;
+    virtual std::string title() const override;
+    virtual std::string subtitle() const override;
+};
+
 #endif  // __TEXTURE2D_TEST_H__
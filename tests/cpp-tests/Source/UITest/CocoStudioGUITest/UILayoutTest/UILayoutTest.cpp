@@ -23,6 +23,7 @@
  ****************************************************************************/
 
 #include "UILayoutTest.h"
+#include <chrono>
 
 using namespace ax;
 using namespace ax::ui;
@@ -46,6 +47,7 @@ UILayoutTests::UILayoutTests()
     ADD_TEST_CASE(UILayoutComponent_Berth_Stretch_Test);
     ADD_TEST_CASE(UILayoutTest_Issue19890);
     ADD_TEST_CASE(UILayout_Clipping_Test);
+    ADD_TEST_CASE(UILayoutTest_Layout_Nested_Perf);
 }
 
 // UILayoutTest
@@ -1136,3 +1138,147 @@ bool UILayout_Clipping_Test::init()
     }
     return false;
 }
+
+// UILayoutTest_Layout_Nested_Perf
+
+namespace
+{
+// counts the layout passes which actually run and the time spent in them
+class CountingLayout : public Layout
+{
+public:
+    CREATE_FUNC(CountingLayout);
+
+    static int passes;
+    static std::chrono::steady_clock::duration elapsed;
+
+protected:
+    virtual void doLayout() override
+    {
+        if (!_doLayoutDirty)
+        {
+            return;
+        }
+        auto start = std::chrono::steady_clock::now();
+        Layout::doLayout();
+        elapsed += std::chrono::steady_clock::now() - start;
+        ++passes;
+    }
+};
+
+int CountingLayout::passes                                  = 0;
+std::chrono::steady_clock::duration CountingLayout::elapsed = {};
+}  // namespace
+
+bool UILayoutTest_Layout_Nested_Perf::init()
+{
+    if (UIScene::init())
+    {
+        Size widgetSize = _widget->getContentSize();
+
+        // 5 levels of 3 children, vertical, horizontal and relative layouts in turn
+        auto root = createNestedLayout(Size(widgetSize.width * 0.6f, widgetSize.height * 0.5f), 5);
+        root->setBackGroundColorType(Layout::BackGroundColorType::SOLID);
+        root->setBackGroundColor(Color3B(64, 64, 96));
+        root->setAnchorPoint(Vec2::ANCHOR_MIDDLE);
+        root->setPosition(Vec2(widgetSize.width / 2.0f, widgetSize.height / 2.0f));
+        _uiLayer->addChild(root);
+
+        _statusLabel = Text::create(" ", "fonts/Marker Felt.ttf", 16);
+        _statusLabel->setPosition(Vec2(widgetSize.width / 2.0f, widgetSize.height / 2.0f - widgetSize.height * 0.3f));
+        _uiLayer->addChild(_statusLabel);
+
+        auto button = Button::create("cocosui/button.png", "cocosui/buttonHighlighted.png");
+        button->setTitleText("Toggle");
+        button->setPosition(Vec2(widgetSize.width / 2.0f + widgetSize.width * 0.38f, widgetSize.height / 2.0f));
+        button->addClickEventListener([this](Object*) { _relayoutAll = !_relayoutAll; });
+        _uiLayer->addChild(button);
+
+        CountingLayout::passes  = 0;
+        CountingLayout::elapsed = {};
+        scheduleUpdate();
+        return true;
+    }
+    return false;
+}
+
+Layout* UILayoutTest_Layout_Nested_Perf::createNestedLayout(const Size& size, int depth)
+{
+    static const Layout::Type types[] = {Layout::Type::VERTICAL, Layout::Type::HORIZONTAL, Layout::Type::RELATIVE};
+
+    auto layout = CountingLayout::create();
+    layout->setLayoutType(types[depth % 3]);
+    layout->setContentSize(size);
+    _layouts.push_back(layout);
+
+    for (int i = 0; i < 3; ++i)
+    {
+        Widget* child = nullptr;
+        if (depth > 1)
+        {
+            child = createNestedLayout(Size(size.width / 3.0f, size.height / 3.0f), depth - 1);
+        }
+        else
+        {
+            auto leaf = Text::create("x", "fonts/Marker Felt.ttf", 6);
+            _leaves.push_back(leaf);
+            child = leaf;
+        }
+
+        if (layout->getLayoutType() == Layout::Type::RELATIVE)
+        {
+            // every child is placed next to the previous one
+            auto parameter = RelativeLayoutParameter::create();
+            parameter->setRelativeName(fmt::format("child{}", i));
+            if (i == 0)
+            {
+                parameter->setAlign(RelativeLayoutParameter::RelativeAlign::PARENT_LEFT_CENTER_VERTICAL);
+            }
+            else
+            {
+                parameter->setRelativeToWidgetName(fmt::format("child{}", i - 1));
+                parameter->setAlign(RelativeLayoutParameter::RelativeAlign::LOCATION_RIGHT_OF_CENTER);
+            }
+            child->setLayoutParameter(parameter);
+        }
+        else
+        {
+            auto parameter = LinearLayoutParameter::create();
+            parameter->setGravity(layout->getLayoutType() == Layout::Type::VERTICAL
+                                      ? LinearLayoutParameter::LinearGravity::CENTER_HORIZONTAL
+                                      : LinearLayoutParameter::LinearGravity::CENTER_VERTICAL);
+            child->setLayoutParameter(parameter);
+        }
+        layout->addChild(child);
+    }
+    return layout;
+}
+
+void UILayoutTest_Layout_Nested_Perf::update(float dt)
+{
+    static const unsigned int REPORT_FRAMES = 60;
+
+    // the counters hold the passes of the frames visited since the last report
+    if (++_frames % REPORT_FRAMES == 0)
+    {
+        double ms = std::chrono::duration<double, std::milli>(CountingLayout::elapsed).count();
+        _statusLabel->setString(fmt::format("{}: {:.1f} of {} layouts laid out per frame, {:.3f} ms per frame",
+                                            _relayoutAll ? "Relayout all" : "Incremental",
+                                            float(CountingLayout::passes) / REPORT_FRAMES, _layouts.size(),
+                                            ms / REPORT_FRAMES));
+        CountingLayout::passes  = 0;
+        CountingLayout::elapsed = {};
+    }
+
+    // one leaf changes its size, only its parent has to run again
+    auto leaf = _leaves[_frames % _leaves.size()];
+    leaf->setString(std::string(_frames % 3 + 1, 'x'));
+
+    if (_relayoutAll)
+    {
+        for (auto&& layout : _layouts)
+        {
+            layout->requestDoLayout();
+        }
+    }
+}
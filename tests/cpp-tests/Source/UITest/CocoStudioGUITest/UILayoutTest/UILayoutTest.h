@@ -200,4 +200,23 @@ public:
     CREATE_FUNC(UILayout_Clipping_Test);
 };
 
+// Deep nested linear and relative layouts where one leaf changes its size every frame
+class UILayoutTest_Layout_Nested_Perf : public UIScene
+{
+public:
+    CREATE_FUNC(UILayoutTest_Layout_Nested_Perf);
+
+    virtual bool init() override;
+    virtual void update(float dt) override;
+
+protected:
+    ax::ui::Layout* createNestedLayout(const ax::Size& size, int depth);
+
+    std::vector<ax::ui::Layout*> _layouts;
+    std::vector<ax::ui::Text*> _leaves;
+    ax::ui::Text* _statusLabel = nullptr;
+    bool _relayoutAll          = false;
+    unsigned int _frames       = 0;
+};
+
 #endif /* defined(__TestCpp__UILayoutTest__) */
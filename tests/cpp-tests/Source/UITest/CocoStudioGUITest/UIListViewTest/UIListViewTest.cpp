@@ -39,6 +39,7 @@ UIListViewTests::UIListViewTests()
     ADD_TEST_CASE(UIListViewTest_MagneticHorizontal);
     ADD_TEST_CASE(UIListViewTest_PaddingVertical);
     ADD_TEST_CASE(UIListViewTest_PaddingHorizontal);
+    ADD_TEST_CASE(UIListViewTest_Virtual);
     ADD_TEST_CASE(Issue12692);
     ADD_TEST_CASE(Issue8316);
 }
@@ -1055,3 +1056,73 @@ void UIListViewTest_Padding::sliderEvent(Object* pSender, Slider::EventType type
         }
     }
 }
+
+bool UIListViewTest_Virtual::init()
+{
+    if (!UIScene::init())
+    {
+        return false;
+    }
+
+    static const int ITEM_COUNT = 10000;
+    static const Size BUTTON_SIZE(240, 40);
+
+    Size layerSize = _uiLayer->getContentSize();
+
+    auto titleLabel = Text::create(fmt::format("Virtual list, {} items", ITEM_COUNT), "fonts/Marker Felt.ttf", 32);
+    titleLabel->setAnchorPoint(Vec2::ANCHOR_MIDDLE);
+    titleLabel->setPosition(Vec2(layerSize / 2) + Vec2(0.0f, titleLabel->getContentSize().height * 3.15f));
+    _uiLayer->addChild(titleLabel, 3);
+
+    _statusLabel = Text::create(" ", "fonts/Marker Felt.ttf", 14);
+    _statusLabel->setAnchorPoint(Vec2::ANCHOR_MIDDLE);
+    _statusLabel->setPosition(Vec2(layerSize / 2) + Vec2(0.0f, -layerSize.height / 4 - 16.0f));
+    _uiLayer->addChild(_statusLabel, 3);
+
+    _listView = ListView::create();
+    _listView->setDirection(ScrollView::Direction::VERTICAL);
+    _listView->setBounceEnabled(true);
+    _listView->setBackGroundImage("cocosui/green_edit.png");
+    _listView->setBackGroundImageScale9Enabled(true);
+    _listView->setContentSize(layerSize / 2);
+    _listView->setScrollBarPositionFromCorner(Vec2(7, 7));
+    _listView->setItemsMargin(2.0f);
+    _listView->setGravity(ListView::Gravity::CENTER_HORIZONTAL);
+    _listView->setMagneticType(ListView::MagneticType::CENTER);
+    _listView->setAnchorPoint(Vec2::ANCHOR_MIDDLE);
+    _listView->setPosition(layerSize / 2);
+    _uiLayer->addChild(_listView);
+
+    // Only the cells in the window are created, each one is rebound when it is recycled
+    _listView->setVirtual(
+        BUTTON_SIZE,
+        [](ListView*, ssize_t index, Widget* cell) {
+            static_cast<Button*>(cell)->setTitleText(fmt::format("Item-{}", index));
+        },
+        [](ListView*) -> Widget* {
+            auto button = Button::create("cocosui/button.png", "cocosui/buttonHighlighted.png");
+            button->setScale9Enabled(true);
+            button->setContentSize(BUTTON_SIZE);
+            return button;
+        });
+    _listView->setNumItems(ITEM_COUNT);
+
+    _listView->addEventListener([this](Object*, ListView::EventType type) {
+        if (type == ListView::EventType::ON_SELECTED_ITEM_END)
+        {
+            _statusLabel->setString(fmt::format("Selected item {}, {} widgets in the list",
+                                                _listView->getCurSelectedIndex(),
+                                                _listView->getInnerContainer()->getChildrenCount()));
+        }
+    });
+
+    auto jumpButton = Button::create("cocosui/button.png", "cocosui/buttonHighlighted.png");
+    jumpButton->setTitleText("Jump to middle");
+    jumpButton->setPosition(Vec2(layerSize.width / 2 + layerSize.width / 4 + 80.0f, layerSize.height / 2));
+    jumpButton->addClickEventListener([this](Object*) {
+        _listView->jumpToItem(ITEM_COUNT / 2, Vec2::ANCHOR_MIDDLE, Vec2::ANCHOR_MIDDLE);
+    });
+    _uiLayer->addChild(jumpButton);
+
+    return true;
+}
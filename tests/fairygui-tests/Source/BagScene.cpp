@@ -13,10 +13,28 @@ BagScene::~BagScene()
 
 void BagScene::continueInit()
 {
-    UIPackage::addPackage("UI/Bag");
     UIConfig::horizontalScrollBar = "";
     UIConfig::verticalScrollBar = "";
 
+    auto progressText = GTextField::create();
+    progressText->setText("Loading...");
+    progressText->setPosition(_groot->getWidth() / 2, _groot->getHeight() / 2);
+    _groot->addChild(progressText);
+
+    // keep the scene alive until the package arrives, it may be closed while loading
+    retain();
+    UIPackage::addPackageAsync("UI/Bag",
+        [this, progressText](UIPackage* pkg) {
+            _groot->removeChild(progressText);
+            if (pkg)
+                onPackageLoaded();
+            release();
+        },
+        [progressText](float progress) { progressText->setText(fmt::format("Loading {}%", (int)(progress * 100))); });
+}
+
+void BagScene::onPackageLoaded()
+{
     _view = UIPackage::createObject("Bag", "Main")->as<GComponent>();
     _groot->addChild(_view);
 
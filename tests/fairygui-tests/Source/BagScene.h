@@ -20,6 +20,8 @@ protected:
     virtual void continueInit() override;
 
 private:
+    void onPackageLoaded();
+
     GComponent* _view;
     BagWindow* _bagWindow;
 };
@@ -683,7 +683,85 @@ local function NodeGlobalZValueTest()
     return layer
 end
 
+-----------------------------------
+--  NodeMarshallingPerfTest
+-----------------------------------
+local function NodeMarshallingPerfTest()
+    local layer = getBaseLayer()
+
+    local nodeCount = 1000
+    local rounds = 100
+    local nodes = {}
+    for i = 1, nodeCount do
+        local node = cc.Node:create()
+        layer:addChild(node)
+        nodes[i] = node
+    end
 
+    local function measure(name, func)
+        local begin = os.clock()
+        for round = 1, rounds do
+            func(round)
+        end
+        local elapsed = (os.clock() - begin) * 1000
+        local result = string.format("%-32s %8.2f ms", name, elapsed)
+        print(result)
+        return result
+    end
+
+    local results = {}
+    -- pure Lua floor: the same loop storing into a table, no native call
+    local shadow = {}
+    results[#results + 1] = measure("lua table write", function(round)
+        for i = 1, nodeCount do
+            shadow[i] = round + i
+        end
+    end)
+    results[#results + 1] = measure("setPosition(cc.p(x, y))", function(round)
+        for i = 1, nodeCount do
+            nodes[i]:setPosition(cc.p(round, i))
+        end
+    end)
+    results[#results + 1] = measure("setPosition(x, y)", function(round)
+        for i = 1, nodeCount do
+            nodes[i]:setPosition(round, i)
+        end
+    end)
+    local coords = {}
+    results[#results + 1] = measure("Node.setPositions(nodes, coords)", function(round)
+        for i = 1, nodeCount do
+            coords[2 * i - 1] = round
+            coords[2 * i] = i
+        end
+        cc.Node.setPositions(nodes, coords)
+    end)
+    results[#results + 1] = measure("getPosition()", function(round)
+        for i = 1, nodeCount do
+            local x, y = nodes[i]:getPosition()
+        end
+    end)
+    results[#results + 1] = measure("Node.getPositions(nodes, coords)", function(round)
+        cc.Node.getPositions(nodes, coords)
+    end)
+    results[#results + 1] = measure("setContentSize(cc.size(w, h))", function(round)
+        for i = 1, nodeCount do
+            nodes[i]:setContentSize(cc.size(round, i))
+        end
+    end)
+    results[#results + 1] = measure("getContentSize()", function(round)
+        for i = 1, nodeCount do
+            local size = nodes[i]:getContentSize()
+        end
+    end)
+
+    local label = cc.Label:createWithSystemFont(table.concat(results, "\n"), "Courier New", 14)
+    label:setPosition(cc.p(s.width / 2, s.height / 2))
+    layer:addChild(label)
+
+    Helper.titleLabel:setString("Lua marshalling perf")
+    Helper.subtitleLabel:setString(string.format("%d nodes x %d rounds, see console", nodeCount, rounds))
+    return layer
+end
 
 function CocosNodeTest()
 	local scene = cc.Scene:create()
@@ -703,6 +781,7 @@ function CocosNodeTest()
         NodeOpaqueTest,
         NodeNonOpaqueTest,
         NodeGlobalZValueTest,
+        NodeMarshallingPerfTest,
     }
     Helper.index = 1
 
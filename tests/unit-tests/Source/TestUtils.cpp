@@ -1,7 +1,20 @@
 #include <doctest.h>
 #include "base/Types.h"
+#include "platform/GLViewImpl.h"
 #include "TestUtils.h"
 
+
+bool ensureGLView() {
+    auto director = ax::Director::getInstance();
+    if (!director->getGLView()) {
+        auto glView = ax::GLViewImpl::createWithRect("Unit Tests", ax::Rect(0, 0, 128, 128));
+        if (!glView)
+            return false;
+        director->setGLView(glView);
+    }
+    return true;
+}
+
 namespace ax
 {
 
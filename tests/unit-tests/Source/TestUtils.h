@@ -41,6 +41,12 @@ public:
 };
 
 
+/// Makes sure the director has a GL view, creating a small window for the tests
+/// that need a GL context. Returns false when no window can be created, e.g. on a
+/// headless machine, so the caller can skip its checks.
+bool ensureGLView();
+
+
 namespace ax {
     doctest::String toString(const Color4B& value);
     doctest::String toString(const Vec2& value);
@@ -0,0 +1,144 @@
+/****************************************************************************
+ Copyright (c) 2019-present Axmol Engine contributors (see AUTHORS.md).
+
+ https://axmol.dev/
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ ****************************************************************************/
+
+#include <doctest.h>
+#include "2d/AutoPolygon.h"
+#include "platform/FileUtils.h"
+#include "platform/Image.h"
+
+using namespace ax;
+
+namespace
+{
+// an opaque disc on a transparent background
+void writeDiscImage(std::string_view path, int size)
+{
+    std::vector<uint8_t> pixels(size * size * 4, 0);
+    const float radius = size * 0.4f;
+    for (int y = 0; y < size; ++y)
+    {
+        for (int x = 0; x < size; ++x)
+        {
+            const float dx = x - size * 0.5f, dy = y - size * 0.5f;
+            if (dx * dx + dy * dy <= radius * radius)
+                std::fill_n(&pixels[(y * size + x) * 4], 4, uint8_t{255});
+        }
+    }
+    Image image;
+    REQUIRE(image.initWithRawData(pixels.data(), pixels.size(), size, size, 8));
+    REQUIRE(image.saveToFile(path, false));
+}
+
+void checkSamePolygon(const PolygonInfo& lhs, const PolygonInfo& rhs)
+{
+    REQUIRE(lhs.triangles.vertCount == rhs.triangles.vertCount);
+    REQUIRE(lhs.triangles.indexCount == rhs.triangles.indexCount);
+    CHECK(lhs.getRect().equals(rhs.getRect()));
+    for (unsigned int i = 0; i < lhs.triangles.vertCount; ++i)
+    {
+        CHECK(lhs.triangles.verts[i].vertices == rhs.triangles.verts[i].vertices);
+        CHECK(lhs.triangles.verts[i].texCoords == rhs.triangles.verts[i].texCoords);
+    }
+    for (unsigned int i = 0; i < lhs.triangles.indexCount; ++i)
+        CHECK(lhs.triangles.indices[i] == rhs.triangles.indices[i]);
+}
+}  // namespace
+
+TEST_SUITE("2d/AutoPolygon")
+{
+    TEST_CASE("polygon cache")
+    {
+        auto fileUtils = FileUtils::getInstance();
+        auto imagePath = fileUtils->getWritablePath() + "autopolygon_disc.png";
+        auto cachePath = fileUtils->getWritablePath() + "autopolygon_disc.polycache";
+        auto emptyPath = fileUtils->getWritablePath() + "autopolygon_empty.polycache";
+        writeDiscImage(imagePath, 64);
+        AutoPolygon::purgePolygonCache();
+
+        auto generated = AutoPolygon::generatePolygon(imagePath);
+        REQUIRE(generated.getTrianglesCount() > 0);
+        checkSamePolygon(generated, AutoPolygon::generatePolygon(imagePath));
+
+        SUBCASE("save and load")
+        {
+            REQUIRE(AutoPolygon::savePolygonCache(cachePath));
+            AutoPolygon::purgePolygonCache();
+            REQUIRE(AutoPolygon::savePolygonCache(emptyPath));
+            CHECK(fileUtils->getFileSize(emptyPath) < fileUtils->getFileSize(cachePath));
+
+            REQUIRE(AutoPolygon::loadPolygonCache(cachePath));
+            REQUIRE(AutoPolygon::savePolygonCache(emptyPath));
+            CHECK(fileUtils->getFileSize(emptyPath) == fileUtils->getFileSize(cachePath));
+            checkSamePolygon(generated, AutoPolygon::generatePolygon(imagePath));
+        }
+
+        SUBCASE("invalid cache files")
+        {
+            fileUtils->writeStringToFile("not a polygon cache", cachePath);
+            CHECK_FALSE(AutoPolygon::loadPolygonCache(cachePath));
+            CHECK_FALSE(AutoPolygon::loadPolygonCache(fileUtils->getWritablePath() + "autopolygon_missing.polycache"));
+        }
+
+        SUBCASE("other parameters aren't served from the cache")
+        {
+            auto half = AutoPolygon::generatePolygon(imagePath, Rect(0, 0, 32, 64));
+            CHECK(half.getRect().size.width <= 32);
+        }
+
+        AutoPolygon::purgePolygonCache();
+        fileUtils->removeFile(imagePath);
+        fileUtils->removeFile(cachePath);
+        fileUtils->removeFile(emptyPath);
+    }
+
+    TEST_CASE("generatePolygons")
+    {
+        auto fileUtils = FileUtils::getInstance();
+        auto small     = fileUtils->getWritablePath() + "autopolygon_small.png";
+        auto large     = fileUtils->getWritablePath() + "autopolygon_large.png";
+        writeDiscImage(small, 32);
+        writeDiscImage(large, 96);
+
+        AutoPolygon::setPolygonCacheEnabled(false);
+        std::vector<AutoPolygon::PolygonRequest> requests;
+        for (int i = 0; i < 8; ++i)
+            requests.push_back({i % 2 ? small : large, Rect::ZERO, 1.0f + i * 0.5f});
+        requests.push_back({fileUtils->getWritablePath() + "autopolygon_missing.png"});
+
+        auto results = AutoPolygon::generatePolygons(requests);
+        REQUIRE(results.size() == requests.size());
+        for (size_t i = 0; i + 1 < requests.size(); ++i)
+        {
+            CAPTURE(i);
+            auto& request = requests[i];
+            checkSamePolygon(results[i], AutoPolygon::generatePolygon(request.filename, request.rect, request.epsilon,
+                                                                      request.threshold));
+        }
+        CHECK(results.back().triangles.vertCount == 0);
+
+        AutoPolygon::setPolygonCacheEnabled(true);
+        fileUtils->removeFile(small);
+        fileUtils->removeFile(large);
+    }
+}
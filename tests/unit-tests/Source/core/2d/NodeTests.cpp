@@ -28,6 +28,15 @@
 
 using namespace ax;
 
+namespace
+{
+class TransformNode : public Node
+{
+public:
+    const Mat4& getModelViewTransform() const { return _modelViewTransform; }
+};
+}  // namespace
+
 TEST_SUITE("2d/Node") {
     TEST_CASE("normalized_position") {
         auto parent = Node();
@@ -59,4 +68,38 @@ TEST_SUITE("2d/Node") {
         CHECK_EQ(200.0f, node.getPosition().x);
         CHECK_EQ(100.0f, node.getPosition().y);
     }
+
+    TEST_CASE("prepared_transforms") {
+        auto parent = new TransformNode();
+        auto child  = new TransformNode();
+        parent->addChild(child);
+        child->release();
+        parent->setPosition(100.0f, 50.0f);
+
+        SUBCASE("moved after the pass") {
+            parent->prepareTransforms(Mat4::IDENTITY, 0, 0);
+            child->setPosition(10.0f, 20.0f);  // e.g. Layout::doLayout() during visit
+            parent->visit(nullptr, Mat4::IDENTITY, 0);
+            CHECK_EQ(110.0f, child->getModelViewTransform().m[12]);
+            CHECK_EQ(70.0f, child->getModelViewTransform().m[13]);
+        }
+
+        SUBCASE("visited with another parent transform") {
+            parent->prepareTransforms(Mat4::IDENTITY, 0, 0);
+            Mat4 parentTransform;
+            Mat4::createTranslation(5.0f, 0.0f, 0.0f, &parentTransform);
+            parent->visit(nullptr, parentTransform, Node::FLAGS_TRANSFORM_DIRTY);
+            CHECK_EQ(105.0f, parent->getModelViewTransform().m[12]);
+            CHECK_EQ(105.0f, child->getModelViewTransform().m[12]);
+        }
+
+        SUBCASE("unchanged since the pass") {
+            parent->prepareTransforms(Mat4::IDENTITY, 0, 0);
+            parent->visit(nullptr, Mat4::IDENTITY, 0);
+            CHECK_EQ(100.0f, child->getModelViewTransform().m[12]);
+            CHECK_EQ(50.0f, child->getModelViewTransform().m[13]);
+        }
+
+        parent->release();
+    }
 }
@@ -0,0 +1,129 @@
+/****************************************************************************
+ Copyright (c) 2019-present Axmol Engine contributors (see AUTHORS.md).
+
+ https://axmol.dev/
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ ****************************************************************************/
+
+#include <doctest.h>
+#include "base/Director.h"
+#include "base/Utils.h"
+#include "2d/Layer.h"
+#include "2d/Scene.h"
+#include "platform/Image.h"
+#include "TestUtils.h"
+
+using namespace ax;
+
+namespace
+{
+class VisitCounter : public Node
+{
+public:
+    void visit(Renderer* renderer, const Mat4& parentTransform, uint32_t parentFlags) override
+    {
+        ++visits;
+        Node::visit(renderer, parentTransform, parentFlags);
+    }
+
+    int visits = 0;
+};
+
+// renders a frame and returns what it presented, the image rows go from top to bottom
+RefPtr<Image> drawAndCapture()
+{
+    RefPtr<Image> presented;
+    utils::captureScreen([&presented](RefPtr<Image> image) { presented = std::move(image); });
+    Director::getInstance()->drawScene();
+    return presented;
+}
+
+Color4B pixelAt(Image* image, int x, int y)
+{
+    auto data = image->getData() + ((image->getHeight() - 1 - y) * image->getWidth() + x) * 4;
+    return Color4B(data[0], data[1], data[2], data[3]);
+}
+}  // namespace
+
+TEST_SUITE("base/Director") {
+    TEST_CASE("dirty_region_redraw") {
+        if (!ensureGLView())
+        {
+            MESSAGE("no GL view can be created, skipped");
+            return;
+        }
+
+        auto director = Director::getInstance();
+        const Color4B blue(0, 0, 255, 255);
+        const Color4B red(255, 0, 0, 255);
+
+        auto scene   = Scene::create();
+        auto counter = new VisitCounter();
+        counter->autorelease();
+        scene->addChild(counter);
+        auto square = LayerColor::create(Color4B::RED, 20, 20);
+        square->setPosition(10, 10);
+        scene->addChild(square);
+
+        if (director->getRunningScene())
+            director->replaceScene(scene);
+        else
+            director->runWithScene(scene);
+        director->setClearColor(Color4F(blue));
+        director->setDirtyRegionRedrawEnabled(true);
+
+        SUBCASE("first_frame_presents_the_scene") {
+            auto image = drawAndCapture();
+            REQUIRE(image);
+            CHECK_EQ(red, pixelAt(image, 20, 20));
+            CHECK_EQ(blue, pixelAt(image, 60, 60));
+            CHECK_EQ(1, counter->visits);
+        }
+
+        SUBCASE("unchanged_frame_is_not_visited") {
+            director->drawScene();
+            director->drawScene();
+            director->drawScene();
+            CHECK_EQ(1, counter->visits);
+        }
+
+        SUBCASE("moved_node_redraws_old_and_new_bounds") {
+            director->drawScene();
+            square->setPosition(60, 60);
+            auto image = drawAndCapture();
+            REQUIRE(image);
+            CHECK_EQ(2, counter->visits);
+            CHECK_EQ(blue, pixelAt(image, 20, 20));
+            CHECK_EQ(red, pixelAt(image, 70, 70));
+            CHECK_EQ(blue, pixelAt(image, 110, 110));
+        }
+
+        SUBCASE("removed_node_is_cleared") {
+            director->drawScene();
+            square->removeFromParent();
+            auto image = drawAndCapture();
+            REQUIRE(image);
+            CHECK_EQ(blue, pixelAt(image, 20, 20));
+        }
+
+        director->setDirtyRegionRedrawEnabled(false);
+        director->setClearColor(Color4F::BLACK);
+    }
+}
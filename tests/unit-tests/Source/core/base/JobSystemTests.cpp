@@ -0,0 +1,82 @@
+/****************************************************************************
+ Copyright (c) 2019-present Axmol Engine contributors (see AUTHORS.md).
+
+ https://axmol.dev/
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ ****************************************************************************/
+
+#include <doctest.h>
+#include <atomic>
+#include <thread>
+#include "base/JobSystem.h"
+
+using namespace ax;
+
+TEST_SUITE("base/JobSystem")
+{
+    TEST_CASE("parallelFor")
+    {
+        JobSystem jobSystem(4);
+
+        SUBCASE("every item runs once")
+        {
+            std::vector<std::atomic<int>> hits(1000);
+            jobSystem.parallelFor(hits.size(), [&hits](size_t i) { ++hits[i]; });
+            for (auto& hit : hits)
+                CHECK(hit.load() == 1);
+        }
+
+        SUBCASE("nested calls")
+        {
+            std::atomic<int> total{0};
+            jobSystem.parallelFor(8, [&jobSystem, &total](size_t) {
+                jobSystem.parallelFor(100, [&total](size_t) { ++total; });
+            });
+            CHECK(total.load() == 800);
+        }
+
+        SUBCASE("small batches stay on the calling thread")
+        {
+            const auto caller = std::this_thread::get_id();
+            std::atomic<int> elsewhere{0};
+            jobSystem.parallelFor(7, [caller, &elsewhere](size_t) {
+                if (std::this_thread::get_id() != caller)
+                    ++elsewhere;
+            }, 4);
+            CHECK(elsewhere.load() == 0);
+        }
+
+        SUBCASE("no workers")
+        {
+            std::vector<std::shared_ptr<JobThreadData>> none;
+            JobSystem serial{std::span{none}};
+            std::vector<int> order;
+            serial.parallelFor(5, [&order](size_t i) { order.push_back(static_cast<int>(i)); });
+            CHECK(order == std::vector<int>{0, 1, 2, 3, 4});
+        }
+
+        SUBCASE("empty range")
+        {
+            bool called = false;
+            jobSystem.parallelFor(0, [&called](size_t) { called = true; });
+            CHECK_FALSE(called);
+        }
+    }
+}
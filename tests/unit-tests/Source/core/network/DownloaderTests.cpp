@@ -0,0 +1,227 @@
+/****************************************************************************
+ Copyright (c) 2019-present Axmol Engine contributors (see AUTHORS.md).
+
+ https://axmol.dev/
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ ****************************************************************************/
+
+#include <doctest.h>
+#include <atomic>
+#include <cinttypes>
+#include <cstring>
+#include <thread>
+#include "base/Utils.h"
+#include "network/Downloader.h"
+#include "platform/FileUtils.h"
+#include "yasio/xxsocket.hpp"
+#include "TestUtils.h"
+
+using namespace ax;
+using namespace ax::network;
+
+namespace
+{
+// serves one file over HTTP/1.1 on localhost, honoring single byte ranges
+class RangeFileServer
+{
+public:
+    RangeFileServer(std::string body, std::string etag) : _body(std::move(body)), _etag(std::move(etag))
+    {
+        _socket.open(AF_INET, SOCK_STREAM);
+        _socket.bind("127.0.0.1", 0);
+        _socket.listen();
+        _port   = _socket.local_endpoint().port();
+        _thread = std::thread([this] { serve(); });
+    }
+
+    ~RangeFileServer()
+    {
+        _stopped = true;
+        yasio::xxsocket wakeup;
+        wakeup.open(AF_INET, SOCK_STREAM);
+        wakeup.connect("127.0.0.1", _port);
+        _thread.join();
+    }
+
+    std::string url() const { return fmt::format("http://127.0.0.1:{}/file.bin", _port); }
+    int requests() const { return _requests; }
+
+private:
+    void serve()
+    {
+        while (!_stopped)
+        {
+            auto conn = _socket.accept();
+            if (_stopped || !conn.is_open())
+                break;
+
+            std::string request;
+            char buf[1024];
+            while (request.find("\r\n\r\n") == std::string::npos)
+            {
+                int n = conn.recv(buf, sizeof(buf));
+                if (n <= 0)
+                    break;
+                request.append(buf, n);
+            }
+            if (request.empty())
+                continue;
+            ++_requests;
+
+            int64_t first = 0, last = static_cast<int64_t>(_body.size()) - 1;
+            const auto range = request.find("Range: bytes=");
+            if (range != std::string::npos)
+            {
+                char* end = nullptr;
+                first     = strtoll(request.c_str() + range + 13, &end, 10);
+                if (end && *end == '-' && isdigit(end[1]))
+                    last = std::min(last, static_cast<int64_t>(strtoll(end + 1, nullptr, 10)));
+            }
+
+            auto response = fmt::format("HTTP/1.1 {}\r\nContent-Length: {}\r\nETag: {}\r\nConnection: close\r\n",
+                                        range != std::string::npos ? "206 Partial Content" : "200 OK",
+                                        last - first + 1, _etag);
+            if (range != std::string::npos)
+                response += fmt::format("Content-Range: bytes {}-{}/{}\r\n", first, last, _body.size());
+            response += "\r\n";
+            response.append(_body, first, last - first + 1);
+            conn.send(response.data(), static_cast<int>(response.size()));
+            conn.shutdown();
+        }
+    }
+
+    std::string _body;
+    std::string _etag;
+    yasio::xxsocket _socket;
+    unsigned short _port = 0;
+    std::atomic<bool> _stopped{false};
+    std::atomic<int> _requests{0};
+    std::thread _thread;
+};
+
+std::string makeBody(size_t size, unsigned seed)
+{
+    std::string body(size, '\0');
+    for (size_t i = 0; i < size; ++i)
+        body[i] = static_cast<char>((i * 31 + seed) % 251);
+    return body;
+}
+
+// returns DownloadTask::ERROR_NO_ERROR or the error the task failed with
+int download(const std::string& url, const std::string& storagePath, const std::string& checksum)
+{
+    DownloaderHints hints{6, 45, ".tmp"};
+    hints.countOfMaxSegmentsPerTask = 4;
+    hints.segmentSize               = 1024;
+    Downloader downloader(hints);
+
+    AsyncRunner<int> runner;
+    downloader.onFileTaskSuccess = [&runner](const DownloadTask&) { runner.finish(DownloadTask::ERROR_NO_ERROR); };
+    downloader.onTaskError       = [&runner](const DownloadTask&, int errorCode, int, std::string_view) {
+        runner.finish(errorCode);
+    };
+    downloader.createDownloadFileTask(url, storagePath, "", checksum);
+    return runner();
+}
+
+// the journal a segmented task leaves next to its temp file, see DownloadTaskCURL
+void writeJournal(const std::string& path,
+                  int64_t fileSize,
+                  std::string_view etag,
+                  const std::vector<std::string>& doneSegments,
+                  uint32_t segmentCount)
+{
+    std::string journal;
+    auto append = [&journal](const void* data, size_t size) { journal.append((const char*)data, size); };
+    const uint32_t magic       = 0x47535841u;
+    const int64_t segmentSize  = 1024;
+    append(&magic, sizeof(magic));
+    append(&segmentCount, sizeof(segmentCount));
+    append(&fileSize, sizeof(fileSize));
+    append(&segmentSize, sizeof(segmentSize));
+    journal += etag.empty() ? std::string(16, '\0') : utils::computeDigest(etag, "md5", false);
+    for (uint32_t i = 0; i < segmentCount; ++i)
+    {
+        const bool done = i < doneSegments.size();
+        journal += static_cast<char>(done ? 1 : 0);
+        journal += done ? utils::computeDigest(doneSegments[i], "md5", false) : std::string(16, '\0');
+    }
+    FileUtils::getInstance()->writeStringToFile(journal, path);
+}
+}  // namespace
+
+TEST_SUITE("network/Downloader")
+{
+    TEST_CASE("segmented_download")
+    {
+        auto fileUtils   = FileUtils::getInstance();
+        const auto dir   = fileUtils->getWritablePath() + "downloader_tests/";
+        const auto path  = dir + "file.bin";
+        fileUtils->removeDirectory(dir);
+        fileUtils->createDirectories(dir);
+
+        SUBCASE("fetches_every_range_once_and_skips_a_stored_file")
+        {
+            const auto body = makeBody(5000, 1);
+            RangeFileServer server(body, "\"v1\"");
+
+            REQUIRE_EQ(DownloadTask::ERROR_NO_ERROR, download(server.url(), path, utils::getStringMD5Hash(body)));
+            CHECK_EQ(body, fileUtils->getStringFromFile(path));
+            CHECK_FALSE(fileUtils->isFileExist(path + ".tmp.segments"));
+            CHECK_EQ(5, server.requests());
+
+            // already downloaded, nothing is fetched again
+            REQUIRE_EQ(DownloadTask::ERROR_NO_ERROR, download(server.url(), path, utils::getStringMD5Hash(body)));
+            CHECK_EQ(5, server.requests());
+            CHECK_EQ(body, fileUtils->getStringFromFile(path));
+        }
+
+        SUBCASE("restored_single_segment_is_rehashed")
+        {
+            const auto body = makeBody(600, 2);
+            RangeFileServer server(body, "\"v1\"");
+            fileUtils->writeStringToFile(body, path + ".tmp");
+            writeJournal(path + ".tmp.segments", body.size(), "\"v1\"", {body}, 1);
+
+            REQUIRE_EQ(DownloadTask::ERROR_NO_ERROR, download(server.url(), path, utils::getStringMD5Hash(body)));
+            CHECK_EQ(0, server.requests());
+            CHECK_EQ(body, fileUtils->getStringFromFile(path));
+        }
+
+        SUBCASE("changed_file_is_not_spliced")
+        {
+            const auto oldBody = makeBody(3000, 3);
+            const auto body    = makeBody(3000, 4);
+            RangeFileServer server(body, "\"v2\"");
+            fileUtils->writeStringToFile(oldBody, path + ".tmp");
+            writeJournal(path + ".tmp.segments", oldBody.size(), "\"v1\"", {oldBody.substr(0, 1024)}, 3);
+
+            CHECK_NE(DownloadTask::ERROR_NO_ERROR, download(server.url(), path, utils::getStringMD5Hash(body)));
+            CHECK_FALSE(fileUtils->isFileExist(path + ".tmp.segments"));
+            CHECK_FALSE(fileUtils->isFileExist(path));
+
+            // the next attempt starts over
+            REQUIRE_EQ(DownloadTask::ERROR_NO_ERROR, download(server.url(), path, utils::getStringMD5Hash(body)));
+            CHECK_EQ(body, fileUtils->getStringFromFile(path));
+        }
+
+        fileUtils->removeDirectory(dir);
+    }
+}
@@ -480,4 +480,58 @@ TEST_SUITE("platform/FileUtils") {
         CHECK(list[1] == path + "binary.bin");
         CHECK(list[2] == path + "hello.txt");
     }
+
+
+    TEST_CASE("mountArchive") {
+        // a zip archive with one stored entry "greeting.txt" containing "hello"
+        const std::string name = "greeting.txt";
+        const std::string content = "hello";
+        const uint32_t crc = 0x3610a686;
+
+        std::string zip;
+        auto put16 = [&](uint16_t v) { zip.push_back(char(v & 0xff)); zip.push_back(char(v >> 8)); };
+        auto put32 = [&](uint32_t v) { put16(uint16_t(v & 0xffff)); put16(uint16_t(v >> 16)); };
+
+        put32(0x04034b50); put16(20); put16(0); put16(0); put16(0); put16(0);
+        put32(crc); put32(5); put32(5); put16(uint16_t(name.size())); put16(0);
+        zip += name;
+        zip += content;
+
+        const auto centralDirOffset = uint32_t(zip.size());
+        put32(0x02014b50); put16(20); put16(20); put16(0); put16(0); put16(0); put16(0);
+        put32(crc); put32(5); put32(5); put16(uint16_t(name.size())); put16(0); put16(0);
+        put16(0); put16(0); put32(0); put32(0);
+        zip += name;
+        const auto centralDirSize = uint32_t(zip.size()) - centralDirOffset;
+
+        put32(0x06054b50); put16(0); put16(0); put16(1); put16(1);
+        put32(centralDirSize); put32(centralDirOffset); put16(0);
+
+        auto archivePath = fu->getWritablePath() + "mount-test.pak";
+        REQUIRE(fu->writeStringToFile(zip, archivePath));
+
+        REQUIRE(fu->mountArchive(archivePath, "packed"));
+        CHECK(not fu->mountArchive(fu->getWritablePath() + "doesnt_exist.pak"));
+
+        auto fullPath = fu->fullPathForFilename("packed/greeting.txt");
+        CHECK(fullPath == archivePath + "/greeting.txt");
+        CHECK(fu->isFileExist("packed/greeting.txt"));
+        CHECK(fu->isFileExist(fullPath));
+        CHECK(not fu->isFileExist("packed/missing.txt"));
+        CHECK(fu->getFileSize(fullPath) == 5);
+        CHECK(fu->getStringFromFile("packed/greeting.txt") == content);
+
+        auto stream = fu->openFileStream(fullPath, IFileStream::Mode::READ);
+        REQUIRE(stream);
+        char buf[8] = {};
+        CHECK(stream->seek(1, SEEK_SET) == 1);
+        CHECK(stream->read(buf, sizeof(buf)) == 4);
+        CHECK(std::string_view{buf, 4} == "ello");
+
+        REQUIRE(fu->unmountArchive(archivePath));
+        CHECK(not fu->unmountArchive(archivePath));
+        CHECK(not fu->isFileExist("packed/greeting.txt"));
+
+        REQUIRE(fu->removeFile(archivePath));
+    }
 }
@@ -0,0 +1,96 @@
+/****************************************************************************
+ Copyright (c) 2019-present Axmol Engine contributors (see AUTHORS.md).
+
+ https://axmol.dev/
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ ****************************************************************************/
+
+#include <doctest.h>
+#include "base/Director.h"
+#include "TestUtils.h"
+
+#if defined(AX_USE_GL) && AX_GLES_PROFILE != 200
+#    include "renderer/backend/opengl/OpenGLState.h"
+
+using namespace ax;
+using namespace ax::backend;
+
+namespace
+{
+GLuint boundUniformBuffer()
+{
+    GLint handle = 0;
+    glGetIntegerv(GL_UNIFORM_BUFFER_BINDING, &handle);
+    return static_cast<GLuint>(handle);
+}
+}  // namespace
+
+TEST_SUITE("renderer/OpenGLState")
+{
+    TEST_CASE("uniform_block_binds_keep_buffer_cache_truthful")
+    {
+        if (!ensureGLView())
+        {
+            MESSAGE("no GL view can be created, skipped");
+            return;
+        }
+
+        GLuint buffers[2] = {0, 0};
+        glGenBuffers(2, buffers);
+        const auto ring = buffers[0];
+        const auto ubo  = buffers[1];
+        glBufferData(__gl->bindBuffer(BufferType::UNIFORM, ubo), 64, nullptr, GL_DYNAMIC_DRAW);
+        glBufferData(__gl->bindBuffer(BufferType::UNIFORM, ring), 256, nullptr, GL_STREAM_DRAW);
+        REQUIRE_EQ(ring, boundUniformBuffer());
+
+        SUBCASE("bind_base")
+        {
+            // the ring overflow fallback binds the program's own block buffer
+            __gl->bindUniformBufferBase(0, ubo);
+            CHECK_EQ(ubo, boundUniformBuffer());
+
+            // the next ring upload must not write into the block buffer
+            __gl->bindBuffer(BufferType::UNIFORM, ring);
+            CHECK_EQ(ring, boundUniformBuffer());
+        }
+
+        SUBCASE("bind_range")
+        {
+            __gl->bindBuffer(BufferType::UNIFORM, ubo);
+            __gl->bindUniformBufferRange(0, ring, 0, 64);
+            CHECK_EQ(ring, boundUniformBuffer());
+
+            __gl->bindBuffer(BufferType::UNIFORM, ubo);
+            CHECK_EQ(ubo, boundUniformBuffer());
+
+            // a range bind in between must not let a base bind of the same pair be skipped
+            __gl->bindUniformBufferBase(0, ubo);
+            __gl->bindUniformBufferRange(0, ring, 0, 64);
+            __gl->bindUniformBufferBase(0, ubo);
+            GLint indexed = 0;
+            glGetIntegeri_v(GL_UNIFORM_BUFFER_BINDING, 0, &indexed);
+            CHECK_EQ(ubo, static_cast<GLuint>(indexed));
+        }
+
+        __gl->deleteBuffer(BufferType::UNIFORM, ring);
+        __gl->deleteBuffer(BufferType::UNIFORM, ubo);
+    }
+}
+#endif
@@ -0,0 +1,183 @@
+/****************************************************************************
+ Copyright (c) 2019-present Axmol Engine contributors (see AUTHORS.md).
+
+ https://axmol.dev/
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ ****************************************************************************/
+
+#include <doctest.h>
+#include <cstdlib>
+#include <vector>
+#include "renderer/backend/PixelFormatUtils.h"
+
+using namespace ax;
+using namespace ax::backend;
+
+namespace
+{
+const PixelFormat FORMATS[] = {PixelFormat::R8,     PixelFormat::RG8,   PixelFormat::RGB8,   PixelFormat::RGBA8,
+                               PixelFormat::RGB565, PixelFormat::RGBA4, PixelFormat::RGB5A1, PixelFormat::BGRA8};
+
+// whole SIMD blocks for every kernel, plus tails of each length
+const size_t PIXEL_COUNTS[] = {0, 1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 33, 63, 64, 65, 257, 1023};
+
+size_t bytesPerPixel(PixelFormat format)
+{
+    return PixelFormatUtils::getBitsPerPixel(format) / 8;
+}
+
+std::vector<uint8_t> makePixels(size_t count, PixelFormat format, unsigned seed)
+{
+    std::vector<uint8_t> pixels(count * bytesPerPixel(format));
+    uint32_t state = seed * 2654435761u + 1;
+    for (auto& byte : pixels)
+    {
+        state = state * 1664525u + 1013904223u;
+        byte  = static_cast<uint8_t>(state >> 24);
+    }
+    // full range alpha and channel extremes in the first pixels
+    for (size_t i = 0; i < std::min<size_t>(pixels.size(), 8); ++i)
+        pixels[i] = (i & 1) ? 0xFF : 0x00;
+    return pixels;
+}
+
+// converted is false when the library doesn't convert the pair
+std::vector<uint8_t> convert(const std::vector<uint8_t>& pixels, PixelFormat from, PixelFormat to, bool* converted)
+{
+    unsigned char* out = nullptr;
+    size_t outLen      = 0;
+    auto result        = PixelFormatUtils::convertDataToFormat(pixels.data(), pixels.size(), from, to, &out, &outLen);
+    *converted         = result == to && out != nullptr && out != pixels.data();
+    std::vector<uint8_t> bytes;
+    if (*converted)
+    {
+        bytes.assign(out, out + outLen);
+        free(out);
+    }
+    return bytes;
+}
+
+uint16_t read16(const std::vector<uint8_t>& bytes, size_t pixel)
+{
+    uint16_t value;
+    memcpy(&value, bytes.data() + pixel * 2, sizeof(value));
+    return value;
+}
+}  // namespace
+
+TEST_SUITE("renderer/PixelFormatUtils")
+{
+    // a single pixel never reaches a SIMD block, converting pixel by pixel gives the scalar result
+    TEST_CASE("simd_matches_scalar_for_every_pair")
+    {
+        for (auto from : FORMATS)
+        {
+            for (auto to : FORMATS)
+            {
+                if (from == to)
+                    continue;
+
+                for (auto count : PIXEL_COUNTS)
+                {
+                    CAPTURE(PixelFormatUtils::getFormatDescriptor(from).name);
+                    CAPTURE(PixelFormatUtils::getFormatDescriptor(to).name);
+                    CAPTURE(count);
+
+                    const auto pixels = makePixels(count, from, static_cast<unsigned>(count));
+                    bool converted    = false;
+                    const auto whole  = convert(pixels, from, to, &converted);
+                    if (!converted)
+                    {
+                        // only an empty buffer may come back unconverted from a supported pair
+                        if (count > 0)
+                            break;
+                        continue;
+                    }
+
+                    std::vector<uint8_t> scalar;
+                    const auto stride = bytesPerPixel(from);
+                    for (size_t i = 0; i < count; ++i)
+                    {
+                        std::vector<uint8_t> pixel(pixels.begin() + i * stride, pixels.begin() + (i + 1) * stride);
+                        bool pixelConverted = false;
+                        const auto out      = convert(pixel, from, to, &pixelConverted);
+                        REQUIRE(pixelConverted);
+                        scalar.insert(scalar.end(), out.begin(), out.end());
+                    }
+                    REQUIRE_EQ(count * bytesPerPixel(to), whole.size());
+                    CHECK(whole == scalar);
+                }
+            }
+        }
+    }
+
+    TEST_CASE("simd_kernels_match_the_formulas")
+    {
+        for (auto count : PIXEL_COUNTS)
+        {
+            CAPTURE(count);
+            const auto rgba = makePixels(count, PixelFormat::RGBA8, static_cast<unsigned>(count) + 100);
+            bool converted  = false;
+
+            const auto rgb565 = convert(rgba, PixelFormat::RGBA8, PixelFormat::RGB565, &converted);
+            for (size_t i = 0; converted && i < count; ++i)
+            {
+                const uint8_t* p = &rgba[i * 4];
+                CHECK_EQ(((p[0] & 0xF8) << 8 | (p[1] & 0xFC) << 3 | (p[2] & 0xF8) >> 3), read16(rgb565, i));
+            }
+
+            const auto rgba4 = convert(rgba, PixelFormat::RGBA8, PixelFormat::RGBA4, &converted);
+            for (size_t i = 0; converted && i < count; ++i)
+            {
+                const uint8_t* p = &rgba[i * 4];
+                CHECK_EQ(((p[0] & 0xF0) << 8 | (p[1] & 0xF0) << 4 | (p[2] & 0xF0) | (p[3] & 0xF0) >> 4),
+                         read16(rgba4, i));
+            }
+
+            const auto swapped = convert(rgba, PixelFormat::BGRA8, PixelFormat::RGBA8, &converted);
+            for (size_t i = 0; converted && i < count; ++i)
+            {
+                const uint8_t* p = &rgba[i * 4];
+                const uint8_t* q = &swapped[i * 4];
+                CHECK((q[0] == p[2] && q[1] == p[1] && q[2] == p[0] && q[3] == p[3]));
+            }
+
+            auto premultiplied = rgba;
+            PixelFormatUtils::premultiplyAlphaRGBA8(premultiplied.data(), count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                const uint8_t* p = &rgba[i * 4];
+                const uint8_t* q = &premultiplied[i * 4];
+                for (int c = 0; c < 3; ++c)
+                    CHECK_EQ((p[c] * (p[3] + 1u)) >> 8, q[c]);
+                CHECK_EQ(p[3], q[3]);
+            }
+
+            const auto rg = makePixels(count, PixelFormat::RG8, static_cast<unsigned>(count) + 200);
+            auto premultipliedRG = rg;
+            PixelFormatUtils::premultiplyAlphaRG8(premultipliedRG.data(), count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                CHECK_EQ((rg[i * 2] * rg[i * 2 + 1] + 1u) >> 8, premultipliedRG[i * 2]);
+                CHECK_EQ(rg[i * 2 + 1], premultipliedRG[i * 2 + 1]);
+            }
+        }
+    }
+}
@@ -0,0 +1,205 @@
+/****************************************************************************
+ Copyright (c) 2019-present Axmol Engine contributors (see AUTHORS.md).
+
+ https://axmol.dev/
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ ****************************************************************************/
+
+#include <doctest.h>
+#include <cstring>
+#include "platform/FileUtils.h"
+#include "DragonBones/CCDragonBonesHeaders.h"
+
+using namespace ax;
+using namespace dragonBones;
+
+namespace
+{
+const char* HERO_JSON = R"({
+    "frameRate": 24, "name": "hero", "version": "5.5", "compatibleVersion": "5.5",
+    "armature": [{
+        "type": "Armature", "frameRate": 24, "name": "hero",
+        "bone": [{"name": "root"}, {"name": "arm", "parent": "root", "transform": {"x": 10}}],
+        "slot": [{"name": "body", "parent": "root"}],
+        "skin": [{"slot": [{"name": "body", "display": [{
+            "type": "mesh", "name": "body",
+            "vertices": [0, 0, 10, 0, 0, 10], "uvs": [0, 0, 1, 0, 0, 1], "triangles": [0, 1, 2]
+        }]}]}],
+        "animation": [{
+            "duration": 10, "playTimes": 0, "name": "walk",
+            "frame": [{"duration": 5}, {"duration": 5, "events": [{"name": "step", "ints": [3]}]}],
+            "bone": [{"name": "arm", "translateFrame": [{"duration": 10, "tweenEasing": 0, "x": 5}, {"duration": 0, "x": 15}]}],
+            "slot": [{"name": "body", "colorFrame": [{"duration": 10, "tweenEasing": 0}, {"duration": 0, "value": {"aM": 50}}]}]
+        }],
+        "defaultActions": [{"gotoAndPlay": "walk"}]
+    }]
+})";
+
+void checkSameTimelines(const std::vector<TimelineData*>* expected, const std::vector<TimelineData*>* actual)
+{
+    REQUIRE(expected != nullptr);
+    REQUIRE(actual != nullptr);
+    REQUIRE_EQ(expected->size(), actual->size());
+    for (std::size_t i = 0; i < expected->size(); ++i)
+    {
+        CHECK_EQ((*expected)[i]->type, (*actual)[i]->type);
+        CHECK_EQ((*expected)[i]->offset, (*actual)[i]->offset);
+        CHECK_EQ((*expected)[i]->frameIndicesOffset, (*actual)[i]->frameIndicesOffset);
+    }
+}
+
+std::vector<std::string> listConvertedFiles(std::string_view dir)
+{
+    std::vector<std::string> files;
+    for (const auto& file : FileUtils::getInstance()->listFiles(dir))
+    {
+        if (file.ends_with(".dbbin"))
+            files.push_back(file);
+    }
+    return files;
+}
+}  // namespace
+
+TEST_SUITE("DragonBones/CCFactory")
+{
+    TEST_CASE("binary_conversion_matches_json")
+    {
+        JSONDataParser jsonParser;
+        const auto jsonData = jsonParser.parseDragonBonesData(HERO_JSON);
+        REQUIRE(jsonData != nullptr);
+
+        std::string binary;
+        REQUIRE(jsonParser.writeBinaryData(HERO_JSON, *jsonData, binary));
+        REQUIRE(binary.size() > 12);
+        CHECK_EQ(0, memcmp(binary.data(), "DBDT", 4));
+
+        // the parsed data owns and deletes its binary
+        const auto binaryCopy = new char[binary.size()];
+        memcpy(binaryCopy, binary.data(), binary.size());
+        BinaryDataParser binaryParser;
+        const auto binaryData = binaryParser.parseDragonBonesData(binaryCopy);
+        REQUIRE(binaryData != nullptr);
+
+        const auto jsonArmature   = jsonData->getArmature("hero");
+        const auto binaryArmature = binaryData->getArmature("hero");
+        REQUIRE(jsonArmature != nullptr);
+        REQUIRE(binaryArmature != nullptr);
+
+        SUBCASE("animations")
+        {
+            const auto jsonAnimation   = jsonArmature->getAnimation("walk");
+            const auto binaryAnimation = binaryArmature->getAnimation("walk");
+            REQUIRE(jsonAnimation != nullptr);
+            REQUIRE(binaryAnimation != nullptr);
+            CHECK_EQ(jsonAnimation->frameCount, binaryAnimation->frameCount);
+            CHECK_EQ(jsonAnimation->playTimes, binaryAnimation->playTimes);
+            CHECK_EQ(jsonAnimation->frameIntOffset, binaryAnimation->frameIntOffset);
+            CHECK_EQ(jsonAnimation->frameFloatOffset, binaryAnimation->frameFloatOffset);
+            CHECK_EQ(jsonAnimation->frameOffset, binaryAnimation->frameOffset);
+            checkSameTimelines(jsonAnimation->getBoneTimelines("arm"), binaryAnimation->getBoneTimelines("arm"));
+            checkSameTimelines(jsonAnimation->getSlotTimelines("body"), binaryAnimation->getSlotTimelines("body"));
+
+            REQUIRE(jsonAnimation->actionTimeline != nullptr);
+            REQUIRE(binaryAnimation->actionTimeline != nullptr);
+            CHECK_EQ(jsonAnimation->actionTimeline->offset, binaryAnimation->actionTimeline->offset);
+            CHECK_EQ(jsonData->frameIndices, binaryData->frameIndices);
+
+            // the translate frames ended up in the binary arrays
+            const auto timeline = (*binaryAnimation->getBoneTimelines("arm"))[0];
+            const auto valueOffset =
+                binaryAnimation->frameFloatOffset +
+                binaryData->timelineArray[timeline->offset + (unsigned)BinaryOffset::TimelineFrameValueOffset];
+            CHECK_EQ(5.0f, binaryData->frameFloatArray[valueOffset]);
+        }
+
+        SUBCASE("actions")
+        {
+            REQUIRE_EQ(1, binaryArmature->actions.size());
+            const auto action = binaryArmature->actions[0];
+            CHECK_EQ(ActionType::Frame, action->type);
+            CHECK_EQ("step", action->name);
+            REQUIRE(action->data != nullptr);
+            CHECK_EQ(std::vector<int>{3}, action->data->ints);
+
+            REQUIRE_EQ(1, binaryArmature->defaultActions.size());
+            CHECK_EQ(binaryArmature->getAnimation("walk"), binaryArmature->defaultAnimation);
+        }
+
+        SUBCASE("meshes")
+        {
+            const auto jsonMesh   = jsonArmature->getMesh("default", "body", "body");
+            const auto binaryMesh = binaryArmature->getMesh("default", "body", "body");
+            REQUIRE(jsonMesh != nullptr);
+            REQUIRE(binaryMesh != nullptr);
+            CHECK_EQ(jsonMesh->vertices.offset, binaryMesh->vertices.offset);
+            const auto offset = binaryMesh->vertices.offset;
+            CHECK_EQ(3, binaryData->intArray[offset + (unsigned)BinaryOffset::MeshVertexCount]);
+            CHECK_EQ(1, binaryData->intArray[offset + (unsigned)BinaryOffset::MeshTriangleCount]);
+            const auto floatOffset = binaryData->intArray[offset + (unsigned)BinaryOffset::MeshFloatOffset];
+            CHECK_EQ(10.0f, binaryData->floatArray[floatOffset + 2]);
+        }
+
+        jsonData->returnToPool();
+        binaryData->returnToPool();
+    }
+
+    TEST_CASE("json_is_converted_once")
+    {
+        auto fileUtils          = FileUtils::getInstance();
+        const auto dir          = fileUtils->getWritablePath() + "dragonbones_json/";
+        const auto convertedDir = fileUtils->getWritablePath() + "dragonbones/";
+        fileUtils->removeDirectory(convertedDir);
+        fileUtils->createDirectories(dir);
+        fileUtils->writeStringToFile(HERO_JSON, dir + "hero_ske.json");
+
+        {
+            CCFactory factory;
+            const auto data = factory.loadDragonBonesData(dir + "hero_ske.json", "hero");
+            REQUIRE(data != nullptr);
+            CHECK(data->mappedBinary == nullptr);
+        }
+        CHECK_EQ(1, listConvertedFiles(convertedDir).size());
+
+        {
+            CCFactory factory;
+            const auto data = factory.loadDragonBonesData(dir + "hero_ske.json", "hero");
+            REQUIRE(data != nullptr);
+            CHECK(data->mappedBinary != nullptr);
+            CHECK(data->getArmature("hero")->getAnimation("walk") != nullptr);
+        }
+
+        SUBCASE("edited_json_is_converted_again")
+        {
+            std::string edited = HERO_JSON;
+            edited.replace(edited.find("\"walk\""), 6, "\"run\"");
+            fileUtils->writeStringToFile(edited, dir + "hero_ske.json");
+
+            CCFactory factory;
+            const auto data = factory.loadDragonBonesData(dir + "hero_ske.json", "hero");
+            REQUIRE(data != nullptr);
+            CHECK(data->mappedBinary == nullptr);
+            CHECK(data->getArmature("hero")->getAnimation("run") != nullptr);
+            CHECK_EQ(2, listConvertedFiles(convertedDir).size());
+        }
+
+        fileUtils->removeDirectory(dir);
+        fileUtils->removeDirectory(convertedDir);
+    }
+}
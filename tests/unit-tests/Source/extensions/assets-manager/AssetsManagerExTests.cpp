@@ -0,0 +1,294 @@
+/****************************************************************************
+ Copyright (c) 2019-present Axmol Engine contributors (see AUTHORS.md).
+
+ https://axmol.dev/
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ ****************************************************************************/
+
+#include <doctest.h>
+#include "base/Data.h"
+#include "base/ZipUtils.h"
+#include "platform/FileUtils.h"
+#include "assets-manager/AssetsManagerEx.h"
+
+using namespace ax;
+using namespace ax::extension;
+
+namespace
+{
+// builds patches in the format described by ManifestAssetPatch
+class PatchWriter
+{
+public:
+    PatchWriter(uint64_t targetSize, uint64_t baseSize)
+    {
+        _bytes = "AXDP";
+        put(uint32_t{1});
+        put(targetSize);
+        put(baseSize);
+    }
+
+    PatchWriter& copy(uint64_t offset, uint32_t length)
+    {
+        put(uint8_t{0});
+        put(offset);
+        put(length);
+        return *this;
+    }
+
+    PatchWriter& insert(std::string_view literal)
+    {
+        put(uint8_t{1});
+        put(static_cast<uint32_t>(literal.size()));
+        _bytes += literal;
+        return *this;
+    }
+
+    Data data(bool gzip = false) const
+    {
+        Data data;
+        if (gzip)
+        {
+            auto compressed = ZipUtils::compressGZ(_bytes.data(), _bytes.size());
+            data.copy(compressed.data(), static_cast<ssize_t>(compressed.size()));
+        }
+        else
+            data.copy(reinterpret_cast<const unsigned char*>(_bytes.data()), static_cast<ssize_t>(_bytes.size()));
+        return data;
+    }
+
+private:
+    template <typename T>
+    void put(T value)
+    {
+        _bytes.append(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    std::string _bytes;
+};
+
+Data makeData(std::string_view text)
+{
+    Data data;
+    data.copy(reinterpret_cast<const unsigned char*>(text.data()), static_cast<ssize_t>(text.size()));
+    return data;
+}
+
+std::string toString(const Data& data)
+{
+    return std::string(reinterpret_cast<const char*>(data.getBytes()), static_cast<size_t>(data.getSize()));
+}
+
+uint32_t crc32Of(std::string_view data)
+{
+    uint32_t crc = 0xFFFFFFFFu;
+    for (unsigned char c : data)
+    {
+        crc ^= c;
+        for (int k = 0; k < 8; ++k)
+            crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+    }
+    return ~crc;
+}
+
+// writes a zip archive with stored (uncompressed) entries, names ending with '/' are directories
+class ZipWriter
+{
+public:
+    void add(std::string_view name, std::string_view content, bool badCrc = false)
+    {
+        const uint32_t crc    = crc32Of(content) ^ (badCrc ? 1u : 0u);
+        const uint32_t offset = static_cast<uint32_t>(_local.size());
+        putHeader(_local, 0x04034b50u, crc, content.size(), name.size());
+        _local += name;
+        _local += content;
+
+        std::string central;
+        put(central, uint32_t{0x02014b50u});
+        put(central, uint16_t{20});
+        putHeader(central, 0, crc, content.size(), name.size());
+        put(central, uint16_t{0});  // comment
+        put(central, uint16_t{0});  // disk
+        put(central, uint16_t{0});  // internal attributes
+        put(central, uint32_t{0});  // external attributes
+        put(central, offset);
+        central += name;
+        _central += central;
+        ++_count;
+    }
+
+    void save(const std::string& path) const
+    {
+        std::string zip = _local + _central;
+        put(zip, uint32_t{0x06054b50u});
+        put(zip, uint16_t{0});
+        put(zip, uint16_t{0});
+        put(zip, _count);
+        put(zip, _count);
+        put(zip, static_cast<uint32_t>(_central.size()));
+        put(zip, static_cast<uint32_t>(_local.size()));
+        put(zip, uint16_t{0});
+        FileUtils::getInstance()->writeStringToFile(zip, path);
+    }
+
+private:
+    template <typename T>
+    static void put(std::string& out, T value)
+    {
+        out.append(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    // the fields local and central headers share, from the version needed on
+    static void putHeader(std::string& out, uint32_t signature, uint32_t crc, size_t size, size_t nameLength)
+    {
+        if (signature)
+            put(out, signature);
+        put(out, uint16_t{20});    // version needed
+        put(out, uint16_t{0});     // flags
+        put(out, uint16_t{0});     // stored
+        put(out, uint16_t{0});     // time
+        put(out, uint16_t{0x21});  // date, 1980-01-01
+        put(out, crc);
+        put(out, static_cast<uint32_t>(size));
+        put(out, static_cast<uint32_t>(size));
+        put(out, static_cast<uint16_t>(nameLength));
+        put(out, uint16_t{0});  // extra
+    }
+
+    std::string _local;
+    std::string _central;
+    uint16_t _count = 0;
+};
+
+class TestAssetsManagerEx : public AssetsManagerEx
+{
+public:
+    using AssetsManagerEx::AssetsManagerEx;
+    using AssetsManagerEx::decompress;
+};
+}  // namespace
+
+TEST_SUITE("assets-manager/AssetsManagerEx")
+{
+    TEST_CASE("apply_patch")
+    {
+        const auto base = makeData("Hello old world");
+        Data output;
+
+        SUBCASE("copies_and_inserts")
+        {
+            auto patch = PatchWriter(15, 15).copy(0, 6).insert("new").copy(9, 6).data();
+            REQUIRE(AssetsManagerEx::applyPatch(base, patch, output, 15));
+            CHECK_EQ("Hello new world", toString(output));
+        }
+
+        SUBCASE("gzip_compressed")
+        {
+            auto patch = PatchWriter(11, 15).insert("Hello").copy(9, 6).data(true);
+            REQUIRE(AssetsManagerEx::applyPatch(base, patch, output, 11));
+            CHECK_EQ("Hello world", toString(output));
+        }
+
+        SUBCASE("empty_target")
+        {
+            REQUIRE(AssetsManagerEx::applyPatch(base, PatchWriter(0, 15).data(), output, 0));
+            CHECK_EQ(0, output.getSize());
+        }
+
+        SUBCASE("target_larger_than_the_asset")
+        {
+            // a hostile header must not drive the allocation
+            auto patch = PatchWriter(uint64_t{1} << 40, 15).insert("x").data();
+            CHECK_FALSE(AssetsManagerEx::applyPatch(base, patch, output, 1024));
+            CHECK_FALSE(AssetsManagerEx::applyPatch(base, PatchWriter(16, 15).copy(0, 15).insert("!").data(),
+                                                    output, 15));
+        }
+
+        SUBCASE("different_base")
+        {
+            CHECK_FALSE(AssetsManagerEx::applyPatch(base, PatchWriter(5, 14).copy(0, 5).data(), output, 5));
+        }
+
+        SUBCASE("malformed")
+        {
+            // copy past the end of the base
+            CHECK_FALSE(AssetsManagerEx::applyPatch(base, PatchWriter(5, 15).copy(12, 5).data(), output, 5));
+            // more bytes than the target holds
+            CHECK_FALSE(AssetsManagerEx::applyPatch(base, PatchWriter(5, 15).insert("toolong").data(), output, 5));
+            // truncated before the target is complete
+            CHECK_FALSE(AssetsManagerEx::applyPatch(base, PatchWriter(10, 15).copy(0, 5).data(), output, 10));
+            // unknown instruction
+            auto patch = PatchWriter(5, 15).data();
+            const uint8_t op = 7;
+            Data bad;
+            bad.resize(patch.getSize() + 1);
+            memcpy(bad.getBytes(), patch.getBytes(), patch.getSize());
+            bad.getBytes()[patch.getSize()] = op;
+            CHECK_FALSE(AssetsManagerEx::applyPatch(base, bad, output, 5));
+            // not a patch
+            CHECK_FALSE(AssetsManagerEx::applyPatch(base, makeData("AXDQ"), output, 5));
+        }
+    }
+
+    TEST_CASE("decompress")
+    {
+        auto fileUtils   = FileUtils::getInstance();
+        const auto dir   = fileUtils->getWritablePath() + "assets_manager_tests/";
+        fileUtils->removeDirectory(dir);
+        fileUtils->createDirectories(dir);
+
+        auto manager = new TestAssetsManagerEx(dir + "missing.manifest", dir + "storage/");
+
+        std::vector<std::pair<std::string, std::string>> files;
+        for (int i = 0; i < 24; ++i)
+        {
+            std::string content(static_cast<size_t>(i * 997 + (i % 3) * 20000), '\0');
+            for (size_t k = 0; k < content.size(); ++k)
+                content[k] = static_cast<char>('a' + (k * 7 + i) % 26);
+            files.emplace_back(fmt::format("pack/{}/file{}.txt", i % 4, i), std::move(content));
+        }
+
+        SUBCASE("extracts_every_entry")
+        {
+            ZipWriter zip;
+            zip.add("pack/", "");
+            for (auto&& file : files)
+                zip.add(file.first, file.second);
+            zip.save(dir + "update.zip");
+
+            REQUIRE(manager->decompress(dir + "update.zip"));
+            for (auto&& file : files)
+                CHECK_EQ(file.second, fileUtils->getStringFromFile(dir + file.first));
+        }
+
+        SUBCASE("fails_on_a_corrupt_entry")
+        {
+            ZipWriter zip;
+            for (size_t i = 0; i < files.size(); ++i)
+                zip.add(files[i].first, files[i].second, i == 5);
+            zip.save(dir + "update.zip");
+
+            CHECK_FALSE(manager->decompress(dir + "update.zip"));
+        }
+
+        manager->release();
+        fileUtils->removeDirectory(dir);
+    }
+}
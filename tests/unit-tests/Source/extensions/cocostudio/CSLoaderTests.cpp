@@ -0,0 +1,119 @@
+/****************************************************************************
+ Copyright (c) 2019-present Axmol Engine contributors (see AUTHORS.md).
+
+ https://axmol.dev/
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ ****************************************************************************/
+
+#include <doctest.h>
+#include "TestUtils.h"
+#include "base/RefPtr.h"
+#include "platform/FileUtils.h"
+#include "cocostudio/ActionTimeline/CSLoader.h"
+#include "cocostudio/FlatBuffersSerialize.h"
+
+using namespace ax;
+
+namespace
+{
+// a panel holding nested nodes and texts, with transforms and flags that the readers apply
+const char* PROTOTYPE_CSD = R"(<GameFile>
+<PropertyGroup Name="PrototypeTree" Type="Node" Version="3.10.0.0" />
+<Content ctype="GameProjectContent">
+<Content>
+<ObjectData Name="PrototypeTree" ctype="GameNodeObjectData">
+  <Size X="300" Y="200" />
+  <Children>
+    <AbstractNodeData Name="panel" Tag="1" ctype="PanelObjectData">
+      <Size X="200" Y="100" /><Position X="10" Y="20" /><Scale ScaleX="1.5" ScaleY="0.5" />
+      <Children>
+        <AbstractNodeData Name="group" Tag="2" RotationSkewX="30" RotationSkewY="30" ctype="SingleNodeObjectData">
+          <Position X="40" Y="50" />
+          <Children>
+            <AbstractNodeData Name="label" Tag="3" ctype="TextObjectData" LabelText="first" FontSize="12">
+              <Size X="60" Y="20" /><Position X="1" Y="2" />
+            </AbstractNodeData>
+            <AbstractNodeData Name="hidden" Tag="4" VisibleForFrame="False" ctype="SingleNodeObjectData">
+              <Position X="3" Y="4" />
+            </AbstractNodeData>
+          </Children>
+        </AbstractNodeData>
+        <AbstractNodeData Name="label" Tag="5" ctype="TextObjectData" LabelText="second" FontSize="14">
+          <Size X="80" Y="20" /><Position X="100" Y="10" />
+        </AbstractNodeData>
+      </Children>
+    </AbstractNodeData>
+    <AbstractNodeData Name="sibling" Tag="6" ctype="SingleNodeObjectData">
+      <Position X="250" Y="150" />
+    </AbstractNodeData>
+  </Children>
+</ObjectData>
+</Content>
+</Content>
+</GameFile>)";
+
+void checkSameTree(Node* expected, Node* actual)
+{
+    REQUIRE(expected != nullptr);
+    REQUIRE(actual != nullptr);
+    CHECK_EQ(typeid(*expected).name(), typeid(*actual).name());
+    CHECK_EQ(expected->getName(), actual->getName());
+    CHECK_EQ(expected->getTag(), actual->getTag());
+    CHECK_EQ(expected->getPosition(), actual->getPosition());
+    CHECK_EQ(expected->getContentSize(), actual->getContentSize());
+    CHECK_EQ(expected->getScaleX(), actual->getScaleX());
+    CHECK_EQ(expected->getScaleY(), actual->getScaleY());
+    CHECK_EQ(expected->getRotationSkewX(), actual->getRotationSkewX());
+    CHECK_EQ(expected->getRotationSkewY(), actual->getRotationSkewY());
+    CHECK_EQ(expected->isVisible(), actual->isVisible());
+
+    auto& expectedChildren = expected->getChildren();
+    auto& actualChildren   = actual->getChildren();
+    REQUIRE_EQ(expectedChildren.size(), actualChildren.size());
+    for (ssize_t i = 0; i < expectedChildren.size(); ++i)
+        checkSameTree(expectedChildren.at(i), actualChildren.at(i));
+}
+}  // namespace
+
+TEST_SUITE("cocostudio/CSLoader") {
+    TEST_CASE("createNodeFromPrototype") {
+        auto csbPath = FileUtils::getInstance()->getWritablePath() + "CSLoaderPrototypeTree.csb";
+        std::string csd = PROTOTYPE_CSD;
+        cocostudio::FlatBuffersSerialize::getInstance()->serializeFlatBuffersWithXMLBuffer(csd, csbPath);
+
+        RefPtr<Node> expected = CSLoader::createNode(csbPath);
+        RefPtr<Node> first    = CSLoader::createNodeFromPrototype(csbPath);
+        RefPtr<Node> second   = CSLoader::createNodeFromPrototype(csbPath);
+
+        SUBCASE("same tree as createNode") {
+            checkSameTree(expected, first);
+        }
+
+        SUBCASE("instances from the cached prototype are independent") {
+            checkSameTree(expected, second);
+            CHECK_NE(first.get(), second.get());
+            first->getChildByName("panel")->setPosition(0.0f, 0.0f);
+            CHECK_EQ(Vec2(10.0f, 20.0f), second->getChildByName("panel")->getPosition());
+        }
+
+        CSLoader::getInstance()->removePrototype(csbPath);
+        FileUtils::getInstance()->removeFile(csbPath);
+    }
+}
@@ -0,0 +1,109 @@
+/****************************************************************************
+ Copyright (c) 2019-present Axmol Engine contributors (see AUTHORS.md).
+
+ https://axmol.dev/
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ ****************************************************************************/
+
+#include <doctest.h>
+#include "lua-bindings/manual/LuaStack.h"
+#include "platform/FileUtils.h"
+
+using namespace ax;
+
+namespace
+{
+void writePackU32(std::string& out, uint32_t value)
+{
+    for (int i = 0; i < 4; ++i)
+        out += static_cast<char>((value >> (i * 8)) & 0xff);
+}
+
+// a one-entry pack whose chunk doesn't compile, the layout matches LuaStack::writeChunkPack
+std::string makeBrokenPack(std::string_view name, std::string_view chunk)
+{
+    std::string pack{"AXLP"};
+    writePackU32(pack, 1);
+    writePackU32(pack, 1);
+    const uint32_t nameOffset = 12 + 16;
+    writePackU32(pack, nameOffset);
+    writePackU32(pack, static_cast<uint32_t>(name.size()));
+    writePackU32(pack, nameOffset + static_cast<uint32_t>(name.size()));
+    writePackU32(pack, static_cast<uint32_t>(chunk.size()));
+    pack += name;
+    pack += chunk;
+    return pack;
+}
+
+std::string packTestValue(lua_State* L)
+{
+    lua_getglobal(L, "packTestValue");
+    std::string value = lua_isstring(L, -1) ? lua_tostring(L, -1) : "";
+    lua_pop(L, 1);
+    return value;
+}
+}  // namespace
+
+TEST_SUITE("lua/LuaStack")
+{
+    TEST_CASE("chunk packs")
+    {
+        auto fileUtils   = FileUtils::getInstance();
+        auto root        = fileUtils->getWritablePath() + "luapack_test/";
+        auto searchPaths = fileUtils->getSearchPaths();
+        fileUtils->removeDirectory(root);
+        REQUIRE(fileUtils->createDirectories(root + "src/app/"));
+        fileUtils->writeStringToFile("packTestValue = 'main'", root + "src/main.lua");
+        fileUtils->writeStringToFile("packTestValue = 'file'", root + "broken.lua");
+        fileUtils->addSearchPath(root, true);
+
+        auto stack = LuaStack::create();
+        auto L     = stack->getLuaState();
+        REQUIRE(stack->writeChunkPack(root + "src/", root + "main.pack"));
+        REQUIRE(stack->loadChunksFromPack((root + "main.pack").c_str()) == 1);
+        const int top = lua_gettop(L);
+
+        SUBCASE("exact module names run from the pack")
+        {
+            stack->executeScriptFile("main.lua");
+            CHECK(packTestValue(L) == "main");
+            CHECK(lua_gettop(L) == top);
+        }
+
+        SUBCASE("a longer name doesn't fall back to a shorter packed module")
+        {
+            stack->executeScriptFile("app/main.lua");
+            CHECK(packTestValue(L).empty());
+            CHECK(lua_gettop(L) == top);
+        }
+
+        SUBCASE("a packed chunk that fails to load is not replaced by the file")
+        {
+            fileUtils->writeStringToFile(makeBrokenPack("broken", "packTestValue = ("), root + "broken.pack");
+            REQUIRE(stack->loadChunksFromPack((root + "broken.pack").c_str()) == 1);
+            CHECK(stack->executeScriptFile("broken.lua") == 0);
+            CHECK(packTestValue(L).empty());
+            CHECK(lua_gettop(L) == top);
+        }
+
+        fileUtils->setSearchPaths(searchPaths);
+        fileUtils->removeDirectory(root);
+    }
+}
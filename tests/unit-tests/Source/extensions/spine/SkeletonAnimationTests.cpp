@@ -0,0 +1,234 @@
+/****************************************************************************
+ Copyright (c) 2019-present Axmol Engine contributors (see AUTHORS.md).
+
+ https://axmol.dev/
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ ****************************************************************************/
+
+#include <doctest.h>
+#include "platform/FileUtils.h"
+#include "platform/Image.h"
+#include "renderer/Renderer.h"
+#include "base/Director.h"
+#include "spine/spine-axmol.h"
+#include "spine/SkeletonAnimation.h"
+
+using namespace ax;
+
+namespace
+{
+const char* SEQUENCE_ATLAS = R"(spine_sequence.png
+size: 16,16
+format: RGBA8888
+filter: Linear,Linear
+repeat: none
+f0
+  rotate: false
+  xy: 0, 0
+  size: 4, 4
+  orig: 4, 4
+  offset: 0, 0
+  index: -1
+f1
+  rotate: false
+  xy: 4, 0
+  size: 2, 2
+  orig: 4, 4
+  offset: 1, 1
+  index: -1
+square
+  rotate: false
+  xy: 0, 8
+  size: 8, 8
+  orig: 8, 8
+  offset: 0, 0
+  index: -1
+)";
+
+// frame f1 of the sequence is trimmed, so it covers half the width of f0
+const char* SEQUENCE_SKELETON = R"({
+"skeleton": {"spine": "4.1.00", "width": 8, "height": 8},
+"bones": [{"name": "root"}],
+"slots": [{"name": "slot", "bone": "root", "attachment": "seq"}],
+"skins": [{"name": "default", "attachments": {"slot": {
+    "seq": {"path": "f", "width": 4, "height": 4, "sequence": {"count": 2, "start": 0}},
+    "square": {"path": "square", "width": 8, "height": 8}
+}}}],
+"animations": {"frames": {"attachments": {"default": {"slot": {"seq": {"sequence": [
+    {"mode": "hold", "index": 0}, {"time": 0.5, "index": 1}
+]}}}}}}
+})";
+
+struct SequenceSkeletonData
+{
+    spine::AxmolTextureLoader textureLoader;
+    spine::Atlas* atlas       = nullptr;
+    spine::SkeletonData* data = nullptr;
+    std::string dir;
+
+    SequenceSkeletonData()
+    {
+        auto fileUtils = FileUtils::getInstance();
+        dir            = fileUtils->getWritablePath() + "spine_sequence/";
+        fileUtils->createDirectories(dir);
+
+        std::vector<uint8_t> pixels(16 * 16 * 4, 255);
+        Image image;
+        image.initWithRawData(pixels.data(), pixels.size(), 16, 16, 8);
+        image.saveToFile(dir + "spine_sequence.png", false);
+        fileUtils->writeStringToFile(SEQUENCE_ATLAS, dir + "spine_sequence.atlas");
+
+        atlas = new spine::Atlas((dir + "spine_sequence.atlas").c_str(), &textureLoader);
+        spine::AxmolAtlasAttachmentLoader attachmentLoader(atlas);
+        spine::SkeletonJson json(&attachmentLoader);
+        data = json.readSkeletonData(SEQUENCE_SKELETON);
+    }
+
+    ~SequenceSkeletonData()
+    {
+        spine::SkeletonAnimation::purgeBakedFrameCache();
+        delete data;
+        delete atlas;
+        FileUtils::getInstance()->removeDirectory(dir);
+    }
+
+    // not autoreleased, so it's gone before the data it shares
+    spine::SkeletonAnimation* createSkeleton(float time, bool parallel, bool baked = false)
+    {
+        auto node = new spine::SkeletonAnimation();
+        node->initWithData(data);
+        node->setParallelUpdateEnabled(parallel);
+        node->setBakedFrameCacheEnabled(baked);
+        node->setAnimation(0, "frames", true);
+        node->update(time);
+        return node;
+    }
+
+    spine::RegionAttachment* attachmentOf(spine::SkeletonAnimation* node)
+    {
+        return static_cast<spine::RegionAttachment*>(node->findSlot("slot")->getAttachment());
+    }
+};
+}  // namespace
+
+TEST_SUITE("spine/SkeletonAnimation")
+{
+    TEST_CASE("parallel update")
+    {
+        SequenceSkeletonData skeletons;
+        REQUIRE(skeletons.data);
+
+        SUBCASE("sequence frames stay per skeleton")
+        {
+            auto first  = skeletons.createSkeleton(0.0f, true);
+            auto second = skeletons.createSkeleton(0.6f, true);
+            spine::SkeletonAnimation::finishParallelUpdates();
+            CHECK(first->getBoundingBox().size.width == doctest::Approx(4.0f));
+            CHECK(second->getBoundingBox().size.width == doctest::Approx(2.0f));
+
+            // the attachment is shared, drawing applies the frame of the skeleton being drawn
+            auto renderer = Director::getInstance()->getRenderer();
+            first->draw(renderer, Mat4::IDENTITY, 0);
+            CHECK(skeletons.attachmentOf(first)->getRegion() == skeletons.atlas->findRegion("f0"));
+            second->draw(renderer, Mat4::IDENTITY, 0);
+            CHECK(skeletons.attachmentOf(second)->getRegion() == skeletons.atlas->findRegion("f1"));
+            renderer->clean();
+
+            first->release();
+            second->release();
+        }
+
+        SUBCASE("pending skeletons are retained until solved or removed")
+        {
+            auto node        = skeletons.createSkeleton(0.0f, false);
+            const auto count = node->getReferenceCount();
+            node->setParallelUpdateEnabled(true);
+            node->update(0.0f);
+            CHECK(node->getReferenceCount() == count + 1);
+            spine::SkeletonAnimation::finishParallelUpdates();
+            CHECK(node->getReferenceCount() == count);
+
+            node->update(0.0f);
+            node->onExit();
+            CHECK(node->getReferenceCount() == count);
+            CHECK(node->getBoundingBox().size.width == doctest::Approx(4.0f));
+            node->release();
+        }
+    }
+
+    TEST_CASE("baked frames")
+    {
+        SequenceSkeletonData skeletons;
+        REQUIRE(skeletons.data);
+
+        auto baked = skeletons.createSkeleton(0.0f, false, true);
+        CHECK(baked->getBoundingBox().size.width == doctest::Approx(4.0f));
+
+        // same frame, but the slot shows another attachment than the baked one
+        auto changed = skeletons.createSkeleton(0.0f, false, true);
+        changed->setAttachment("slot", "square");
+        changed->update(0.0f);
+        CHECK(changed->getBoundingBox().size.width == doctest::Approx(8.0f));
+
+        auto replayed = skeletons.createSkeleton(0.0f, false, true);
+        CHECK(replayed->getBoundingBox().size.width == doctest::Approx(4.0f));
+
+        baked->release();
+        changed->release();
+        replayed->release();
+    }
+
+    TEST_CASE("baked frame cache lifetime")
+    {
+        SequenceSkeletonData skeletons;
+        REQUIRE(skeletons.data);
+        spine::SkeletonAnimation::purgeBakedFrameCache();
+
+        SUBCASE("frames of deleted skeleton data are dropped")
+        {
+            auto node = skeletons.createSkeleton(0.0f, false, true);
+            CHECK(spine::SkeletonAnimation::getBakedFrameCacheSize() > 0);
+            spine::SkeletonAnimation::purgeBakedFrameCache(skeletons.data);
+            CHECK(spine::SkeletonAnimation::getBakedFrameCacheSize() == 0);
+            node->release();
+        }
+
+        SUBCASE("least recently used frames are dropped over the limit")
+        {
+            const auto limit = spine::SkeletonAnimation::getBakedFrameCacheLimit();
+            auto first       = skeletons.createSkeleton(0.0f, false, true);
+            const auto size  = spine::SkeletonAnimation::getBakedFrameCacheSize();
+            REQUIRE(size > 0);
+
+            // room for a single frame, baking the second frame drops the first one
+            spine::SkeletonAnimation::setBakedFrameCacheLimit(size);
+            auto second = skeletons.createSkeleton(0.6f, false, true);
+            CHECK(spine::SkeletonAnimation::getBakedFrameCacheSize() <= size);
+            CHECK(second->getBoundingBox().size.width == doctest::Approx(2.0f));
+
+            spine::SkeletonAnimation::setBakedFrameCacheLimit(0);
+            CHECK(spine::SkeletonAnimation::getBakedFrameCacheSize() == 0);
+
+            spine::SkeletonAnimation::setBakedFrameCacheLimit(limit);
+            first->release();
+            second->release();
+        }
+    }
+}